@@ -33,6 +33,10 @@ overhead. Note that the tag `ExactAlphaComparisonTag` is currently ignored (mean
 if `Dt::Geom_traits::FT` is not a floating point number type as this strategy
 does not make sense if the traits class already provides exact constructions.
 
+\tparam ConcurrencyTag enables sequential versus parallel construction of the alpha intervals.
+Possible values are `Sequential_tag` (the default) and `Parallel_tag`.
+With `Parallel_tag`, \ref thirdpartyTBB or OpenMP must be available and linked.
+
 \warning
 <ul>
 <li>When the tag `ExactAlphaComparisonTag` is set to \link Tag_true `Tag_true`\endlink,
@@ -68,7 +72,12 @@ is an internal format.
 
 The set of intervals associated with the
 \f$ k\f$-dimensional faces of the underlying triangulation are
-stored in `multimaps`.
+stored in arrays sorted by intervals.
+When `ConcurrencyTag` is `Parallel_tag`, the intervals are computed
+and sorted in parallel.
+
+If the alpha shape is needed for a single value of \f$ \alpha\f$ only,
+the class `Fixed_alpha_shape_2` is faster and uses less memory.
 
 The cross links between the intervals and the \f$ k\f$-dimensional faces of the
 triangulation are realized using methods in the \f$ k\f$-dimensional faces
@@ -83,7 +92,7 @@ linear in the number of faces of the underlying triangulation.
 \cgalBigO{n \log n}, where \f$ n\f$ is the number of points.
 
 */
-template< typename Dt, typename ExactAlphaComparisonTag >
+template< typename Dt, typename ExactAlphaComparisonTag, typename ConcurrencyTag >
 class Alpha_shape_2 : public Dt {
 public:
 
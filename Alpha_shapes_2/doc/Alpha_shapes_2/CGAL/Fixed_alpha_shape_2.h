@@ -0,0 +1,156 @@
+
+namespace CGAL {
+
+/*!
+\ingroup PkgAlphaShapes2Ref
+
+The class `Fixed_alpha_shape_2` represents one (fixed)
+alpha shape of points in a plane for a real
+\f$ \alpha\f$. It maintains an underlying triangulation
+of the class `Dt` which
+represents connectivity and order among its faces. Each
+\f$ k\f$-dimensional face of the `Dt` is associated with
+a classification that specifies its status in the alpha complex, alpha being fixed.
+
+Contrary to `Alpha_shape_2`, neither the intervals of the faces nor
+the spectrum of alpha values are computed, which makes this class
+faster and lighter when a single value of \f$ \alpha\f$ is needed.
+The classification of a face is the one given by `Alpha_shape_2`
+in `Alpha_shape_2::GENERAL` mode. The squared radii of the faces are
+compared exactly to \f$ \alpha\f$.
+
+Note that this class is used for <I>basic</I> and <I>weighted</I> Alpha Shapes.
+
+\tparam Dt must be either `Delaunay_triangulation_2` or `Regular_triangulation_2`.
+Note that `Dt::Geom_traits`, `Dt::Vertex`, and `Dt::Face`
+must be model the concepts `AlphaShapeTraits_2`,
+`FixedAlphaShapeVertex_2` and `FixedAlphaShapeFace_2`, respectively.
+
+\tparam ConcurrencyTag enables sequential versus parallel computation of the classifications.
+Possible values are `Sequential_tag` (the default) and `Parallel_tag`.
+With `Parallel_tag`, \ref thirdpartyTBB or OpenMP must be available and linked.
+
+The modifying functions `insert` and `remove` will overwrite
+the one inherited from the underlying triangulation class `Dt`.
+At the moment, only the static version is implemented.
+
+\sa `CGAL::Alpha_shape_2<Dt,ExactAlphaComparisonTag,ConcurrencyTag>`
+*/
+template< typename Dt, typename ConcurrencyTag >
+class Fixed_alpha_shape_2 : public Dt {
+public:
+
+/// \name Types
+/// @{
+
+/*!
+the alpha shape traits type. It has to derive from a triangulation
+traits class. For example `Dt::Point` is a point class.
+*/
+typedef unspecified_type Gt;
+
+/*!
+the number type of alpha.
+*/
+typedef Gt::FT FT;
+
+/*!
+Enum to classify the faces of the underlying
+triangulation with respect to the alpha shape.
+*/
+enum class Classification_type {EXTERIOR, SINGULAR, REGULAR, INTERIOR};
+
+/// @}
+
+/// \name Creation
+/// @{
+
+/*!
+Introduces an empty alpha shape with fixed alpha value `alpha`.
+*/
+Fixed_alpha_shape_2(FT alpha = 0);
+
+/*!
+Builds a fixed alpha shape of type `Fixed_alpha_shape_2<Dt>` from the triangulation `dt`.
+\attention This operation swaps `*this` and `dt`, that is `dt` is an empty triangulation once
+the fixed alpha shape is built.
+*/
+Fixed_alpha_shape_2(Dt& dt, FT alpha = 0);
+
+/*!
+Builds a fixed alpha shape for the points in the range
+`[first,last)`.
+\tparam InputIterator must be an input iterator with the value type `Point`.
+*/
+template < class InputIterator >
+Fixed_alpha_shape_2(InputIterator first, InputIterator last, const FT& alpha = 0);
+
+/// @}
+
+/// \name Modifiers
+/// @{
+
+/*!
+Clears the structure.
+*/
+void clear();
+
+/// @}
+
+/// \name Query Functions
+/// @{
+
+/*!
+Returns the \f$ \alpha\f$-value.
+*/
+const FT& get_alpha() const;
+
+/*!
+Classifies the face `f` of the underlying triangulation with respect to the alpha shape.
+*/
+Classification_type classify(Face_handle f) const;
+
+/*!
+Classifies the edge `e` of the underlying triangulation with respect to the alpha shape.
+*/
+Classification_type classify(const Edge& e) const;
+
+/*!
+Classifies the edge of the face `f` opposite to the vertex with index
+`i` of `f` with respect to the alpha shape.
+*/
+Classification_type classify(Face_handle f, int i) const;
+
+/*!
+Classifies the vertex `v` of the underlying triangulation with respect to the alpha shape.
+*/
+Classification_type classify(Vertex_handle v) const;
+
+/*!
+Writes the faces which are of type `type` in
+the alpha complex to the sequence pointed to by the output iterator `it`. Returns past the end
+of the output sequence.
+*/
+template<class OutputIterator>
+OutputIterator get_alpha_shape_faces(OutputIterator it, Classification_type type) const;
+
+/*!
+Writes the edges which are of type `type` in
+the alpha complex to the sequence pointed to by the output iterator `it`. Returns past the end
+of the output sequence.
+*/
+template<class OutputIterator>
+OutputIterator get_alpha_shape_edges(OutputIterator it, Classification_type type) const;
+
+/*!
+Writes the vertices which are of type `type` in
+the alpha complex to the sequence pointed to by the output iterator `it`. Returns past the end
+of the output sequence.
+*/
+template<class OutputIterator>
+OutputIterator get_alpha_shape_vertices(OutputIterator it, Classification_type type) const;
+
+/// @}
+
+}; /* end Fixed_alpha_shape_2 */
+} /* end namespace CGAL */
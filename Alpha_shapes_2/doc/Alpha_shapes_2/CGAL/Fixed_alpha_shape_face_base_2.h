@@ -0,0 +1,27 @@
+
+namespace CGAL {
+
+/*!
+\ingroup PkgAlphaShapes2Ref
+
+The class `Fixed_alpha_shape_face_base_2` is the default model for the concept
+`FixedAlphaShapeFace_2`.
+
+\tparam Traits is the geometric traits class that is provided
+to the `Fixed_alpha_shape_2` class.
+\tparam Fb must be a face base class adapted to the type of triangulation that is being used.
+        By default, it is instantiated with `Triangulation_face_base_2<Traits>`,
+        which is appropriate for basic alpha shapes.
+
+\cgalModels{FixedAlphaShapeFace_2}
+
+\sa `Alpha_shape_face_base_2`
+\sa `Triangulation_face_base_2`
+\sa `Regular_triangulation_face_base_2`
+*/
+template< typename Traits, typename Fb >
+class Fixed_alpha_shape_face_base_2 : public Fb {
+public:
+
+}; /* end Fixed_alpha_shape_face_base_2 */
+} /* end namespace CGAL */
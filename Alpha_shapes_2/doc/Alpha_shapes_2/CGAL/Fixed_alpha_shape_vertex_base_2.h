@@ -0,0 +1,27 @@
+
+namespace CGAL {
+
+/*!
+\ingroup PkgAlphaShapes2Ref
+
+The class `Fixed_alpha_shape_vertex_base_2` is the default model for the concept
+`FixedAlphaShapeVertex_2`.
+
+\tparam Traits is the geometric traits class that is provided
+to the `Fixed_alpha_shape_2` class.
+\tparam Vb must be a vertex base class adapted to the type of triangulation that is being used.
+        By default, it is instantiated with `Triangulation_vertex_base_2<Traits>`,
+        which is appropriate for basic alpha shapes.
+
+\cgalModels{FixedAlphaShapeVertex_2}
+
+\sa `Alpha_shape_vertex_base_2`
+\sa `Triangulation_vertex_base_2`
+\sa `Regular_triangulation_vertex_base_2`
+*/
+template< typename Traits, typename Vb >
+class Fixed_alpha_shape_vertex_base_2 : public Vb {
+public:
+
+}; /* end Fixed_alpha_shape_vertex_base_2 */
+} /* end namespace CGAL */
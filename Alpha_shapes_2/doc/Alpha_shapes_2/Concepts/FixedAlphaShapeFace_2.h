@@ -0,0 +1,49 @@
+
+/*!
+\ingroup PkgAlphaShapes2Concepts
+\cgalConcept
+
+The concept `FixedAlphaShapeFace_2` describes the requirements for the base face of an alpha shape with a fixed value alpha.
+
+\cgalRefines{TriangulationFaceBase_2 if the underlying triangulation of the alpha shape is a Delaunay triangulation,
+  RegularTriangulationFaceBase_2 if the underlying triangulation of the alpha shape is a regular triangulation}
+
+\cgalHasModelsBegin
+\cgalHasModelsBare{`CGAL::Fixed_alpha_shape_face_base_2` (templated with the appropriate triangulation face base class)}
+\cgalHasModelsEnd
+*/
+
+class FixedAlphaShapeFace_2 {
+public:
+
+/// \name Access Functions
+/// @{
+
+/*!
+Returns the classification of the face.
+*/
+Classification_type get_classification_type();
+
+/*!
+Returns the classification of the edge of the face opposite to the vertex with index `i`.
+*/
+Classification_type get_edge_classification_type(int i);
+
+/// @}
+
+/// \name Modifiers
+/// @{
+
+/*!
+Sets the classification of the face.
+*/
+void set_classification_type(Classification_type type);
+
+/*!
+Sets the classification of the edge of the face opposite to the vertex with index `i`.
+*/
+void set_edge_classification_type(int i, Classification_type type);
+
+/// @}
+
+}; /* end FixedAlphaShapeFace_2 */
@@ -0,0 +1,39 @@
+
+/*!
+\ingroup PkgAlphaShapes2Concepts
+\cgalConcept
+
+The concept `FixedAlphaShapeVertex_2` describes the requirements for the base vertex of an alpha shape with a fixed value alpha.
+
+\cgalRefines{TriangulationVertexBase_2 if the underlying triangulation of the alpha shape is a Delaunay triangulation,
+  RegularTriangulationVertexBase_2 if the underlying triangulation of the alpha shape is a regular triangulation}
+
+\cgalHasModelsBegin
+\cgalHasModelsBare{`CGAL::Fixed_alpha_shape_vertex_base_2` (templated with the appropriate triangulation vertex base class)}
+\cgalHasModelsEnd
+*/
+
+class FixedAlphaShapeVertex_2 {
+public:
+
+/// \name Access Functions
+/// @{
+
+/*!
+Returns the classification of the vertex.
+*/
+Classification_type get_classification_type();
+
+/// @}
+
+/// \name Modifiers
+/// @{
+
+/*!
+Sets the classification of the vertex.
+*/
+void set_classification_type(Classification_type type);
+
+/// @}
+
+}; /* end FixedAlphaShapeVertex_2 */
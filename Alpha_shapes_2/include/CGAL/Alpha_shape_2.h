@@ -15,6 +15,7 @@
 
 #include <CGAL/license/Alpha_shapes_2.h>
 
+#include <CGAL/Alpha_shapes_2/internal/Alpha_shape_2_concurrency.h>
 #include <CGAL/Alpha_shapes_2/internal/Lazy_alpha_nt_2.h>
 
 // for convenience only
@@ -23,6 +24,9 @@
 
 #include <CGAL/assertions.h>
 #include <CGAL/basic.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 #include <CGAL/Unique_hash_map.h>
 #include <CGAL/utility.h>
 
@@ -36,7 +40,7 @@
 
 namespace CGAL {
 
-template < class Dt,class ExactAlphaComparisonTag = Tag_false>
+template < class Dt,class ExactAlphaComparisonTag = Tag_false, class ConcurrencyTag = Sequential_tag>
 class Alpha_shape_2 : public Dt
 {
   // DEFINITION The class Alpha_shape_2<Dt> represents the family
@@ -49,6 +53,8 @@ class Alpha_shape_2 : public Dt
   // between the intervals and the k-dimensional faces of the Delaunay
   // triangulation (multimaps resp. std::hashtables).
   //
+  // With `Parallel_tag`, the intervals are computed in parallel.
+  //
 
   //------------------------- TYPES ------------------------------------
 
@@ -126,17 +132,19 @@ public:
 
 private:
 
-  typedef std::multimap< Type_of_alpha, Face_handle >  Interval_face_map;
-  typedef typename Interval_face_map::value_type    Interval_face;
+  // the interval maps are arrays sorted by interval, the faces with equal
+  // intervals being stored in the order of the triangulation
+  typedef std::pair< Type_of_alpha, Face_handle >   Interval_face;
+  typedef std::vector< Interval_face >              Interval_face_map;
 
   typedef typename Tds::Face::Interval_3            Interval3;
 
-  typedef std::multimap< Interval3, Edge >          Interval_edge_map;
-  typedef typename Interval_edge_map::value_type    Interval_edge;
+  typedef std::pair< Interval3, Edge >              Interval_edge;
+  typedef std::vector< Interval_edge >              Interval_edge_map;
 
   typedef std::pair< Type_of_alpha, Type_of_alpha > Interval2;
-  typedef std::multimap< Interval2, Vertex_handle > Interval_vertex_map;
-  typedef typename Interval_vertex_map::value_type  Interval_vertex;
+  typedef std::pair< Interval2, Vertex_handle >     Interval_vertex;
+  typedef std::vector< Interval_vertex >            Interval_vertex_map;
 
   typedef Face_handle const const_void;
   typedef std::pair<const_void, int> const_Edge;
@@ -321,6 +329,12 @@ protected :
 
   void initialize_alpha_spectrum();
 
+  // computes the interval of `edge`, and stores it in its two incident faces
+  void compute_interval_edge(Edge edge, Interval_edge& result) const;
+
+  Interval2 compute_interval_vertex(const Vertex_handle& v,
+                                    const Type_of_alpha& alpha_max_f) const;
+
   //---------------------------------------------------------------------
 
 public:
@@ -763,162 +777,208 @@ public:
 //---------------------------------------------------------------------
 
 
-template < class Dt, class EACT >
+template < class Dt, class EACT, class CT >
 void
-Alpha_shape_2<Dt,EACT>::initialize_interval_face_map()
+Alpha_shape_2<Dt,EACT,CT>::initialize_interval_face_map()
 {
-  Type_of_alpha alpha_f;
-
   // only finite faces
+  std::vector<Face_handle> faces;
+  faces.reserve(this->number_of_faces());
   for(Finite_faces_iterator face_it = faces_begin(); face_it != faces_end(); ++face_it)
+    faces.push_back(face_it);
+
+  _interval_face_map.resize(faces.size());
+  CGAL::for_each<CT>(CGAL::make_counting_range<std::size_t>(0, faces.size()),
+    [&](std::size_t k) -> bool
     {
-      alpha_f = squared_radius(face_it);
-      _interval_face_map.insert(Interval_face(alpha_f, face_it));
+      Type_of_alpha alpha_f = squared_radius(faces[k]);
+      _interval_face_map[k] = Interval_face(alpha_f, faces[k]);
 
       // cross references
-      face_it->set_alpha(alpha_f);
-    }
+      faces[k]->set_alpha(alpha_f);
+      return true;
+    });
+
+  internal::sort_alpha_intervals<CT>(_interval_face_map);
 }
 
 //-------------------------------------------------------------------------
 
-template < class Dt, class EACT >
+template < class Dt, class EACT, class CT >
 void
-Alpha_shape_2<Dt,EACT>::initialize_interval_edge_map()
+Alpha_shape_2<Dt,EACT,CT>::initialize_interval_edge_map()
 {
-  Edge_iterator edge_it;
-  Edge edge;
-
-  // only finite faces
-  for( edge_it = edges_begin();
-       edge_it != edges_end();
-       ++edge_it)
+  // only finite edges
+  std::vector<Edge> edges;
+  edges.reserve(this->number_of_vertices() * 3);
+  for(Edge_iterator edge_it = edges_begin(); edge_it != edges_end(); ++edge_it)
+    edges.push_back(*edge_it);
+
+  // each edge writes its interval in its two incident faces only
+  _interval_edge_map.resize(edges.size());
+  CGAL::for_each<CT>(CGAL::make_counting_range<std::size_t>(0, edges.size()),
+    [&](std::size_t k) -> bool
     {
-      Interval3 interval;
-      edge = (*edge_it);
+      compute_interval_edge(edges[k], _interval_edge_map[k]);
+      return true;
+    });
+
+  internal::sort_alpha_intervals<CT>(_interval_edge_map);
+
+  // Remark:
+  // The interval_edge_map will be sorted as follows
+  // first the attached edges on the convex hull
+  // second                   not on the convex hull
+  // third the un-attached edges on the convex hull
+  // finally                     not on the convex hull
+  //
+  // if we are in regularized mode we should sort differently
+  // by the second third first Key
+}
+
+//-------------------------------------------------------------------------
+
+template < class Dt, class EACT, class CT >
+void
+Alpha_shape_2<Dt,EACT,CT>::compute_interval_edge(Edge edge,
+                                                 Interval_edge& result) const
+{
+  Interval3 interval;
 
-      Face_handle pFace = edge.first;
-      int i = edge.second;
-      Face_handle pNeighbor = pFace->neighbor(i);
-      int Neigh_i = pNeighbor->index(pFace);
+  Face_handle pFace = edge.first;
+  int i = edge.second;
+  Face_handle pNeighbor = pFace->neighbor(i);
+  int Neigh_i = pNeighbor->index(pFace);
 
-      // not on the convex hull
+  // not on the convex hull
 
-      if(!is_infinite(pFace) && !is_infinite(pNeighbor))
+  if(!is_infinite(pFace) && !is_infinite(pNeighbor))
+    {
+      Type_of_alpha squared_radius_Face =
+        find_interval(pFace);
+      Type_of_alpha squared_radius_Neighbor =
+        find_interval(pNeighbor);
+      if (squared_radius_Neighbor < squared_radius_Face)
         {
-          Type_of_alpha squared_radius_Face =
-            find_interval(pFace);
-          Type_of_alpha squared_radius_Neighbor =
-            find_interval(pNeighbor);
-          if (squared_radius_Neighbor < squared_radius_Face)
-            {
-              edge =  Edge(pNeighbor, Neigh_i);
-              Type_of_alpha coord_tmp = squared_radius_Face;
-              squared_radius_Face = squared_radius_Neighbor;
-              squared_radius_Neighbor = coord_tmp;
-            }
-          interval = (is_attached(pFace, i) ||
-                      is_attached(pNeighbor, Neigh_i)) ?
-            make_triple(UNDEFINED,
-                        squared_radius_Face,
-                        squared_radius_Neighbor):
-            make_triple(squared_radius(pFace, i),
-                        squared_radius_Face,
-                        squared_radius_Neighbor);
+          edge =  Edge(pNeighbor, Neigh_i);
+          Type_of_alpha coord_tmp = squared_radius_Face;
+          squared_radius_Face = squared_radius_Neighbor;
+          squared_radius_Neighbor = coord_tmp;
         }
-      else
-        { // on the convex hull
+      interval = (is_attached(pFace, i) ||
+                  is_attached(pNeighbor, Neigh_i)) ?
+        make_triple(UNDEFINED,
+                    squared_radius_Face,
+                    squared_radius_Neighbor):
+        make_triple(squared_radius(pFace, i),
+                    squared_radius_Face,
+                    squared_radius_Neighbor);
+    }
+  else
+    { // on the convex hull
 
-          if(is_infinite(pFace))
+      if(is_infinite(pFace))
+        {
+          if (!is_infinite(pNeighbor))
             {
-              if (!is_infinite(pNeighbor))
-                {
-                  interval =  (is_attached(pNeighbor,
-                                           Neigh_i)) ?
-                    make_triple(UNDEFINED,
-                                find_interval(pNeighbor),
-                                Infinity):
-                    make_triple(squared_radius(pNeighbor,
-                                               Neigh_i),
-                                find_interval(pNeighbor),
-                                Infinity);
-                  edge =  Edge(pNeighbor, Neigh_i);
-                }
-              else
-                {
-                  // both faces are infinite by definition unattached
-                  // the edge is finite by construction
-                  CGAL_precondition((is_infinite(pNeighbor)
-                                                   && is_infinite(pFace)));
-                  interval = make_triple(squared_radius(pFace, i),
-                                         Infinity,
-                                         Infinity);
-                }
+              interval =  (is_attached(pNeighbor,
+                                       Neigh_i)) ?
+                make_triple(UNDEFINED,
+                            find_interval(pNeighbor),
+                            Infinity):
+                make_triple(squared_radius(pNeighbor,
+                                           Neigh_i),
+                            find_interval(pNeighbor),
+                            Infinity);
+              edge =  Edge(pNeighbor, Neigh_i);
             }
           else
-            { // is_infinite(pNeighbor)
-
+            {
+              // both faces are infinite by definition unattached
+              // the edge is finite by construction
               CGAL_precondition((is_infinite(pNeighbor)
-                                               && !is_infinite(pFace)));
-              if (is_attached(pFace, i))
-                interval = make_triple(UNDEFINED,
-                                       find_interval(pFace),
-                                       Infinity);
-              else
-                interval = make_triple(squared_radius(pFace, i),
-                                       find_interval(pFace),
-                                       Infinity);
-
+                                               && is_infinite(pFace)));
+              interval = make_triple(squared_radius(pFace, i),
+                                     Infinity,
+                                     Infinity);
             }
         }
+      else
+        { // is_infinite(pNeighbor)
+
+          CGAL_precondition((is_infinite(pNeighbor)
+                                           && !is_infinite(pFace)));
+          if (is_attached(pFace, i))
+            interval = make_triple(UNDEFINED,
+                                   find_interval(pFace),
+                                   Infinity);
+          else
+            interval = make_triple(squared_radius(pFace, i),
+                                   find_interval(pFace),
+                                   Infinity);
 
-      _interval_edge_map.insert(Interval_edge(interval, edge));
-
-      // cross-links
-      (edge.first)->set_ranges(edge.second,interval);
-      // MY : to fix a bug I store the interval of the edge in both faces
-      Face_handle neighbor = (edge.first)->neighbor(edge.second);
-      int ni = neighbor->index(edge.first);
-      neighbor->set_ranges( ni, interval);
-
+        }
     }
 
-  // Remark:
-  // The interval_edge_map will be sorted as follows
-  // first the attached edges on the convex hull
-  // second                   not on the convex hull
-  // third the un-attached edges on the convex hull
-  // finally                     not on the convex hull
-  //
-  // if we are in regularized mode we should sort differently
-  // by the second third first Key
+  result = Interval_edge(interval, edge);
+
+  // cross-links
+  (edge.first)->set_ranges(edge.second,interval);
+  // MY : to fix a bug I store the interval of the edge in both faces
+  Face_handle neighbor = (edge.first)->neighbor(edge.second);
+  int ni = neighbor->index(edge.first);
+  neighbor->set_ranges( ni, interval);
 }
 
 //-------------------------------------------------------------------------
 
-template < class Dt, class EACT >
+template < class Dt, class EACT, class CT >
 void
-Alpha_shape_2<Dt,EACT>::initialize_interval_vertex_map()
+Alpha_shape_2<Dt,EACT,CT>::initialize_interval_vertex_map()
+{
+  std::vector<Vertex_handle> vertices;
+  vertices.reserve(number_of_vertices());
+  for(Finite_vertices_iterator vertex_it = finite_vertices_begin();
+      vertex_it != finite_vertices_end();
+      ++vertex_it)
+    vertices.push_back(vertex_it);
+
+  const Type_of_alpha alpha_max_f = (!_interval_face_map.empty() ?
+                                     _interval_face_map.back().first :
+                                     Type_of_alpha(0));
+
+  _interval_vertex_map.resize(vertices.size());
+  CGAL::for_each<CT>(CGAL::make_counting_range<std::size_t>(0, vertices.size()),
+    [&](std::size_t k) -> bool
+    {
+      Interval2 interval = compute_interval_vertex(vertices[k], alpha_max_f);
+      _interval_vertex_map[k] = Interval_vertex(interval, vertices[k]);
+
+      // cross references
+      vertices[k]->set_range(interval);
+      return true;
+    });
+
+  internal::sort_alpha_intervals<CT>(_interval_vertex_map);
+}
+
+//-------------------------------------------------------------------------
+
+template < class Dt, class EACT, class CT >
+typename Alpha_shape_2<Dt,EACT,CT>::Interval2
+Alpha_shape_2<Dt,EACT,CT>::compute_interval_vertex(const Vertex_handle& v,
+                                                   const Type_of_alpha& alpha_max_f) const
 {
   Type_of_alpha alpha_mid_v;
   Type_of_alpha alpha_max_v;
   Type_of_alpha alpha_f;
 
-  Finite_vertices_iterator vertex_it;
-
-  for( vertex_it = finite_vertices_begin();
-       vertex_it != finite_vertices_end();
-       ++vertex_it)
-    {
-      Vertex_handle v = vertex_it;
-      Face_handle f;
+  Face_handle f;
 
-      alpha_max_v = Type_of_alpha(0);
-      alpha_mid_v = (!_interval_face_map.empty() ?
-                     (--_interval_face_map.end())->first :
-                     Type_of_alpha(0));
+  alpha_max_v = Type_of_alpha(0);
+  alpha_mid_v = alpha_max_f;
 
-      //----------------- examine incident edges --------------------------
+  //----------------- examine incident edges --------------------------
 
 //         // if we used Edelsbrunner and Muecke's definition
 //         // singular means not incident to any higher-dimensional face
@@ -959,54 +1019,49 @@ Alpha_shape_2<Dt,EACT>::initialize_interval_vertex_map()
 //         while(++edge_circ != edge_done);
 
 
-      //-------------- examine incident faces --------------------------
+  //-------------- examine incident faces --------------------------
 
-      // we use a different definition than Edelsbrunner and Muecke
-      // singular means not incident to any 2-dimensional face
-      // regular means incident to a 2-dimensional face
+  // we use a different definition than Edelsbrunner and Muecke
+  // singular means not incident to any 2-dimensional face
+  // regular means incident to a 2-dimensional face
 
-      Face_circulator face_circ = this->incident_faces(v),
-        done = face_circ;
+  Face_circulator face_circ = this->incident_faces(v),
+    done = face_circ;
 
-      if (!face_circ.is_empty())
+  if (!face_circ.is_empty())
+    {
+      do
         {
-          do
+          f = face_circ;
+          if (is_infinite(f))
             {
-              f = face_circ;
-              if (is_infinite(f))
-                {
-                  alpha_max_v = Infinity;
-                  // continue;
-                }
-              else
-                {
-                  alpha_f = find_interval(f);
-                  // if we define singular as not incident to a 2-dimensional
-                  // face
-                  alpha_mid_v = (CGAL::min)(alpha_mid_v, alpha_f);
+              alpha_max_v = Infinity;
+              // continue;
+            }
+          else
+            {
+              alpha_f = find_interval(f);
+              // if we define singular as not incident to a 2-dimensional
+              // face
+              alpha_mid_v = (CGAL::min)(alpha_mid_v, alpha_f);
 
-                  if (alpha_max_v != Infinity)
-                    alpha_max_v = (CGAL::max)(alpha_max_v, alpha_f);
+              if (alpha_max_v != Infinity)
+                alpha_max_v = (CGAL::max)(alpha_max_v, alpha_f);
 
-                }
             }
-          while(++face_circ != done);
         }
+      while(++face_circ != done);
+    }
 
 
-      Interval2 interval = std::make_pair(alpha_mid_v, alpha_max_v);
-      _interval_vertex_map.insert(Interval_vertex(interval, vertex_it));
-
-      // cross references
-      vertex_it->set_range(interval);
-    }
+  return std::make_pair(alpha_mid_v, alpha_max_v);
 }
 
 //-------------------------------------------------------------------------
 
-template < class Dt, class EACT >
+template < class Dt, class EACT, class CT >
 void
-Alpha_shape_2<Dt,EACT>::initialize_alpha_spectrum()
+Alpha_shape_2<Dt,EACT,CT>::initialize_alpha_spectrum()
 {
 
   // skip the attached edges
@@ -1080,14 +1135,14 @@ Alpha_shape_2<Dt,EACT>::initialize_alpha_spectrum()
 
 
 
-template < class Dt, class EACT >
+template < class Dt, class EACT, class CT >
 void
-Alpha_shape_2<Dt,EACT>::update_alpha_shape_vertex_list()const {
-        //typedef typename Alpha_shape_2<Dt,EACT>::Interval_vertex_map
+Alpha_shape_2<Dt,EACT,CT>::update_alpha_shape_vertex_list()const {
+        //typedef typename Alpha_shape_2<Dt,EACT,CT>::Interval_vertex_map
         //                                              Interval_vertex_map;
         typename Interval_vertex_map::const_iterator vertex_alpha_it;
 
-        //const typename Alpha_shape_2<Dt,EACT>::Interval2* pInterval2;
+        //const typename Alpha_shape_2<Dt,EACT,CT>::Interval2* pInterval2;
         const Interval2* pInterval2;
         Vertex_handle v;
         Alpha_shape_vertices_list.clear();
@@ -1113,7 +1168,7 @@ Alpha_shape_2<Dt,EACT>::update_alpha_shape_vertex_list()const {
                 }
                 }
 
-        if (get_mode() == Alpha_shape_2<Dt,EACT>::GENERAL)
+        if (get_mode() == Alpha_shape_2<Dt,EACT,CT>::GENERAL)
                 {
                 // write the singular vertices
                 for (;
@@ -1131,18 +1186,18 @@ Alpha_shape_2<Dt,EACT>::update_alpha_shape_vertex_list()const {
 
 //-------------------------------------------------------------------------
 
-template < class Dt, class EACT >
+template < class Dt, class EACT, class CT >
 void
-Alpha_shape_2<Dt,EACT>::update_alpha_shape_edges_list() const
+Alpha_shape_2<Dt,EACT,CT>::update_alpha_shape_edges_list() const
 {
 
   // Writes the edges of the alpha shape `A' for the current $\alpha$-value
   // to the container where 'out' refers to. Returns an output iterator
   // which is the end of the constructed range.
-  //typedef  typename Alpha_shape_2<Dt,EACT>::Interval_edge_map Interval_edge_map;
+  //typedef  typename Alpha_shape_2<Dt,EACT,CT>::Interval_edge_map Interval_edge_map;
   typename Interval_edge_map::const_iterator edge_alpha_it;
 
-  //const typename Alpha_shape_2<Dt,EACT>::Interval3* pInterval;
+  //const typename Alpha_shape_2<Dt,EACT,CT>::Interval3* pInterval;
   const Interval3* pInterval;
   Alpha_shape_edges_list.clear();
   if (get_mode() == REGULARIZED)
@@ -1237,9 +1292,9 @@ Alpha_shape_2<Dt,EACT>::update_alpha_shape_edges_list() const
 
 //-------------------------------------------------------------------------
 
-template < class Dt, class EACT >
-typename Alpha_shape_2<Dt,EACT>::Classification_type
-Alpha_shape_2<Dt,EACT>::classify(const Face_handle& f, int i,
+template < class Dt, class EACT, class CT >
+typename Alpha_shape_2<Dt,EACT,CT>::Classification_type
+Alpha_shape_2<Dt,EACT,CT>::classify(const Face_handle& f, int i,
                             const Type_of_alpha& alpha) const
 {
   // Classifies the edge `e' of the underlying Delaunay
@@ -1276,9 +1331,9 @@ Alpha_shape_2<Dt,EACT>::classify(const Face_handle& f, int i,
 
 //-------------------------------------------------------------------------
 
-template < class Dt, class EACT >
-typename Alpha_shape_2<Dt,EACT>::Classification_type
-Alpha_shape_2<Dt,EACT>::classify(const Vertex_handle& v,
+template < class Dt, class EACT, class CT >
+typename Alpha_shape_2<Dt,EACT,CT>::Classification_type
+Alpha_shape_2<Dt,EACT,CT>::classify(const Vertex_handle& v,
                             const Type_of_alpha& alpha) const
 {
   // Classifies the vertex `v' of the underlying Delaunay
@@ -1304,9 +1359,9 @@ Alpha_shape_2<Dt,EACT>::classify(const Vertex_handle& v,
 
 //-------------------------------------------------------------------------
 
-template < class Dt, class EACT >
-typename Alpha_shape_2<Dt,EACT>::size_type
-Alpha_shape_2<Dt,EACT>::number_of_solid_components(const Type_of_alpha& alpha) const
+template < class Dt, class EACT, class CT >
+typename Alpha_shape_2<Dt,EACT,CT>::size_type
+Alpha_shape_2<Dt,EACT,CT>::number_of_solid_components(const Type_of_alpha& alpha) const
 {
   // Determine the number of connected solid components
   typedef typename Marked_face_set::Data Data;
@@ -1340,9 +1395,9 @@ Alpha_shape_2<Dt,EACT>::number_of_solid_components(const Type_of_alpha& alpha) c
 
 //-------------------------------------------------------------------------
 
-template < class Dt, class EACT >
+template < class Dt, class EACT, class CT >
 void
-Alpha_shape_2<Dt,EACT>::traverse(const Face_handle& pFace,
+Alpha_shape_2<Dt,EACT,CT>::traverse(const Face_handle& pFace,
                             Marked_face_set& marked_face_set,
                             const Type_of_alpha alpha) const
 {
@@ -1371,9 +1426,9 @@ Alpha_shape_2<Dt,EACT>::traverse(const Face_handle& pFace,
 
 //-------------------------------------------------------------------------
 
-template < class Dt, class EACT >
-typename Alpha_shape_2<Dt,EACT>::Alpha_iterator
-Alpha_shape_2<Dt,EACT>::find_optimal_alpha(size_type nb_components)
+template < class Dt, class EACT, class CT >
+typename Alpha_shape_2<Dt,EACT,CT>::Alpha_iterator
+Alpha_shape_2<Dt,EACT,CT>::find_optimal_alpha(size_type nb_components)
 {
   // find the minimum alpha that satisfies the properties
   // (1) nb_components solid components
@@ -1431,9 +1486,9 @@ Alpha_shape_2<Dt,EACT>::find_optimal_alpha(size_type nb_components)
 
 //-------------------------------------------------------------------------
 
-template < class Dt, class EACT >
-typename Alpha_shape_2<Dt,EACT>::Type_of_alpha
-Alpha_shape_2<Dt,EACT>::find_alpha_solid() const
+template < class Dt, class EACT, class CT >
+typename Alpha_shape_2<Dt,EACT,CT>::Type_of_alpha
+Alpha_shape_2<Dt,EACT,CT>::find_alpha_solid() const
 {
   // compute the minimum alpha such that all data points
   // are either on the boundary or in the interior
@@ -1444,15 +1499,21 @@ Alpha_shape_2<Dt,EACT>::find_alpha_solid() const
 
   if (number_of_vertices()<3) return alpha_solid;
 
-  Finite_vertices_iterator vertex_it;
+  std::vector<Vertex_handle> vertices;
+  vertices.reserve(number_of_vertices());
   // only finite vertices
-  for( vertex_it = finite_vertices_begin();
-       vertex_it != finite_vertices_end();
-       ++vertex_it)
+  for(Finite_vertices_iterator vertex_it = finite_vertices_begin();
+      vertex_it != finite_vertices_end();
+      ++vertex_it)
+    vertices.push_back(vertex_it);
+
+  std::vector<Type_of_alpha> alpha_min(vertices.size());
+  CGAL::for_each<CT>(CGAL::make_counting_range<std::size_t>(0, vertices.size()),
+    [&](std::size_t k) -> bool
     {
-      Type_of_alpha alpha_min_v = (--_interval_face_map.end())->first;
+      Type_of_alpha alpha_min_v = _interval_face_map.back().first;
 
-      Face_circulator face_circ = this->incident_faces(vertex_it);
+      Face_circulator face_circ = this->incident_faces(vertices[k]);
       Face_circulator  done = face_circ;
       do
         {
@@ -1462,32 +1523,36 @@ Alpha_shape_2<Dt,EACT>::find_alpha_solid() const
                                       alpha_min_v);
         }
       while (++face_circ != done);
-      alpha_solid = (CGAL::max)(alpha_min_v, alpha_solid);
+      alpha_min[k] = alpha_min_v;
+      return true;
+    });
+
+  for(const Type_of_alpha& alpha_min_v : alpha_min)
+    alpha_solid = (CGAL::max)(alpha_min_v, alpha_solid);
 
-    }
   return alpha_solid;
 }
 
 //-------------------------------------------------------------------------
 
-template < class Dt, class EACT >
+template < class Dt, class EACT, class CT >
 std::ostream&
-Alpha_shape_2<Dt,EACT>::op_ostream(std::ostream& os) const
+Alpha_shape_2<Dt,EACT,CT>::op_ostream(std::ostream& os) const
 {
-  typedef typename Alpha_shape_2<Dt,EACT>::Interval_vertex_map Interval_vertex_map ;
-  typedef typename Alpha_shape_2<Dt,EACT>::Interval_edge_map Interval_edge_map;
+  typedef typename Alpha_shape_2<Dt,EACT,CT>::Interval_vertex_map Interval_vertex_map ;
+  typedef typename Alpha_shape_2<Dt,EACT,CT>::Interval_edge_map Interval_edge_map;
 
   typename Interval_vertex_map::const_iterator vertex_alpha_it;
-  const typename Alpha_shape_2<Dt,EACT>::Interval2* pInterval2;
+  const typename Alpha_shape_2<Dt,EACT,CT>::Interval2* pInterval2;
   typename Interval_edge_map::const_iterator edge_alpha_it;
-  const typename Alpha_shape_2<Dt,EACT>::Interval3* pInterval;
+  const typename Alpha_shape_2<Dt,EACT,CT>::Interval3* pInterval;
 
   Unique_hash_map< Vertex_handle, size_type > V;
   size_type number_of_vertices = 0;
 
-  if (get_mode() == Alpha_shape_2<Dt,EACT>::REGULARIZED)
+  if (get_mode() == Alpha_shape_2<Dt,EACT,CT>::REGULARIZED)
   {
-    typename Alpha_shape_2<Dt,EACT>::Vertex_handle v;
+    typename Alpha_shape_2<Dt,EACT,CT>::Vertex_handle v;
     for (vertex_alpha_it = _interval_vertex_map.begin();
          vertex_alpha_it != _interval_vertex_map.end() &&
          (*vertex_alpha_it).first.first <= get_alpha();
@@ -1496,11 +1561,11 @@ Alpha_shape_2<Dt,EACT>::op_ostream(std::ostream& os) const
       pInterval2 = &(*vertex_alpha_it).first;
 
 #ifdef CGAL_DEBUG_ALPHA_SHAPE_2
-      typename Alpha_shape_2<Dt,EACT>::Type_of_alpha alpha =
+      typename Alpha_shape_2<Dt,EACT,CT>::Type_of_alpha alpha =
           get_alpha();
-      typename Alpha_shape_2<Dt,EACT>::Type_of_alpha alpha_mid =
+      typename Alpha_shape_2<Dt,EACT,CT>::Type_of_alpha alpha_mid =
           pInterval2->first;
-      typename Alpha_shape_2<Dt,EACT>::Type_of_alpha alpha_max =
+      typename Alpha_shape_2<Dt,EACT,CT>::Type_of_alpha alpha_max =
           pInterval2->second;
 #endif // CGAL_DEBUG_ALPHA_SHAPE_2
 
@@ -1514,7 +1579,7 @@ Alpha_shape_2<Dt,EACT>::op_ostream(std::ostream& os) const
 
         v = (*vertex_alpha_it).second;
         CGAL_assertion((classify(v) ==
-                                      Alpha_shape_2<Dt,EACT>::REGULAR));
+                                      Alpha_shape_2<Dt,EACT,CT>::REGULAR));
         // if we used Edelsbrunner and Muecke's definition
         // regular means incident to a higher-dimensional face
         // we would write too many vertices
@@ -1525,7 +1590,7 @@ Alpha_shape_2<Dt,EACT>::op_ostream(std::ostream& os) const
     }
     // the vertices are oriented counterclockwise
 
-    typename Alpha_shape_2<Dt,EACT>::Face_handle f;
+    typename Alpha_shape_2<Dt,EACT,CT>::Face_handle f;
     int i;
 
     for (edge_alpha_it = _interval_edge_map.begin();
@@ -1553,20 +1618,20 @@ Alpha_shape_2<Dt,EACT>::op_ostream(std::ostream& os) const
         i = (*edge_alpha_it).second.second;
 
         // assure that all vertices are in ccw order
-        if (classify(f) == Alpha_shape_2<Dt,EACT>::EXTERIOR)
+        if (classify(f) == Alpha_shape_2<Dt,EACT,CT>::EXTERIOR)
         {
           // take the reverse face
-          typename Alpha_shape_2<Dt,EACT>::Face_handle
+          typename Alpha_shape_2<Dt,EACT,CT>::Face_handle
               pNeighbor = f->neighbor(i);
           i = pNeighbor->index(f);
           f = pNeighbor;
         }
 
         CGAL_assertion((classify(f) ==
-                        Alpha_shape_2<Dt,EACT>::INTERIOR));
+                        Alpha_shape_2<Dt,EACT,CT>::INTERIOR));
 
         CGAL_assertion((classify(f, i) ==
-                        Alpha_shape_2<Dt,EACT>::REGULAR));
+                        Alpha_shape_2<Dt,EACT,CT>::REGULAR));
 
         os << V[f->vertex(f->ccw(i))] << ' '
                                       << V[f->vertex(f->cw(i))] << std::endl;
@@ -1575,7 +1640,7 @@ Alpha_shape_2<Dt,EACT>::op_ostream(std::ostream& os) const
   }
   else
   { // get_mode() == GENERAL -----------------------------------------
-    typename Alpha_shape_2<Dt,EACT>::Vertex_handle v;
+    typename Alpha_shape_2<Dt,EACT,CT>::Vertex_handle v;
 
     // write the regular vertices
     for (vertex_alpha_it = _interval_vertex_map.begin();
@@ -1594,7 +1659,7 @@ Alpha_shape_2<Dt,EACT>::op_ostream(std::ostream& os) const
         // write the vertex
 
         v = (*vertex_alpha_it).second;
-        CGAL_assertion((classify(v) == Alpha_shape_2<Dt,EACT>::REGULAR));
+        CGAL_assertion((classify(v) == Alpha_shape_2<Dt,EACT,CT>::REGULAR));
         V[v] = number_of_vertices++;
         os << v->point() << std::endl;
       }
@@ -1606,7 +1671,7 @@ Alpha_shape_2<Dt,EACT>::op_ostream(std::ostream& os) const
          ++vertex_alpha_it)
     {
       v = (*vertex_alpha_it).second;
-      CGAL_assertion((classify(v) == Alpha_shape_2<Dt,EACT>::SINGULAR));
+      CGAL_assertion((classify(v) == Alpha_shape_2<Dt,EACT,CT>::SINGULAR));
 
       V[v] = number_of_vertices++;
       os << v->point() << std::endl;
@@ -1614,7 +1679,7 @@ Alpha_shape_2<Dt,EACT>::op_ostream(std::ostream& os) const
 
     // the vertices are oriented counterclockwise
 
-    typename Alpha_shape_2<Dt,EACT>::Face_handle f;
+    typename Alpha_shape_2<Dt,EACT,CT>::Face_handle f;
     int i;
 
     for (edge_alpha_it = _interval_edge_map.begin();
@@ -1625,13 +1690,13 @@ Alpha_shape_2<Dt,EACT>::op_ostream(std::ostream& os) const
       pInterval = &(*edge_alpha_it).first;
 
 #ifdef CGAL_DEBUG_ALPHA_SHAPE_2
-      typename Alpha_shape_2<Dt,EACT>::Type_of_alpha alpha =
+      typename Alpha_shape_2<Dt,EACT,CT>::Type_of_alpha alpha =
           get_alpha();
-      typename Alpha_shape_2<Dt,EACT>::Type_of_alpha alpha_min =
+      typename Alpha_shape_2<Dt,EACT,CT>::Type_of_alpha alpha_min =
           pInterval->first;
-      typename Alpha_shape_2<Dt,EACT>::Type_of_alpha alpha_mid =
+      typename Alpha_shape_2<Dt,EACT,CT>::Type_of_alpha alpha_mid =
           pInterval->second;
-      typename Alpha_shape_2<Dt,EACT>::Type_of_alpha alpha_max =
+      typename Alpha_shape_2<Dt,EACT,CT>::Type_of_alpha alpha_max =
           pInterval->third;
 #endif // CGAL_DEBUG_ALPHA_SHAPE_2
 
@@ -1650,12 +1715,12 @@ Alpha_shape_2<Dt,EACT>::op_ostream(std::ostream& os) const
             pInterval->second <= get_alpha())
         {
           CGAL_assertion((classify(f, i) ==
-                                        Alpha_shape_2<Dt,EACT>::REGULAR));
+                                        Alpha_shape_2<Dt,EACT,CT>::REGULAR));
           // assure that all vertices are in ccw order
-          if (classify(f) == Alpha_shape_2<Dt,EACT>::EXTERIOR)
+          if (classify(f) == Alpha_shape_2<Dt,EACT,CT>::EXTERIOR)
           {
             // take the reverse face
-            typename Alpha_shape_2<Dt,EACT>::Face_handle
+            typename Alpha_shape_2<Dt,EACT,CT>::Face_handle
                 pNeighbor = f->neighbor(i);
 
             i = pNeighbor->index(f);
@@ -1663,7 +1728,7 @@ Alpha_shape_2<Dt,EACT>::op_ostream(std::ostream& os) const
           }
 
           CGAL_assertion((classify(f) ==
-                                        Alpha_shape_2<Dt,EACT>::INTERIOR));
+                                        Alpha_shape_2<Dt,EACT,CT>::INTERIOR));
 
           os << V[f->vertex(f->ccw(i))] << ' '
                                         << V[f->vertex(f->cw(i))] << std::endl;
@@ -1678,7 +1743,7 @@ Alpha_shape_2<Dt,EACT>::op_ostream(std::ostream& os) const
           if (pInterval->first != UNDEFINED)
           {
             CGAL_assertion((classify(f, i) ==
-                                          Alpha_shape_2<Dt,EACT>::SINGULAR));
+                                          Alpha_shape_2<Dt,EACT,CT>::SINGULAR));
             os << V[f->vertex(f->ccw(i))] << ' '
                                           << V[f->vertex(f->cw(i))] << std::endl;
           }
@@ -1700,9 +1765,9 @@ operator<<(std::ostream& os, const Alpha_shape_2<Dt>& A)
 
 //-------------------------------------------------------------------
 
-template < class Dt, class EACT >
-std::list<typename Alpha_shape_2<Dt,EACT>::Point_2>
-Alpha_shape_2<Dt,EACT>::Output ()
+template < class Dt, class EACT, class CT >
+std::list<typename Alpha_shape_2<Dt,EACT,CT>::Point_2>
+Alpha_shape_2<Dt,EACT,CT>::Output ()
 {
   typename Interval_edge_map::const_iterator edge_alpha_it;
 
@@ -1818,8 +1883,8 @@ Alpha_shape_2<Dt,EACT>::Output ()
   return L;
 }
 
-template < class Dt, class EACT >
-void Alpha_shape_2<Dt,EACT>::print_edge_map()
+template < class Dt, class EACT, class CT >
+void Alpha_shape_2<Dt,EACT,CT>::print_edge_map()
 {
   for (typename Interval_edge_map::iterator iemapit= _interval_edge_map.begin();
        iemapit != _interval_edge_map.end(); ++iemapit) {
@@ -0,0 +1,38 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_INTERNAL_ALPHA_SHAPE_2_CONCURRENCY_H
+#define CGAL_INTERNAL_ALPHA_SHAPE_2_CONCURRENCY_H
+
+#include <CGAL/license/Alpha_shapes_2.h>
+
+#include <CGAL/STL_Extension/internal/stable_sort_by_blocks.h>
+
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+namespace internal {
+
+// Stable sort of the pairs (interval, face) by interval, that is the order of
+// a `std::multimap` filled in the order of `intervals`.
+template <class ConcurrencyTag, class Interval, class Face>
+void sort_alpha_intervals(std::vector<std::pair<Interval, Face> >& intervals)
+{
+  typedef std::pair<Interval, Face> Value;
+
+  stable_sort_by_blocks<ConcurrencyTag>(intervals, [](const Value& a, const Value& b) { return a.first < b.first; });
+}
+
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_INTERNAL_ALPHA_SHAPE_2_CONCURRENCY_H
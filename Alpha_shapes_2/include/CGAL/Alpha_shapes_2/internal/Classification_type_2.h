@@ -0,0 +1,24 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_INTERNAL_CLASSIFICATION_TYPE_2_H
+#define CGAL_INTERNAL_CLASSIFICATION_TYPE_2_H
+
+#include <CGAL/license/Alpha_shapes_2.h>
+
+namespace CGAL {
+namespace internal {
+
+// scoped, so as not to clash with the enumerators of `Classification_type` used by `Fixed_alpha_shape_3`
+enum class Classification_type_2 : unsigned char { EXTERIOR, SINGULAR, REGULAR, INTERIOR };
+
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_INTERNAL_CLASSIFICATION_TYPE_2_H
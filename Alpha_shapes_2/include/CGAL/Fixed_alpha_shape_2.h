@@ -0,0 +1,331 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_FIXED_ALPHA_SHAPE_2_H
+#define CGAL_FIXED_ALPHA_SHAPE_2_H
+
+#include <CGAL/license/Alpha_shapes_2.h>
+
+#include <CGAL/Alpha_shapes_2/internal/Alpha_shape_2_concurrency.h>
+#include <CGAL/Alpha_shapes_2/internal/Classification_type_2.h>
+#include <CGAL/Alpha_shapes_2/internal/Lazy_alpha_nt_2.h>
+
+// for convenience only
+#include <CGAL/Fixed_alpha_shape_vertex_base_2.h>
+#include <CGAL/Fixed_alpha_shape_face_base_2.h>
+
+#include <CGAL/assertions.h>
+#include <CGAL/basic.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace CGAL {
+
+// The class Fixed_alpha_shape_2<Dt> represents the alpha shape of points
+// in the plane for a single value of alpha. Contrary to Alpha_shape_2,
+// neither the alpha intervals of the faces nor the spectrum of alpha values
+// are computed: each face of the triangulation only stores its classification.
+// With `Parallel_tag`, the classifications are computed in parallel.
+template < class Dt, class ConcurrencyTag = Sequential_tag >
+class Fixed_alpha_shape_2 : public Dt
+{
+public:
+  typedef Dt Triangulation;
+  typedef typename Dt::Geom_traits Gt;
+  typedef typename Dt::Triangulation_data_structure Tds;
+
+  typedef typename Gt::FT FT;
+  typedef typename Dt::Point Point;
+
+  typedef typename Dt::Face_handle Face_handle;
+  typedef typename Dt::Vertex_handle Vertex_handle;
+  typedef typename Dt::Edge Edge;
+
+  typedef typename Dt::Face_circulator Face_circulator;
+
+  typedef typename Dt::All_faces_iterator All_faces_iterator;
+  typedef typename Dt::Finite_faces_iterator Finite_faces_iterator;
+  typedef typename Dt::Finite_edges_iterator Finite_edges_iterator;
+  typedef typename Dt::Finite_vertices_iterator Finite_vertices_iterator;
+
+  typedef typename Dt::size_type size_type;
+
+  typedef internal::Classification_type_2 Classification_type;
+  static constexpr Classification_type EXTERIOR = Classification_type::EXTERIOR;
+  static constexpr Classification_type SINGULAR = Classification_type::SINGULAR;
+  static constexpr Classification_type REGULAR  = Classification_type::REGULAR;
+  static constexpr Classification_type INTERIOR = Classification_type::INTERIOR;
+
+  using Dt::cw;
+  using Dt::ccw;
+  using Dt::dimension;
+  using Dt::is_infinite;
+  using Dt::number_of_vertices;
+  using Dt::point;
+
+private:
+  // the squared radii are compared exactly to alpha, with a filtered lazy
+  // number type when the number type of the traits is a floating point type
+  typedef internal::Alpha_nt_selector_2<Gt, Tag_true, typename Dt::Weighted_tag> Alpha_nt_selector;
+  typedef typename Alpha_nt_selector::Type_of_alpha                          Type_of_alpha;
+  typedef typename Alpha_nt_selector::Compute_squared_radius_2               Compute_squared_radius_2;
+  typedef typename Alpha_nt_selector::Side_of_bounded_circle_2               Side_of_bounded_circle_2;
+
+  FT _alpha;
+  // the exact value of `_alpha` is known, so that comparing it from several threads is safe
+  Type_of_alpha _alpha_nt;
+
+public:
+
+  //------------------------- CONSTRUCTORS ------------------------------
+
+  Fixed_alpha_shape_2(FT alpha = FT(0))
+    : _alpha(alpha), _alpha_nt(alpha)
+  {}
+
+  template <class InputIterator>
+  Fixed_alpha_shape_2(const InputIterator& first,
+                      const InputIterator& last,
+                      const FT& alpha = FT(0))
+    : _alpha(alpha), _alpha_nt(alpha)
+  {
+    Dt::insert(first, last);
+    initialize_status();
+  }
+
+  // Builds the alpha shape from the triangulation `dt`, which is left empty.
+  Fixed_alpha_shape_2(Dt& dt, FT alpha = FT(0))
+    : _alpha(alpha), _alpha_nt(alpha)
+  {
+    Dt::swap(dt);
+    initialize_status();
+  }
+
+  //----------------------- OPERATIONS ---------------------------------
+
+  void clear()
+  {
+    Dt::clear();
+  }
+
+  const FT& get_alpha() const
+  {
+    return _alpha;
+  }
+
+  //--------------------- PREDICATES -----------------------------------
+
+  Classification_type classify(const Face_handle& f) const
+  {
+    return f->get_classification_type();
+  }
+
+  Classification_type classify(const Face_handle& f, int i) const
+  {
+    return f->get_edge_classification_type(i);
+  }
+
+  Classification_type classify(const Edge& e) const
+  {
+    return classify(e.first, e.second);
+  }
+
+  Classification_type classify(const Vertex_handle& v) const
+  {
+    return v->get_classification_type();
+  }
+
+  //--------------------- OUTPUT ---------------------------------------
+
+  template <class OutputIterator>
+  OutputIterator get_alpha_shape_faces(OutputIterator it,
+                                       Classification_type type) const
+  {
+    for(Finite_faces_iterator fit = this->finite_faces_begin(); fit != this->finite_faces_end(); ++fit)
+      if(classify(fit) == type) *it++ = Face_handle(fit);
+    return it;
+  }
+
+  template <class OutputIterator>
+  OutputIterator get_alpha_shape_edges(OutputIterator it,
+                                       Classification_type type) const
+  {
+    for(Finite_edges_iterator eit = this->finite_edges_begin(); eit != this->finite_edges_end(); ++eit)
+      if(classify(*eit) == type) *it++ = *eit;
+    return it;
+  }
+
+  template <class OutputIterator>
+  OutputIterator get_alpha_shape_vertices(OutputIterator it,
+                                          Classification_type type) const
+  {
+    for(Finite_vertices_iterator vit = this->finite_vertices_begin(); vit != this->finite_vertices_end(); ++vit)
+      if(classify(vit) == type) *it++ = Vertex_handle(vit);
+    return it;
+  }
+
+private:
+
+  // the dynamic version is not implemented
+  // deactivate the triangulation member functions
+  Vertex_handle insert(const Point& p);
+  void remove(Vertex_handle v);
+
+  //--------------------- INITIALIZATION -------------------------------
+
+  void initialize_status();
+
+  Classification_type compute_edge_status(const Face_handle& f, int i) const;
+
+  Classification_type compute_vertex_status(const Vertex_handle& v) const;
+
+  //-------------------- GEOMETRIC PRIMITIVES ----------------------------
+
+  bool is_attached(const Face_handle& f, int i) const
+  {
+    Bounded_side b = Side_of_bounded_circle_2()(*this)(point(f, cw(i)),
+                                                       point(f, ccw(i)),
+                                                       point(f, i));
+
+    return (b == ON_BOUNDED_SIDE);
+  }
+
+  Type_of_alpha squared_radius(const Face_handle& f) const
+  {
+    return Compute_squared_radius_2()(*this)(point(f, 0), point(f, 1), point(f, 2));
+  }
+
+  Type_of_alpha squared_radius(const Face_handle& f, int i) const
+  {
+    return Compute_squared_radius_2()(*this)(point(f, ccw(i)),
+                                             point(f, cw(i)));
+  }
+};
+
+//---------------------------------------------------------------------
+//----------------------- MEMBER FUNCTIONS -----------------------------
+//---------------------------------------------------------------------
+
+template < class Dt, class CT >
+void
+Fixed_alpha_shape_2<Dt,CT>::initialize_status()
+{
+  if (dimension() != 2)
+    return;
+
+  std::vector<Face_handle> faces;
+  faces.reserve(2 * number_of_vertices());
+  for(All_faces_iterator fit = this->all_faces_begin(); fit != this->all_faces_end(); ++fit)
+    faces.push_back(fit);
+
+  // a face belongs to the alpha complex if its circumscribing circle is small enough
+  CGAL::for_each<CT>(CGAL::make_counting_range<std::size_t>(0, faces.size()),
+    [&](std::size_t k) -> bool
+    {
+      faces[k]->set_classification_type(
+        (!is_infinite(faces[k]) && squared_radius(faces[k]) <= _alpha_nt) ? INTERIOR : EXTERIOR);
+      return true;
+    });
+
+  // the status of an edge is computed once, from the face with the smallest handle,
+  // and stored in both incident faces
+  CGAL::for_each<CT>(CGAL::make_counting_range<std::size_t>(0, faces.size()),
+    [&](std::size_t k) -> bool
+    {
+      const Face_handle& f = faces[k];
+      for(int i = 0; i < 3; ++i)
+        {
+          Face_handle n = f->neighbor(i);
+          if (n < f)
+            continue;
+
+          Classification_type status = compute_edge_status(f, i);
+          f->set_edge_classification_type(i, status);
+          n->set_edge_classification_type(n->index(f), status);
+        }
+      return true;
+    });
+
+  std::vector<Vertex_handle> vertices;
+  vertices.reserve(number_of_vertices());
+  for(Finite_vertices_iterator vit = this->finite_vertices_begin(); vit != this->finite_vertices_end(); ++vit)
+    vertices.push_back(vit);
+
+  CGAL::for_each<CT>(CGAL::make_counting_range<std::size_t>(0, vertices.size()),
+    [&](std::size_t k) -> bool
+    {
+      vertices[k]->set_classification_type(compute_vertex_status(vertices[k]));
+      return true;
+    });
+}
+
+//-------------------------------------------------------------------------
+
+template < class Dt, class CT >
+typename Fixed_alpha_shape_2<Dt,CT>::Classification_type
+Fixed_alpha_shape_2<Dt,CT>::compute_edge_status(const Face_handle& f, int i) const
+{
+  if (is_infinite(f, i))
+    return EXTERIOR;
+
+  Face_handle n = f->neighbor(i);
+  const bool f_interior = (classify(f) == INTERIOR);
+  const bool n_interior = (classify(n) == INTERIOR);
+
+  if (f_interior && n_interior)
+    return INTERIOR;
+  if (f_interior || n_interior)
+    return REGULAR;
+
+  // an edge not incident to a face of the alpha complex is singular
+  // if its smallest circumscribing circle is empty and small enough
+  if ((!is_infinite(f) && is_attached(f, i)) ||
+      (!is_infinite(n) && is_attached(n, n->index(f))))
+    return EXTERIOR;
+
+  return (squared_radius(f, i) <= _alpha_nt) ? SINGULAR : EXTERIOR;
+}
+
+//-------------------------------------------------------------------------
+
+template < class Dt, class CT >
+typename Fixed_alpha_shape_2<Dt,CT>::Classification_type
+Fixed_alpha_shape_2<Dt,CT>::compute_vertex_status(const Vertex_handle& v) const
+{
+  // as in Alpha_shape_2, a vertex is singular if it is not incident
+  // to a face of the alpha complex, and is never exterior
+  bool has_interior_face = false;
+  bool has_exterior_face = false;
+
+  Face_circulator face_circ = this->incident_faces(v),
+    done = face_circ;
+  if (!face_circ.is_empty())
+    {
+      do
+        {
+          if (classify(Face_handle(face_circ)) == INTERIOR)
+            has_interior_face = true;
+          else
+            has_exterior_face = true;
+        }
+      while(++face_circ != done);
+    }
+
+  if (!has_interior_face)
+    return SINGULAR;
+  return has_exterior_face ? REGULAR : INTERIOR;
+}
+
+} //namespace CGAL
+
+#endif //CGAL_FIXED_ALPHA_SHAPE_2_H
@@ -0,0 +1,61 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_FIXED_ALPHA_SHAPE_FACE_BASE_2_H
+#define CGAL_FIXED_ALPHA_SHAPE_FACE_BASE_2_H
+
+#include <CGAL/license/Alpha_shapes_2.h>
+
+
+#include <CGAL/Triangulation_face_base_2.h>
+#include <CGAL/Alpha_shapes_2/internal/Classification_type_2.h>
+
+namespace CGAL {
+
+template < class Gt, class Fb = Triangulation_face_base_2<Gt> >
+class Fixed_alpha_shape_face_base_2
+  : public Fb
+{
+public:
+  typedef typename Fb::Vertex_handle   Vertex_handle;
+  typedef typename Fb::Face_handle     Face_handle;
+
+  template < typename TDS2 >
+  struct Rebind_TDS {
+    typedef typename Fb::template Rebind_TDS<TDS2>::Other   Fb2;
+    typedef Fixed_alpha_shape_face_base_2<Gt, Fb2>          Other;
+  };
+
+private:
+  typedef internal::Classification_type_2 Classification_type;
+
+  Classification_type edge_status[3];
+  Classification_type status_;
+
+public:
+
+  Fixed_alpha_shape_face_base_2()
+    : Fb() {}
+
+  Fixed_alpha_shape_face_base_2(Vertex_handle v0, Vertex_handle v1, Vertex_handle v2)
+    : Fb(v0, v1, v2) {}
+
+  Fixed_alpha_shape_face_base_2(Vertex_handle v0, Vertex_handle v1, Vertex_handle v2,
+                                Face_handle n0, Face_handle n1, Face_handle n2)
+    : Fb(v0, v1, v2, n0, n1, n2) {}
+
+  Classification_type get_edge_classification_type(int i) const {return edge_status[i];}
+  void set_edge_classification_type(int i, Classification_type status) { edge_status[i]=status;  }
+  Classification_type get_classification_type() const { return status_;}
+  void set_classification_type(Classification_type status) {status_=status;}
+};
+
+} //namespace CGAL
+
+#endif // CGAL_FIXED_ALPHA_SHAPE_FACE_BASE_2_H
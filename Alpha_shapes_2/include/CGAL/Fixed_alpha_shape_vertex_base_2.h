@@ -0,0 +1,57 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_FIXED_ALPHA_SHAPE_VERTEX_BASE_2_H
+#define CGAL_FIXED_ALPHA_SHAPE_VERTEX_BASE_2_H
+
+#include <CGAL/license/Alpha_shapes_2.h>
+
+
+#include <CGAL/Triangulation_vertex_base_2.h>
+#include <CGAL/Alpha_shapes_2/internal/Classification_type_2.h>
+
+namespace CGAL {
+
+template <class Gt, class Vb = Triangulation_vertex_base_2<Gt> >
+class Fixed_alpha_shape_vertex_base_2
+  : public Vb
+{
+public:
+  typedef typename Vb::Face_handle    Face_handle;
+  typedef typename Vb::Point          Point;
+
+  template < typename TDS2 >
+  struct Rebind_TDS {
+    typedef typename Vb::template Rebind_TDS<TDS2>::Other   Vb2;
+    typedef Fixed_alpha_shape_vertex_base_2<Gt, Vb2>        Other;
+  };
+
+private:
+  typedef internal::Classification_type_2 Classification_type;
+
+  Classification_type status_;
+
+public:
+
+  Fixed_alpha_shape_vertex_base_2()
+    : Vb(), status_(Classification_type::EXTERIOR) {}
+
+  Fixed_alpha_shape_vertex_base_2(const Point& p)
+    : Vb(p), status_(Classification_type::EXTERIOR) {}
+
+  Fixed_alpha_shape_vertex_base_2(const Point& p, Face_handle f)
+    : Vb(p, f), status_(Classification_type::EXTERIOR) {}
+
+  Classification_type get_classification_type() const { return status_;}
+  void set_classification_type(Classification_type status) {status_=status;}
+};
+
+} //namespace CGAL
+
+#endif // CGAL_FIXED_ALPHA_SHAPE_VERTEX_BASE_2_H
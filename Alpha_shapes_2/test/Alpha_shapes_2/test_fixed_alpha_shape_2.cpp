@@ -0,0 +1,210 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Alpha_shape_2.h>
+#include <CGAL/Alpha_shape_face_base_2.h>
+#include <CGAL/Alpha_shape_vertex_base_2.h>
+#include <CGAL/Fixed_alpha_shape_2.h>
+#include <CGAL/Fixed_alpha_shape_face_base_2.h>
+#include <CGAL/Fixed_alpha_shape_vertex_base_2.h>
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Regular_triangulation_2.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_2                                          Point;
+typedef K::Weighted_point_2                                 Weighted_point;
+
+// Delaunay
+typedef CGAL::Alpha_shape_vertex_base_2<K>                  Vb;
+typedef CGAL::Alpha_shape_face_base_2<K>                    Fb;
+typedef CGAL::Triangulation_data_structure_2<Vb,Fb>         Tds;
+typedef CGAL::Delaunay_triangulation_2<K,Tds>               Dt;
+
+typedef CGAL::Fixed_alpha_shape_vertex_base_2<K>            Fixed_vb;
+typedef CGAL::Fixed_alpha_shape_face_base_2<K>              Fixed_fb;
+typedef CGAL::Triangulation_data_structure_2<Fixed_vb,Fixed_fb> Fixed_tds;
+typedef CGAL::Delaunay_triangulation_2<K,Fixed_tds>         Fixed_dt;
+
+// Regular
+typedef CGAL::Regular_triangulation_vertex_base_2<K>        Rvb;
+typedef CGAL::Regular_triangulation_face_base_2<K>          Rfb;
+typedef CGAL::Alpha_shape_vertex_base_2<K,Rvb>              Wvb;
+typedef CGAL::Alpha_shape_face_base_2<K,Rfb>                Wfb;
+typedef CGAL::Triangulation_data_structure_2<Wvb,Wfb>       Wtds;
+typedef CGAL::Regular_triangulation_2<K,Wtds>               Rt;
+
+typedef CGAL::Fixed_alpha_shape_vertex_base_2<K,Rvb>        Fixed_wvb;
+typedef CGAL::Fixed_alpha_shape_face_base_2<K,Rfb>          Fixed_wfb;
+typedef CGAL::Triangulation_data_structure_2<Fixed_wvb,Fixed_wfb> Fixed_wtds;
+typedef CGAL::Regular_triangulation_2<K,Fixed_wtds>         Fixed_rt;
+
+// The two triangulations may enumerate their faces in different orders, and compute
+// slightly different radii, so the classifications are compared away from the alpha values.
+template <class AS, class FAS>
+void compare_with_alpha_shape(const AS& as, const FAS& fas)
+{
+  const typename AS::FT alpha = fas.get_alpha();
+  assert(as.number_of_vertices() == fas.number_of_vertices());
+  assert(as.number_of_faces() == fas.number_of_faces());
+
+  for (int type = AS::EXTERIOR; type <= AS::INTERIOR; ++type)
+  {
+    std::size_t nb_faces = 0, nb_edges = 0, nb_vertices = 0;
+    for (typename AS::Finite_faces_iterator fit = as.finite_faces_begin(); fit != as.finite_faces_end(); ++fit)
+      if (as.classify(fit, alpha) == type) ++nb_faces;
+    for (typename AS::Finite_edges_iterator eit = as.finite_edges_begin(); eit != as.finite_edges_end(); ++eit)
+      if (as.classify(*eit, alpha) == type) ++nb_edges;
+    for (typename AS::Finite_vertices_iterator vit = as.finite_vertices_begin(); vit != as.finite_vertices_end(); ++vit)
+      if (as.classify(vit, alpha) == type) ++nb_vertices;
+
+    std::vector<typename FAS::Face_handle> faces;
+    std::vector<typename FAS::Edge> edges;
+    std::vector<typename FAS::Vertex_handle> vertices;
+    const typename FAS::Classification_type fixed_type = typename FAS::Classification_type(type);
+    fas.get_alpha_shape_faces(std::back_inserter(faces), fixed_type);
+    fas.get_alpha_shape_edges(std::back_inserter(edges), fixed_type);
+    fas.get_alpha_shape_vertices(std::back_inserter(vertices), fixed_type);
+    assert(faces.size() == nb_faces);
+    assert(edges.size() == nb_edges);
+    assert(vertices.size() == nb_vertices);
+
+    // the status of an edge is the same in its two incident faces
+    for (const typename FAS::Edge& e : edges)
+      assert(fas.classify(e.first->neighbor(e.second), e.first->neighbor(e.second)->index(e.first)) == fixed_type);
+  }
+}
+
+// the faces of both triangulations may list their vertices in different orders,
+// so the alpha values computed from them may differ by a rounding error
+bool close(double a, double b)
+{
+  return std::abs(a - b) <= 1e-12 * (std::max)(std::abs(a), std::abs(b));
+}
+
+template <class AS1, class AS2>
+void compare_alpha_shapes(AS1& as1, AS2& as2)
+{
+  assert(as1.number_of_alphas() == as2.number_of_alphas());
+  for (std::size_t i = 0; i < as1.number_of_alphas(); ++i)
+    assert(close(CGAL::to_double(as1.get_nth_alpha(int(i))), CGAL::to_double(as2.get_nth_alpha(int(i)))));
+  assert(close(CGAL::to_double(as1.find_alpha_solid()), CGAL::to_double(as2.find_alpha_solid())));
+  assert(close(CGAL::to_double(*as1.find_optimal_alpha(1)), CGAL::to_double(*as2.find_optimal_alpha(1))));
+
+  // the alpha shapes are compared at values between two consecutive alpha values
+  for (std::size_t i = 1; i + 1 < as1.number_of_alphas(); i += as1.number_of_alphas() / 7 + 1)
+  {
+    const typename AS1::FT alpha = (as1.get_nth_alpha(int(i)) + as1.get_nth_alpha(int(i + 1))) / 2;
+    for (int mode = 0; mode < 2; ++mode)
+    {
+      as1.set_mode(mode == 0 ? AS1::GENERAL : AS1::REGULARIZED);
+      as2.set_mode(mode == 0 ? AS2::GENERAL : AS2::REGULARIZED);
+      as1.set_alpha(alpha);
+      as2.set_alpha(alpha);
+      assert(std::distance(as1.alpha_shape_vertices_begin(), as1.alpha_shape_vertices_end()) ==
+             std::distance(as2.alpha_shape_vertices_begin(), as2.alpha_shape_vertices_end()));
+      assert(std::distance(as1.alpha_shape_edges_begin(), as1.alpha_shape_edges_end()) ==
+             std::distance(as2.alpha_shape_edges_begin(), as2.alpha_shape_edges_end()));
+    }
+  }
+}
+
+template <class ConcurrencyTag>
+void test_delaunay(const std::vector<Point>& points)
+{
+  typedef CGAL::Alpha_shape_2<Dt>                                 Sequential_alpha_shape;
+  typedef CGAL::Alpha_shape_2<Dt, CGAL::Tag_false, ConcurrencyTag> Alpha_shape;
+  typedef CGAL::Fixed_alpha_shape_2<Fixed_dt, ConcurrencyTag>      Fixed_alpha_shape;
+
+  Sequential_alpha_shape sequential_as(points.begin(), points.end());
+  Alpha_shape as(points.begin(), points.end());
+  compare_alpha_shapes(sequential_as, as);
+
+  // the classification of a fixed alpha shape is the one of the general mode
+  as.set_mode(Alpha_shape::GENERAL);
+  for (std::size_t i = 1; i + 1 < as.number_of_alphas(); i += as.number_of_alphas() / 5 + 1)
+  {
+    Fixed_alpha_shape fas(points.begin(), points.end(), (as.get_nth_alpha(i) + as.get_nth_alpha(i + 1)) / 2);
+    compare_with_alpha_shape(as, fas);
+  }
+
+  // the alpha shape of a triangulation
+  Fixed_dt dt(points.begin(), points.end());
+  const std::size_t n = as.number_of_alphas() / 2;
+  Fixed_alpha_shape fas(dt, (as.get_nth_alpha(n) + as.get_nth_alpha(n + 1)) / 2);
+  assert(dt.number_of_vertices() == 0);
+  compare_with_alpha_shape(as, fas);
+}
+
+template <class ConcurrencyTag>
+void test_regular(const std::vector<Weighted_point>& points)
+{
+  typedef CGAL::Alpha_shape_2<Rt>                                 Sequential_alpha_shape;
+  typedef CGAL::Alpha_shape_2<Rt, CGAL::Tag_false, ConcurrencyTag> Alpha_shape;
+  typedef CGAL::Fixed_alpha_shape_2<Fixed_rt, ConcurrencyTag>      Fixed_alpha_shape;
+
+  Sequential_alpha_shape sequential_as(points.begin(), points.end());
+  Alpha_shape as(points.begin(), points.end());
+  compare_alpha_shapes(sequential_as, as);
+
+  // the classification of a fixed alpha shape is the one of the general mode
+  as.set_mode(Alpha_shape::GENERAL);
+  for (std::size_t i = 1; i + 1 < as.number_of_alphas(); i += as.number_of_alphas() / 5 + 1)
+  {
+    Fixed_alpha_shape fas(points.begin(), points.end(), (as.get_nth_alpha(i) + as.get_nth_alpha(i + 1)) / 2);
+    compare_with_alpha_shape(as, fas);
+  }
+}
+
+// alpha is the rounded squared radius of faces, so that some radii are very close
+// to alpha: the classification must be the one of the exact alpha shape
+void test_exact_comparison(const std::vector<Point>& points)
+{
+  typedef CGAL::Alpha_shape_vertex_base_2<K, CGAL::Default, CGAL::Tag_true>  Exact_vb;
+  typedef CGAL::Alpha_shape_face_base_2<K, CGAL::Default, CGAL::Tag_true>    Exact_fb;
+  typedef CGAL::Triangulation_data_structure_2<Exact_vb, Exact_fb>           Exact_tds;
+  typedef CGAL::Delaunay_triangulation_2<K, Exact_tds>                       Exact_dt;
+  typedef CGAL::Alpha_shape_2<Exact_dt, CGAL::Tag_true>                      Exact_alpha_shape;
+  typedef CGAL::Fixed_alpha_shape_2<Fixed_dt>                                Fixed_alpha_shape;
+
+  Exact_alpha_shape as(points.begin(), points.end());
+  as.set_mode(Exact_alpha_shape::GENERAL);
+  for (std::size_t i = 0; i < as.number_of_alphas(); i += as.number_of_alphas() / 11 + 1)
+  {
+    Fixed_alpha_shape fas(points.begin(), points.end(), CGAL::to_double(as.get_nth_alpha(i)));
+    compare_with_alpha_shape(as, fas);
+  }
+}
+
+int main()
+{
+  CGAL::Random random(42);
+  CGAL::Random_points_in_disc_2<Point> gen(1.0, random);
+  std::vector<Point> points;
+  std::copy_n(gen, 20000, std::back_inserter(points));
+
+  std::vector<Weighted_point> weighted_points;
+  for (std::size_t i = 0; i < 2000; ++i)
+    weighted_points.push_back(Weighted_point(points[i], random.get_double(0, 0.001)));
+
+  std::cout << "Testing Fixed_alpha_shape_2" << std::endl;
+  test_delaunay<CGAL::Sequential_tag>(points);
+  test_regular<CGAL::Sequential_tag>(weighted_points);
+  test_exact_comparison(std::vector<Point>(points.begin(), points.begin() + 500));
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Testing parallel Alpha_shape_2 and Fixed_alpha_shape_2" << std::endl;
+  test_delaunay<CGAL::Parallel_tag>(points);
+  test_regular<CGAL::Parallel_tag>(weighted_points);
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
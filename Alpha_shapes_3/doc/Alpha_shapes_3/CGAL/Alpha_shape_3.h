@@ -79,6 +79,13 @@ linear in the number of cells of the underlying triangulation.
 `Alpha_shape_3::find_optimal_alpha()` uses binary search and takes time
 \cgalBigO{n \log n}, where \f$ n\f$ is the number of points.
 
+When `Dt` is a `Delaunay_triangulation_3` or a `Regular_triangulation_3` whose triangulation
+data structure is parametrized by `Parallel_tag`, and \ref thirdpartyTBB is available and linked,
+the alpha values and the classifications of the faces are computed in parallel at initialization,
+and so are the classifications done by the functions `get_alpha_shape_cells()`,
+`get_alpha_shape_facets()`, `get_alpha_shape_edges()`, and `get_alpha_shape_vertices()`.
+The alpha values are sorted in parallel as well.
+
 */
 template< typename Dt, typename ExactAlphaComparisonTag >
 class Alpha_shape_3 : public Dt {
@@ -31,6 +31,12 @@ The I/O operators are defined for `iostream`, and for
 the window stream provided by \cgal. The format for the iostream
 is an internal format.
 
+\cgalHeading{Implementation}
+
+When `Dt` is a `Delaunay_triangulation_3` or a `Regular_triangulation_3` whose triangulation
+data structure is parametrized by `Parallel_tag`, and \ref thirdpartyTBB is available and linked,
+the classifications of the cells, facets, and edges are computed in parallel at initialization.
+
 */
 template< typename Dt >
 class Fixed_alpha_shape_3 : public Dt {
@@ -17,6 +17,7 @@
 #include <CGAL/license/Alpha_shapes_3.h>
 
 #include <CGAL/Alpha_shapes_3/internal/Lazy_alpha_nt_3.h>
+#include <CGAL/Alpha_shapes_3/internal/Alpha_shape_3_concurrency.h>
 #include <CGAL/Alpha_shape_cell_base_3.h> // for Alpha_status
 
 #include <CGAL/basic.h>
@@ -209,6 +210,13 @@ public:
 private:
   typedef Unique_hash_map<Cell_handle, bool > Marked_cell_set;
 
+  // the initialization and the extraction of the faces are parallel when the triangulation is
+  typedef typename internal::Alpha_shape_3_concurrency_tag<Dt>::type Alpha_concurrency_tag;
+  static constexpr bool is_parallel_alpha =
+    std::is_convertible<Alpha_concurrency_tag, Parallel_tag>::value;
+
+  typedef std::pair<NT, std::size_t> Alpha_key;
+
 private:
   NT _alpha;
   NT _alpha_solid;
@@ -318,6 +326,53 @@ private :
                                    e.first->vertex(e.third));
   }
 
+  // the incidence functions of the triangulation mark the visited cells,
+  // the thread-safe versions are used when the initialization is parallel
+  template <class OutputIterator>
+  void incident_cells_of_vertex(Vertex_handle v, OutputIterator cells) const {
+    if constexpr (is_parallel_alpha)
+      this->incident_cells_threadsafe(v, cells);
+    else
+      incident_cells(v, cells);
+  }
+
+  template <class OutputIterator>
+  void incident_vertices_of_vertex(Vertex_handle v, OutputIterator vertices) const {
+    if constexpr (is_parallel_alpha)
+      this->adjacent_vertices_threadsafe(v, vertices);
+    else
+      incident_vertices(v, vertices);
+  }
+
+  std::vector<Facet> finite_facets_vector() const {
+    std::vector<Facet> facets;
+    facets.reserve(this->number_of_finite_facets());
+    for (Finite_facets_iterator fit = finite_facets_begin(); fit != finite_facets_end(); ++fit)
+      facets.push_back(*fit);
+    return facets;
+  }
+
+  // Outputs the elements of `elements` whose classification for `alpha` is `type`,
+  // in the order of `elements`. The classification is done in parallel if enabled.
+  template <class Element, class OutputIterator>
+  OutputIterator copy_classified(const std::vector<Element>& elements,
+                                 OutputIterator it,
+                                 Classification_type type,
+                                 const NT& alpha) const
+  {
+    std::vector<unsigned char> selected(elements.size());
+    CGAL::for_each<Alpha_concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, elements.size()),
+      [&](std::size_t i) -> bool {
+        // each element is compared with its own copy of alpha, which may store its exact value
+        const NT element_alpha = alpha;
+        selected[i] = (classify(elements[i], element_alpha) == type);
+        return true;
+      });
+    for (std::size_t i = 0; i < elements.size(); ++i)
+      if (selected[i]) *it++ = elements[i];
+    return it;
+  }
+
  // the version to be used with Tag_true is templated to avoid
  // instantiation through explicit instantiation of the whole class
   void set_alpha_min_of_vertices(Tag_false)
@@ -798,6 +853,13 @@ public:
                                        Classification_type type,
                                        const NT& alpha) const
   {
+    if constexpr (is_parallel_alpha) {
+      std::vector<Cell_handle> cells;
+      cells.reserve(this->number_of_finite_cells());
+      for (Finite_cells_iterator cit = finite_cells_begin(); cit != finite_cells_end(); ++cit)
+        cells.push_back(cit);
+      return copy_classified(cells, it, type, alpha);
+    }
     Finite_cells_iterator cit = finite_cells_begin();
     for( ; cit != finite_cells_end() ; ++cit){
       if (classify(cit, alpha) == type) *it++ = Cell_handle(cit);
@@ -810,6 +872,8 @@ public:
                                         Classification_type type,
                                         const NT& alpha) const
   {
+    if constexpr (is_parallel_alpha)
+      return copy_classified(finite_facets_vector(), it, type, alpha);
     Finite_facets_iterator fit = finite_facets_begin();
     for( ; fit != finite_facets_end() ; ++fit){
       if (classify(*fit, alpha) == type) *it++ = *fit;
@@ -822,6 +886,10 @@ public:
                                        Classification_type type,
                                        const NT& alpha) const
   {
+    if constexpr (is_parallel_alpha) {
+      std::vector<Edge> edges(finite_edges_begin(), finite_edges_end());
+      return copy_classified(edges, it, type, alpha);
+    }
     Finite_edges_iterator eit = finite_edges_begin();
     for( ; eit != finite_edges_end() ; ++eit){
       if (classify(*eit, alpha) == type) *it++ = *eit;
@@ -834,6 +902,13 @@ public:
                                            Classification_type type,
                                            const NT& alpha) const
   {
+    if constexpr (is_parallel_alpha) {
+      std::vector<Vertex_handle> vertices;
+      vertices.reserve(this->number_of_vertices());
+      for (Finite_vertices_iterator vit = finite_vertices_begin(); vit != finite_vertices_end(); ++vit)
+        vertices.push_back(vit);
+      return copy_classified(vertices, it, type, alpha);
+    }
     Finite_vertices_iterator vit = finite_vertices_begin();
     for( ; vit != finite_vertices_end() ; ++vit){
       if (classify(vit, alpha) == type) *it++ = Vertex_handle(vit);
@@ -1140,17 +1215,24 @@ template <class Dt,class EACT>
 void
 Alpha_shape_3<Dt,EACT>::initialize_alpha_cell_map()
 {
-  Finite_cells_iterator cell_it, done = finite_cells_end();
-  NT alpha ;
-
-  for( cell_it = finite_cells_begin(); cell_it != done; ++cell_it) {
-    alpha = squared_radius(cell_it);
-    alpha_cell_map.insert(typename Alpha_cell_map::value_type(alpha, cell_it));
-
-    // cross references
-    cell_it->set_alpha(alpha);
-  }
-  return;
+  std::vector<Cell_handle> cells;
+  cells.reserve(this->number_of_finite_cells());
+  for (Finite_cells_iterator cell_it = finite_cells_begin(); cell_it != finite_cells_end(); ++cell_it)
+    cells.push_back(cell_it);
+
+  std::vector<Alpha_key> keys(cells.size());
+  CGAL::for_each<Alpha_concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, cells.size()),
+    [&](std::size_t i) -> bool {
+      NT alpha = squared_radius(cells[i]);
+      keys[i] = Alpha_key(alpha, i);
+
+      // cross references
+      cells[i]->set_alpha(alpha);
+      return true;
+    });
+
+  internal::sort_alpha_keys<Alpha_concurrency_tag>(keys);
+  internal::fill_alpha_map(alpha_cell_map, keys, cells);
 }
 
 
@@ -1160,73 +1242,93 @@ template <class Dt,class EACT>
 void
 Alpha_shape_3<Dt,EACT>::initialize_alpha_facet_maps(bool reinitialize)
 {
-  Finite_facets_iterator fit;
-  Cell_handle pCell, pNeighbor ;
-  int i, iNeigh;
-  Alpha_status_iterator as;
+  const bool compute_alpha_min = (get_mode() == GENERAL && alpha_min_facet_map.empty());
+  if (reinitialize && !compute_alpha_min)
+    return;
+
+  const std::vector<Facet> facets = finite_facets_vector();
 
   if (!reinitialize) {
-    NT alpha_max, alpha_mid;
-    for( fit = finite_facets_begin();
-         fit != finite_facets_end(); ++fit)   {
-
-      as = alpha_status_container.insert(Alpha_status());
-
-      pCell = fit->first;
-      i = fit->second;
-      pNeighbor = pCell->neighbor(i);
-      iNeigh = pNeighbor->index(pCell);
-
-      // not on the convex hull
-      if(!is_infinite(pCell) && !is_infinite(pNeighbor))        {
-        NT alpha_Cell = pCell->get_alpha();
-        NT alpha_Neighbor = pNeighbor->get_alpha();
-        if ( alpha_Cell < alpha_Neighbor) {
-          alpha_mid = alpha_Cell;
-          alpha_max = alpha_Neighbor;
+    // the statuses are created sequentially, and filled in parallel
+    std::vector<Alpha_status_iterator> statuses;
+    statuses.reserve(facets.size());
+    for (std::size_t f = 0; f < facets.size(); ++f)
+      statuses.push_back(alpha_status_container.insert(Alpha_status()));
+
+    CGAL::for_each<Alpha_concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, facets.size()),
+      [&](std::size_t f) -> bool {
+        NT alpha_max, alpha_mid;
+        Alpha_status_iterator as = statuses[f];
+
+        Cell_handle pCell = facets[f].first;
+        int i = facets[f].second;
+        Cell_handle pNeighbor = pCell->neighbor(i);
+        int iNeigh = pNeighbor->index(pCell);
+
+        // not on the convex hull
+        if(!is_infinite(pCell) && !is_infinite(pNeighbor))        {
+          NT alpha_Cell = pCell->get_alpha();
+          NT alpha_Neighbor = pNeighbor->get_alpha();
+          if ( alpha_Cell < alpha_Neighbor) {
+            alpha_mid = alpha_Cell;
+            alpha_max = alpha_Neighbor;
+          }
+          else {
+            alpha_mid = alpha_Neighbor;
+            alpha_max = alpha_Cell;
+          }
+          as->set_is_on_chull(false);
+          as->set_alpha_mid(alpha_mid);
+          as->set_alpha_max(alpha_max);
+          //        alpha_mid_facet_map.insert(typename
+          //                         Alpha_facet_map::value_type(alpha_mid, *fit));
         }
-        else {
-          alpha_mid = alpha_Neighbor;
-          alpha_max = alpha_Cell;
+        else { // on the convex hull
+          alpha_mid = !is_infinite(pCell) ? pCell->get_alpha()
+                                          : pNeighbor->get_alpha();
+          as->set_alpha_mid(alpha_mid);
+          as->set_is_on_chull(true);
         }
-        as->set_is_on_chull(false);
-        as->set_alpha_mid(alpha_mid);
-        as->set_alpha_max(alpha_max);
-        //        alpha_mid_facet_map.insert(typename
-        //                         Alpha_facet_map::value_type(alpha_mid, *fit));
-      }
-      else { // on the convex hull
-        alpha_mid = !is_infinite(pCell) ? pCell->get_alpha()
-                                        : pNeighbor->get_alpha();
-        as->set_alpha_mid(alpha_mid);
-        as->set_is_on_chull(true);
-      }
 
-      //cross links
-      pCell->set_facet_status(i, as);
-      pNeighbor->set_facet_status(iNeigh,as);
-    }
+        //cross links (each facet of a cell is written by a single facet)
+        pCell->set_facet_status(i, as);
+        pNeighbor->set_facet_status(iNeigh,as);
+        return true;
+      });
   }
 
   // initialize alpha_min if mode GENERAL
-  if(get_mode() == GENERAL &&  alpha_min_facet_map.empty()) {
+  if(compute_alpha_min) {
     //already done if !alpha_min_facet_map.empty()
-    NT alpha_min;
-    for( fit = finite_facets_begin();
-         fit != finite_facets_end(); ++fit)   {
-      as = fit->first->get_facet_status(fit->second);
-      if (is_Gabriel(*fit)) {
-        as->set_is_Gabriel(true);
-        alpha_min = squared_radius(*fit);
-        as->set_alpha_min(alpha_min);
-        alpha_min_facet_map.insert(typename
-                                 Alpha_facet_map::value_type(alpha_min, *fit));
-      }
-      else{
-        as->set_is_Gabriel(false);
-        as->set_alpha_min(as->alpha_mid());
+    std::vector<Alpha_key> keys(facets.size());
+    std::vector<unsigned char> is_gabriel(facets.size());
+    CGAL::for_each<Alpha_concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, facets.size()),
+      [&](std::size_t f) -> bool {
+        Alpha_status_iterator as = facets[f].first->get_facet_status(facets[f].second);
+        is_gabriel[f] = is_Gabriel(facets[f]);
+        if (is_gabriel[f]) {
+          NT alpha_min = squared_radius(facets[f]);
+          as->set_is_Gabriel(true);
+          as->set_alpha_min(alpha_min);
+          keys[f] = Alpha_key(alpha_min, f);
+        }
+        else{
+          as->set_is_Gabriel(false);
+          as->set_alpha_min(as->alpha_mid());
+        }
+        return true;
+      });
+
+    std::size_t nb_gabriel = 0;
+    for (std::size_t f = 0; f < facets.size(); ++f)
+      if (is_gabriel[f]) {
+        if (nb_gabriel != f) keys[nb_gabriel] = std::move(keys[f]);
+        ++nb_gabriel;
       }
-    }
+    keys.resize(nb_gabriel);
+
+    internal::sort_alpha_keys<Alpha_concurrency_tag>(keys);
+    internal::fill_alpha_map(alpha_min_facet_map, keys, facets);
   }
   return;
  }
@@ -1241,24 +1343,41 @@ Alpha_shape_3<Dt,EACT>::initialize_alpha_edge_maps(bool )
   if(get_mode() == REGULARIZED) {return;} //no_edge_map in REGULARIZED mode
   if ( !edge_alpha_map.empty()) return; // already done
 
-  Finite_edges_iterator eit;
-  Alpha_status_iterator as;
-
-  for (eit = finite_edges_begin();
-       eit != finite_edges_end(); ++eit) {
-    as = alpha_status_container.insert(Alpha_status());
-    compute_edge_status(eit->first, eit->second, eit->third, *as);
-    if ( as->is_Gabriel()) {
-      alpha_min_edge_map.insert(typename
-                                Alpha_edge_map::value_type(as->alpha_min(),
-                                                           *eit));
+  std::vector<Edge> edges(finite_edges_begin(), finite_edges_end());
+
+  // the statuses are created sequentially, and computed in parallel
+  std::vector<Alpha_status_iterator> statuses;
+  statuses.reserve(edges.size());
+  for (std::size_t e = 0; e < edges.size(); ++e)
+    statuses.push_back(alpha_status_container.insert(Alpha_status()));
+
+  std::vector<Alpha_key> keys(edges.size());
+  std::vector<std::pair<Vertex_handle_pair, std::size_t> > vertex_pairs(edges.size());
+  CGAL::for_each<Alpha_concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, edges.size()),
+    [&](std::size_t e) -> bool {
+      Alpha_status_iterator as = statuses[e];
+      compute_edge_status(edges[e].first, edges[e].second, edges[e].third, *as);
+      if ( as->is_Gabriel())
+        keys[e] = Alpha_key(as->alpha_min(), e);
+      vertex_pairs[e] = std::make_pair(make_vertex_handle_pair(edges[e]), e);
+      return true;
+    });
+
+  std::size_t nb_gabriel = 0;
+  for (std::size_t e = 0; e < edges.size(); ++e) {
+    if (statuses[e]->is_Gabriel()) {
+      if (nb_gabriel != e) keys[nb_gabriel] = std::move(keys[e]);
+      ++nb_gabriel;
     }
-     //cross links
-    Vertex_handle_pair
-      vhp = make_vertex_handle_pair( eit->first->vertex(eit->second),
-                                     eit->first->vertex(eit->third));
-    edge_alpha_map.insert(std::make_pair(vhp, as));
   }
+  keys.resize(nb_gabriel);
+  internal::sort_alpha_keys<Alpha_concurrency_tag>(keys);
+  internal::fill_alpha_map(alpha_min_edge_map, keys, edges);
+
+  //cross links, inserted in the order of the map
+  internal::alpha_shape_3_sort<Alpha_concurrency_tag>(vertex_pairs.begin(), vertex_pairs.end());
+  for (const std::pair<Vertex_handle_pair, std::size_t>& vp : vertex_pairs)
+    edge_alpha_map.emplace_hint(edge_alpha_map.end(), vp.first, statuses[vp.second]);
   return;
 }
 
@@ -1273,75 +1392,85 @@ Alpha_shape_3<Dt,EACT>::initialize_alpha_vertex_maps(bool reinitialize)
   // alpha_min = -squared_radius of weighted point,
   //              if the vertex is Gabriel set only in GENERAL mode
 
-  NT alpha, alpha_mid;
-  Finite_vertices_iterator vit;
-
-  if (reinitialize == false) _alpha_solid = alpha_cell_map.begin()->first;
-
-  for( vit = finite_vertices_begin();
-         vit != finite_vertices_end();         ++vit) {
-    Alpha_status*  as = vit->get_alpha_status();
-
-    if (reinitialize == false) {
-      // set is_on_chull, compute alpha_max
-      // and alpha_mid (version REGULAR)
-      // compute _alpha_solid (max of alpha_mid of vertices in REGULAR mode)
-      as->set_is_on_chull(false);
-      std::list<Cell_handle> incidents;
-      incident_cells(static_cast<Vertex_handle>(vit),
-                     back_inserter(incidents));
-      typename std::list<Cell_handle>::iterator chit=incidents.begin();
-      if (is_infinite(*chit)) as->set_is_on_chull(true);
-      while (is_infinite(*chit)) ++chit; //skip infinite cells
-      alpha = (*chit)->get_alpha();
-      as->set_alpha_mid(alpha);
-      as->set_alpha_max(alpha);
-      ++chit;
-      for( ; chit != incidents.end(); ++chit) {
+  std::vector<Vertex_handle> vertices;
+  vertices.reserve(this->number_of_vertices());
+  for (Finite_vertices_iterator vit = finite_vertices_begin(); vit != finite_vertices_end(); ++vit)
+    vertices.push_back(vit);
+
+  // alpha_mid of the vertices in REGULAR mode, to compute _alpha_solid
+  std::vector<NT> regular_alpha_mid(reinitialize ? 0 : vertices.size());
+
+  CGAL::for_each<Alpha_concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, vertices.size()),
+    [&](std::size_t vi) -> bool {
+      std::vector<Cell_handle> incidents;
+      std::vector<Vertex_handle> incidentv;
+      NT alpha, alpha_mid;
+      Vertex_handle vit = vertices[vi];
+      Alpha_status*  as = vit->get_alpha_status();
+
+      if (reinitialize == false) {
+        // set is_on_chull, compute alpha_max
+        // and alpha_mid (version REGULAR)
+        as->set_is_on_chull(false);
+        incidents.clear();
+        incident_cells_of_vertex(vit, back_inserter(incidents));
+        typename std::vector<Cell_handle>::iterator chit=incidents.begin();
         if (is_infinite(*chit)) as->set_is_on_chull(true);
-        else {
-          alpha = (*chit)->get_alpha();
-          if (alpha < as->alpha_mid()) as->set_alpha_mid(alpha);
-          if (alpha > as->alpha_max()) as->set_alpha_max(alpha);
+        while (is_infinite(*chit)) ++chit; //skip infinite cells
+        alpha = (*chit)->get_alpha();
+        as->set_alpha_mid(alpha);
+        as->set_alpha_max(alpha);
+        ++chit;
+        for( ; chit != incidents.end(); ++chit) {
+          if (is_infinite(*chit)) as->set_is_on_chull(true);
+          else {
+            alpha = (*chit)->get_alpha();
+            if (alpha < as->alpha_mid()) as->set_alpha_mid(alpha);
+            if (alpha > as->alpha_max()) as->set_alpha_max(alpha);
+          }
         }
+        regular_alpha_mid[vi] = as->alpha_mid();
       }
-      if (as->alpha_mid() > _alpha_solid)  _alpha_solid = as->alpha_mid();
-    }
 
-    if (get_mode() == GENERAL) { //reset alpha_mid,  set alph_min
-      std::list<Vertex_handle> incidentv;
-      incident_vertices(static_cast<Vertex_handle>(vit),
-                        back_inserter(incidentv));
-      typename std::list<Vertex_handle>::iterator vvit=incidentv.begin();
-      for( ; vvit != incidentv.end(); ++vvit) {
-        if (!is_infinite(*vvit)) {
-          Vertex_handle_pair vhp = make_vertex_handle_pair( *vvit, vit);
-          Alpha_status_iterator asedge = edge_alpha_map[vhp];
-          alpha_mid = asedge->is_Gabriel() ? asedge->alpha_min()
-            : asedge->alpha_mid();
-          if ( alpha_mid < as->alpha_mid()) as->set_alpha_mid(alpha_mid);
+      if (get_mode() == GENERAL) { //reset alpha_mid,  set alph_min
+        incidentv.clear();
+        incident_vertices_of_vertex(vit, back_inserter(incidentv));
+        typename std::vector<Vertex_handle>::iterator vvit=incidentv.begin();
+        for( ; vvit != incidentv.end(); ++vvit) {
+          if (!is_infinite(*vvit)) {
+            Vertex_handle_pair vhp = make_vertex_handle_pair( *vvit, vit);
+            Alpha_status_iterator asedge = edge_alpha_map.find(vhp)->second;
+            alpha_mid = asedge->is_Gabriel() ? asedge->alpha_min()
+              : asedge->alpha_mid();
+            if ( alpha_mid < as->alpha_mid()) as->set_alpha_mid(alpha_mid);
+          }
         }
       }
-    }
 
-    if (get_mode()== REGULARIZED && reinitialize == true) {
-      // reset alpha_mid
-      std::list<Cell_handle> incidents;
-      incident_cells(static_cast<Vertex_handle>(vit),
-                     back_inserter(incidents));
-      typename std::list<Cell_handle>::iterator chit=incidents.begin();
-      while (is_infinite(*chit)) ++chit; //skip infinite cells
-      alpha = (*chit)->get_alpha();
-      as->set_alpha_mid(alpha);
-      for( ; chit != incidents.end(); ++chit) {
-        if (is_infinite(*chit)) as->set_is_on_chull(true);
-        else {
-          alpha = (*chit)->get_alpha();
-          if (alpha < as->alpha_mid()) as->set_alpha_mid(alpha);
+      if (get_mode()== REGULARIZED && reinitialize == true) {
+        // reset alpha_mid
+        incidents.clear();
+        incident_cells_of_vertex(vit, back_inserter(incidents));
+        typename std::vector<Cell_handle>::iterator chit=incidents.begin();
+        while (is_infinite(*chit)) ++chit; //skip infinite cells
+        alpha = (*chit)->get_alpha();
+        as->set_alpha_mid(alpha);
+        for( ; chit != incidents.end(); ++chit) {
+          if (is_infinite(*chit)) as->set_is_on_chull(true);
+          else {
+            alpha = (*chit)->get_alpha();
+            if (alpha < as->alpha_mid()) as->set_alpha_mid(alpha);
+          }
         }
       }
-    }
-
+      return true;
+    });
+
+  // compute _alpha_solid (max of alpha_mid of vertices in REGULAR mode)
+  if (reinitialize == false) {
+    _alpha_solid = alpha_cell_map.begin()->first;
+    for (const NT& alpha_mid : regular_alpha_mid)
+      if (alpha_mid > _alpha_solid)  _alpha_solid = alpha_mid;
   }
 
   // set alpha_min in case GENERAL
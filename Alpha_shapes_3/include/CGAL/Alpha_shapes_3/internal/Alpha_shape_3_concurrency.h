@@ -0,0 +1,91 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_INTERNAL_ALPHA_SHAPE_3_CONCURRENCY_H
+#define CGAL_INTERNAL_ALPHA_SHAPE_3_CONCURRENCY_H
+
+#include <CGAL/license/Alpha_shapes_3.h>
+
+#include <CGAL/tags.h>
+#include <CGAL/STL_Extension/internal/stable_sort_by_blocks.h>
+
+#include <boost/mpl/has_xxx.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_sort.h>
+#endif
+
+namespace CGAL {
+
+namespace internal {
+
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_nested_type_Concurrency_tag, Concurrency_tag, false)
+
+// The alpha values and the classification of the faces are computed in parallel
+// when the underlying triangulation is parallel (that is, when its triangulation
+// data structure uses `Parallel_tag`).
+template <class Dt, bool has_concurrency_tag = Has_nested_type_Concurrency_tag<Dt>::value>
+struct Alpha_shape_3_concurrency_tag
+{
+  typedef Sequential_tag type;
+};
+
+template <class Dt>
+struct Alpha_shape_3_concurrency_tag<Dt, true>
+{
+  typedef typename Dt::Concurrency_tag type;
+};
+
+// Sorts `[first, last)`, whose comparison must not modify the elements.
+template <class ConcurrencyTag, class RandomAccessIterator>
+void alpha_shape_3_sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+    tbb::parallel_sort(first, last);
+    return;
+  }
+#endif
+  std::sort(first, last);
+}
+
+// Sorts pairs (alpha value, position of the face) by increasing alpha values.
+// The sort is stable, so that the order is the one in which the sequential code
+// inserts the faces in the alpha maps.
+template <class ConcurrencyTag, class NT>
+void sort_alpha_keys(std::vector<std::pair<NT, std::size_t> >& keys)
+{
+  typedef std::pair<NT, std::size_t> Key;
+
+  stable_sort_by_blocks<ConcurrencyTag>(keys, [](const Key& a, const Key& b) { return a.first < b.first; });
+}
+
+// Fills the multimap `map` with `(keys[i].first, elements[keys[i].second])`.
+// The keys being sorted, each insertion takes constant time.
+template <class Map, class NT, class Element>
+void fill_alpha_map(Map& map,
+                    const std::vector<std::pair<NT, std::size_t> >& keys,
+                    const std::vector<Element>& elements)
+{
+  for (const std::pair<NT, std::size_t>& key : keys)
+    map.emplace_hint(map.end(), key.first, elements[key.second]);
+}
+
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_INTERNAL_ALPHA_SHAPE_3_CONCURRENCY_H
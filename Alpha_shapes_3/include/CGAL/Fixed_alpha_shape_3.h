@@ -33,6 +33,7 @@
 #include <CGAL/iterator.h>
 
 #include <CGAL/Alpha_shapes_3/internal/Classification_type.h>
+#include <CGAL/Alpha_shapes_3/internal/Alpha_shape_3_concurrency.h>
 
 #include <CGAL/Triangulation_3.h>
 
@@ -193,6 +194,12 @@ public:
   typedef std::pair<Vertex_handle, Vertex_handle>          Vertex_handle_pair;
   typedef std::map<Vertex_handle_pair,Classification_type> Edge_status_map;
 
+private:
+  // the classification of the cells, facets, and edges is parallel when the triangulation is
+  typedef typename internal::Alpha_shape_3_concurrency_tag<Dt>::type Alpha_concurrency_tag;
+
+public:
+
   //test if a simplex is exterior to the alpha-shape
   class Exterior_simplex_test{
     const Fixed_alpha_shape_3 * _as;
@@ -823,10 +830,16 @@ template <class Dt>
 void
 Fixed_alpha_shape_3<Dt>::initialize_status_of_cells()
 {
-  Finite_cells_iterator cell_it, done = finite_cells_end();
-  for( cell_it = finite_cells_begin(); cell_it != done; ++cell_it) {
-    set_cell_status(cell_it);
-  }
+  std::vector<Cell_handle> cells;
+  cells.reserve(this->number_of_finite_cells());
+  for (Finite_cells_iterator cell_it = finite_cells_begin(); cell_it != finite_cells_end(); ++cell_it)
+    cells.push_back(cell_it);
+
+  CGAL::for_each<Alpha_concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, cells.size()),
+    [&](std::size_t i) -> bool {
+      set_cell_status(cells[i]);
+      return true;
+    });
 }
 
 
@@ -877,9 +890,17 @@ template <class Dt>
 void
 Fixed_alpha_shape_3<Dt>::initialize_status_of_facets()
 {
-  for(Finite_facets_iterator fit = finite_facets_begin();
-      fit != finite_facets_end(); ++fit)
-        set_facet_classification_type(*fit);
+  std::vector<Facet> facets;
+  facets.reserve(this->number_of_finite_facets());
+  for (Finite_facets_iterator fit = finite_facets_begin(); fit != finite_facets_end(); ++fit)
+    facets.push_back(*fit);
+
+  // each facet of a cell is written by a single facet
+  CGAL::for_each<Alpha_concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, facets.size()),
+    [&](std::size_t i) -> bool {
+      set_facet_classification_type(facets[i]);
+      return true;
+    });
 }
 
 
@@ -919,14 +940,21 @@ template <class Dt>
 void
 Fixed_alpha_shape_3<Dt>::initialize_status_of_edges()
 {
-  for (Finite_edges_iterator eit = finite_edges_begin();
-       eit != finite_edges_end(); ++eit)
-  {
-    Classification_type status=compute_edge_status(eit->first, eit->second, eit->third);
-    //cross links
-    Vertex_handle_pair vhp = make_vertex_handle_pair( *eit );
-    edge_status_map.insert(std::make_pair(vhp, status));
-  }
+  std::vector<Edge> edges(finite_edges_begin(), finite_edges_end());
+  std::vector<std::pair<Vertex_handle_pair, Classification_type> > statuses(edges.size());
+
+  CGAL::for_each<Alpha_concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, edges.size()),
+    [&](std::size_t i) -> bool {
+      const Edge& e = edges[i];
+      statuses[i] = std::make_pair(make_vertex_handle_pair(e),
+                                   compute_edge_status(e.first, e.second, e.third));
+      return true;
+    });
+
+  //cross links, inserted in the order of the map
+  internal::alpha_shape_3_sort<Alpha_concurrency_tag>(statuses.begin(), statuses.end());
+  for (const std::pair<Vertex_handle_pair, Classification_type>& status : statuses)
+    edge_status_map.emplace_hint(edge_status_map.end(), status.first, status.second);
 }
 
 
@@ -0,0 +1,193 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Alpha_shape_3.h>
+#include <CGAL/Alpha_shape_cell_base_3.h>
+#include <CGAL/Alpha_shape_vertex_base_3.h>
+#include <CGAL/Fixed_alpha_shape_3.h>
+#include <CGAL/Fixed_alpha_shape_cell_base_3.h>
+#include <CGAL/Fixed_alpha_shape_vertex_base_3.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3                                          Point;
+
+template <class ConcurrencyTag, class ExactAlphaComparisonTag>
+struct Alpha_shape_types
+{
+  typedef CGAL::Alpha_shape_vertex_base_3<K, CGAL::Default, ExactAlphaComparisonTag>    Vb;
+  typedef CGAL::Alpha_shape_cell_base_3<K, CGAL::Default, ExactAlphaComparisonTag>      Fb;
+  typedef CGAL::Triangulation_data_structure_3<Vb, Fb, ConcurrencyTag>                   Tds;
+  typedef CGAL::Delaunay_triangulation_3<K, Tds>                                         Dt;
+  typedef CGAL::Alpha_shape_3<Dt, ExactAlphaComparisonTag>                               Alpha_shape;
+};
+
+template <class ConcurrencyTag>
+struct Fixed_alpha_shape_types
+{
+  typedef CGAL::Fixed_alpha_shape_vertex_base_3<K>                      Vb;
+  typedef CGAL::Fixed_alpha_shape_cell_base_3<K>                        Fb;
+  typedef CGAL::Triangulation_data_structure_3<Vb, Fb, ConcurrencyTag>  Tds;
+  typedef CGAL::Delaunay_triangulation_3<K, Tds>                        Dt;
+  typedef CGAL::Fixed_alpha_shape_3<Dt>                                 Alpha_shape;
+};
+
+// the faces are identified by their sorted points, the handles of two triangulations being unrelated
+template <class Handle>
+std::vector<std::array<Point, 1> > points_of(const std::vector<Handle>& vertices)
+{
+  std::vector<std::array<Point, 1> > result;
+  for (Handle v : vertices)
+    result.push_back({{v->point()}});
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+template <class Cell_handle>
+std::vector<std::array<Point, 3> > points_of(const std::vector<std::pair<Cell_handle, int> >& facets)
+{
+  std::vector<std::array<Point, 3> > result;
+  for (const auto& f : facets) {
+    std::array<Point, 3> points;
+    for (int i = 0, j = 0; i < 4; ++i)
+      if (i != f.second) points[j++] = f.first->vertex(i)->point();
+    std::sort(points.begin(), points.end());
+    result.push_back(points);
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+// `alpha` is empty for fixed alpha shapes
+template <class AS1, class AS2, class... NT>
+void compare_classifications(const AS1& as1, const AS2& as2, const NT&... alpha)
+{
+  typedef typename AS1::Facet         Facet1;
+  typedef typename AS2::Facet         Facet2;
+  typedef typename AS1::Vertex_handle Vertex_handle1;
+  typedef typename AS2::Vertex_handle Vertex_handle2;
+
+  for (int type = AS1::EXTERIOR; type <= AS1::INTERIOR; ++type) {
+    std::vector<Facet1> facets1;
+    std::vector<Facet2> facets2;
+    as1.get_alpha_shape_facets(std::back_inserter(facets1), typename AS1::Classification_type(type), alpha...);
+    as2.get_alpha_shape_facets(std::back_inserter(facets2), typename AS2::Classification_type(type), alpha...);
+    assert(points_of(facets1) == points_of(facets2));
+
+    std::vector<Vertex_handle1> vertices1;
+    std::vector<Vertex_handle2> vertices2;
+    as1.get_alpha_shape_vertices(std::back_inserter(vertices1), typename AS1::Classification_type(type), alpha...);
+    as2.get_alpha_shape_vertices(std::back_inserter(vertices2), typename AS2::Classification_type(type), alpha...);
+    assert(points_of(vertices1) == points_of(vertices2));
+
+    std::vector<typename AS1::Edge> edges1;
+    std::vector<typename AS2::Edge> edges2;
+    as1.get_alpha_shape_edges(std::back_inserter(edges1), typename AS1::Classification_type(type), alpha...);
+    as2.get_alpha_shape_edges(std::back_inserter(edges2), typename AS2::Classification_type(type), alpha...);
+    assert(edges1.size() == edges2.size());
+
+    std::vector<typename AS1::Cell_handle> cells1;
+    std::vector<typename AS2::Cell_handle> cells2;
+    as1.get_alpha_shape_cells(std::back_inserter(cells1), typename AS1::Classification_type(type), alpha...);
+    as2.get_alpha_shape_cells(std::back_inserter(cells2), typename AS2::Classification_type(type), alpha...);
+    assert(cells1.size() == cells2.size());
+  }
+}
+
+// the cells of both triangulations may list their vertices in different orders,
+// so the alpha values computed from them may differ by a rounding error
+bool close(double a, double b)
+{
+  return std::abs(a - b) <= 1e-12 * (std::max)(std::abs(a), std::abs(b));
+}
+
+template <class ExactAlphaComparisonTag>
+void test_alpha_shape(const std::vector<Point>& points)
+{
+  typedef typename Alpha_shape_types<CGAL::Sequential_tag, ExactAlphaComparisonTag>::Alpha_shape Sequential_alpha_shape;
+  typedef typename Alpha_shape_types<CGAL::Parallel_tag, ExactAlphaComparisonTag>::Alpha_shape   Parallel_alpha_shape;
+
+  for (int m = 0; m < 2; ++m) {
+    typename Sequential_alpha_shape::Mode sequential_mode = m == 0 ? Sequential_alpha_shape::REGULARIZED
+                                                                   : Sequential_alpha_shape::GENERAL;
+    typename Parallel_alpha_shape::Mode parallel_mode = m == 0 ? Parallel_alpha_shape::REGULARIZED
+                                                               : Parallel_alpha_shape::GENERAL;
+    Sequential_alpha_shape as1(points.begin(), points.end(), 0, sequential_mode);
+    Parallel_alpha_shape as2(points.begin(), points.end(), 0, parallel_mode);
+
+    assert(as1.number_of_alphas() == as2.number_of_alphas());
+    for (std::size_t i = 0; i < as1.number_of_alphas(); ++i)
+      assert(close(CGAL::to_double(*(as1.alpha_begin() + i)), CGAL::to_double(*(as2.alpha_begin() + i))));
+    assert(close(CGAL::to_double(as1.find_alpha_solid()), CGAL::to_double(as2.find_alpha_solid())));
+
+    std::size_t nb_filtration1 = 0, nb_filtration2 = 0;
+    as1.filtration(CGAL::Counting_output_iterator(&nb_filtration1));
+    as2.filtration(CGAL::Counting_output_iterator(&nb_filtration2));
+    assert(nb_filtration1 == nb_filtration2);
+
+    // the classifications are compared at values between two consecutive alpha values
+    auto alpha_between = [&](std::size_t i) {
+      return typename Sequential_alpha_shape::NT((CGAL::to_double(as1.get_nth_alpha(int(i))) +
+                                                  CGAL::to_double(as1.get_nth_alpha(int(i + 1)))) / 2);
+    };
+    for (std::size_t i = 1; i < as1.number_of_alphas(); i += as1.number_of_alphas() / 5 + 1)
+      compare_classifications(as1, as2, alpha_between(i));
+
+    // switching the mode recomputes the statuses
+    as1.set_mode(m == 0 ? Sequential_alpha_shape::GENERAL : Sequential_alpha_shape::REGULARIZED);
+    as2.set_mode(m == 0 ? Parallel_alpha_shape::GENERAL : Parallel_alpha_shape::REGULARIZED);
+    assert(as1.number_of_alphas() == as2.number_of_alphas());
+    compare_classifications(as1, as2, alpha_between(as1.number_of_alphas() / 2));
+  }
+}
+
+void test_fixed_alpha_shape(const std::vector<Point>& points, double alpha)
+{
+  typedef Fixed_alpha_shape_types<CGAL::Sequential_tag>::Alpha_shape Sequential_alpha_shape;
+  typedef Fixed_alpha_shape_types<CGAL::Parallel_tag>::Alpha_shape   Parallel_alpha_shape;
+
+  Sequential_alpha_shape as1(points.begin(), points.end(), alpha);
+  Parallel_alpha_shape as2(points.begin(), points.end(), alpha);
+  compare_classifications(as1, as2);
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+int main()
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  CGAL::Random random(7);
+  CGAL::Random_points_in_sphere_3<Point> gen(1.0, random);
+  std::vector<Point> points;
+  std::copy_n(gen, 2000, std::back_inserter(points));
+
+  std::cout << "Testing parallel Alpha_shape_3" << std::endl;
+  test_alpha_shape<CGAL::Tag_false>(points);
+  std::cout << "Testing parallel Alpha_shape_3 with exact comparisons" << std::endl;
+  test_alpha_shape<CGAL::Tag_true>(points);
+  std::cout << "Testing parallel Fixed_alpha_shape_3" << std::endl;
+  test_fixed_alpha_shape(points, 0.01);
+
+  // enough points for more than 2^15 facets, so that the alpha values are sorted by blocks
+  std::vector<Point> more_points;
+  std::copy_n(gen, 6000, std::back_inserter(more_points));
+  std::cout << "Testing parallel Alpha_shape_3 on " << more_points.size() << " points" << std::endl;
+  test_alpha_shape<CGAL::Tag_false>(more_points);
+#else
+  std::cout << "TBB is not available, nothing to test" << std::endl;
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
@@ -0,0 +1,123 @@
+#include <CGAL/Real_timer.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Barycentric_coordinates_2/Wachspress_coordinates_2.h>
+#include <CGAL/Barycentric_coordinates_2/Mean_value_coordinates_2.h>
+#include <CGAL/Barycentric_coordinates_2/Discrete_harmonic_coordinates_2.h>
+
+using Kernel   = CGAL::Exact_predicates_inexact_constructions_kernel;
+using FT       = typename Kernel::FT;
+using Point_2  = typename Kernel::Point_2;
+using Timer    = CGAL::Real_timer;
+using Vertices = std::vector<Point_2>;
+using Policy   = CGAL::Barycentric_coordinates::Computation_policy_2;
+
+using WPC2 = CGAL::Barycentric_coordinates::Wachspress_coordinates_2<Vertices, Kernel>;
+using MVC2 = CGAL::Barycentric_coordinates::Mean_value_coordinates_2<Vertices, Kernel>;
+using DHC2 = CGAL::Barycentric_coordinates::Discrete_harmonic_coordinates_2<Vertices, Kernel>;
+
+// Evaluates the coordinates one query point at a time with a single coordinate object.
+template<typename Coordinates>
+double run_single(
+  const Vertices& vertices,
+  const std::vector<Point_2>& queries,
+  std::vector<FT>& coordinates) {
+
+  Timer timer;
+  timer.start();
+  Coordinates single(vertices, Policy::FAST);
+  coordinates.resize(queries.size() * vertices.size());
+  for (std::size_t i = 0; i < queries.size(); ++i)
+    single(queries[i], coordinates.begin() + i * vertices.size());
+  timer.stop();
+  return timer.time();
+}
+
+// Evaluates the coordinates of all query points with a batch function.
+template<typename ConcurrencyTag, typename Batch>
+double run_batch(
+  const Batch& batch,
+  std::vector<FT>& coordinates) {
+
+  Timer timer;
+  timer.start();
+  batch(ConcurrencyTag(), coordinates);
+  timer.stop();
+  return timer.time();
+}
+
+template<typename Coordinates, typename Batch>
+void benchmark(
+  const std::string& name,
+  const Vertices& vertices,
+  const std::vector<Point_2>& queries,
+  const Batch& batch) {
+
+  std::vector<FT> single, sequential;
+  std::cout << name << " (" << queries.size() << " queries): " << std::endl;
+  std::cout << "  one query at a time: " <<
+    run_single<Coordinates>(vertices, queries, single) << " seconds" << std::endl;
+  std::cout << "  sequential batch: " <<
+    run_batch<CGAL::Sequential_tag>(batch, sequential) << " seconds" << std::endl;
+  assert(single == sequential);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::vector<FT> parallel;
+  std::cout << "  parallel batch: " <<
+    run_batch<CGAL::Parallel_tag>(batch, parallel) << " seconds" << std::endl;
+  assert(single == parallel);
+#endif
+}
+
+int main() {
+
+  const std::size_t number_of_x_coordinates = 1000;
+  const std::size_t number_of_y_coordinates = 1000;
+
+  const FT zero = FT(0);
+  const FT one  = FT(1);
+  const FT x_step = one / static_cast<FT>(number_of_x_coordinates);
+  const FT y_step = one / static_cast<FT>(number_of_y_coordinates);
+
+  const std::vector<Point_2> vertices = {
+    Point_2(zero, zero - y_step),
+    Point_2(one , zero - y_step),
+    Point_2(FT(3) / FT(2), FT(1) / FT(4)),
+    Point_2(2, FT(3) / FT(4)),
+    Point_2(FT(9) / FT(4), FT(5) / FT(4)),
+    Point_2(FT(9) / FT(4), FT(9) / FT(4)),
+    Point_2(2, FT(11) / FT(4)),
+    Point_2(FT(3) / FT(2), FT(13) / FT(4)),
+    Point_2(1, FT(7) / FT(2)),
+    Point_2(0, FT(7) / FT(2)),
+    Point_2(-FT(1) / FT(2), FT(13) / FT(4)),
+    Point_2(-1, FT(11) / FT(4)),
+    Point_2(-FT(5) / FT(4), FT(9) / FT(4)),
+    Point_2(-FT(5) / FT(4), FT(5) / FT(4)),
+    Point_2(-1, FT(3) / FT(4)),
+    Point_2(-FT(1) / FT(2), FT(1) / FT(4))
+  };
+
+  std::vector<Point_2> queries;
+  queries.reserve(number_of_x_coordinates * number_of_y_coordinates);
+  for (std::size_t i = 0; i < number_of_x_coordinates; ++i)
+    for (std::size_t j = 0; j < number_of_y_coordinates; ++j)
+      queries.push_back(Point_2(static_cast<FT>(i) * x_step, static_cast<FT>(j) * y_step));
+
+  namespace BC = CGAL::Barycentric_coordinates;
+  std::cout.precision(10);
+
+  benchmark<WPC2>("wachspress_coordinates_2", vertices, queries,
+    [&](auto tag, std::vector<FT>& coordinates) {
+      BC::wachspress_coordinates_2<decltype(tag)>(vertices, queries, coordinates, Policy::FAST);
+    });
+  benchmark<MVC2>("mean_value_coordinates_2", vertices, queries,
+    [&](auto tag, std::vector<FT>& coordinates) {
+      BC::mean_value_coordinates_2<decltype(tag)>(vertices, queries, coordinates, Policy::FAST);
+    });
+  benchmark<DHC2>("discrete_harmonic_coordinates_2", vertices, queries,
+    [&](auto tag, std::vector<FT>& coordinates) {
+      BC::discrete_harmonic_coordinates_2<decltype(tag)>(vertices, queries, coordinates, Policy::FAST);
+    });
+
+  return EXIT_SUCCESS;
+}
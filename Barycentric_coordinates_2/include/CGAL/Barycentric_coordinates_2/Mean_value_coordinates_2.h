@@ -19,6 +19,7 @@
 // Internal includes.
 #include <CGAL/Weights/mean_value_weights.h>
 #include <CGAL/Barycentric_coordinates_2/internal/utils_2.h>
+#include <CGAL/Barycentric_coordinates_2/internal/batch_2.h>
 
 // [1] Reference: "K. Hormann and M. Floater.
 // Mean value coordinates for arbitrary planar polygons.
@@ -587,6 +588,186 @@ namespace Barycentric_coordinates {
   }
   /// \endcond
 
+  /*!
+    \ingroup PkgBarycentricCoordinates2RefFunctions
+
+    \brief computes 2D mean value weights at several query points.
+
+    This function computes 2D mean value weights at each point of `queries`
+    with respect to the vertices of a simple polygon. The weights are stored
+    in a dense matrix with one row per query point and one column per polygon vertex:
+    the weight of the vertex `j` at the query point `queries[i]` is
+    `weights[i * polygon.size() + j]`.
+
+    The data that only depend on the polygon are computed once for all queries,
+    and the internal memory is allocated once per range of queries processed together.
+    The result is the same as the one of the version of this function for a single query point.
+
+    \tparam ConcurrencyTag
+    enables sequential versus parallel computation. Possible values are `Sequential_tag`
+    (the default) and `Parallel_tag`.
+
+    \tparam PointRange
+    a model of `ConstRange` whose iterator type is `RandomAccessIterator`
+    and value type is `GeomTraits::Point_2`
+
+    \tparam QueryRange
+    a model of `ConstRange` whose iterator type is `RandomAccessIterator`
+    and value type is `GeomTraits::Point_2`
+
+    \tparam GeomTraits
+    a model of `BarycentricTraits_2`
+
+    \param polygon
+    an instance of `PointRange` with 2D points, which form a simple polygon
+
+    \param queries
+    the query points
+
+    \param weights
+    the matrix with the computed weights, resized to `queries.size() * polygon.size()`
+
+    \param traits
+    a traits class with geometric objects, predicates, and constructions;
+    this parameter can be omitted if the traits class can be deduced from the point type
+
+    \param policy
+    one of the `Computation_policy_2`;
+    the default is `Computation_policy_2::FAST_WITH_EDGE_CASES`
+
+    \pre polygon.size() >= 3
+    \pre polygon is simple
+  */
+  template<
+  typename ConcurrencyTag = Sequential_tag,
+  typename PointRange,
+  typename QueryRange,
+  typename GeomTraits>
+  void mean_value_weights_2(
+    const PointRange& polygon,
+    const QueryRange& queries,
+    std::vector<typename GeomTraits::FT>& weights,
+    const GeomTraits& traits,
+    const Computation_policy_2 policy =
+    Computation_policy_2::FAST_WITH_EDGE_CASES) {
+
+    const Mean_value_coordinates_2<PointRange, GeomTraits>
+      mean_value(polygon, policy, traits);
+    internal::evaluate_batch_2<ConcurrencyTag>(
+      mean_value, queries, polygon.size(), weights, false);
+  }
+
+  /// \cond SKIP_IN_MANUAL
+  template<
+  typename ConcurrencyTag = Sequential_tag,
+  typename PointRange,
+  typename QueryRange,
+  typename FT>
+  void mean_value_weights_2(
+    const PointRange& polygon,
+    const QueryRange& queries,
+    std::vector<FT>& weights,
+    const Computation_policy_2 policy =
+    Computation_policy_2::FAST_WITH_EDGE_CASES) {
+
+    using Point_2 = typename PointRange::value_type;
+    using GeomTraits = typename Kernel_traits<Point_2>::Kernel;
+    const GeomTraits traits;
+    mean_value_weights_2<ConcurrencyTag>(
+      polygon, queries, weights, traits, policy);
+  }
+  /// \endcond
+
+  /*!
+    \ingroup PkgBarycentricCoordinates2RefFunctions
+
+    \brief computes 2D mean value coordinates at several query points.
+
+    This function computes 2D mean value coordinates at each point of `queries`
+    with respect to the vertices of a simple polygon. The coordinates are stored
+    in a dense matrix with one row per query point and one column per polygon vertex:
+    the coordinate of the vertex `j` at the query point `queries[i]` is
+    `coordinates[i * polygon.size() + j]`.
+
+    The data that only depend on the polygon are computed once for all queries,
+    and the internal memory is allocated once per range of queries processed together.
+    The result is the same as the one of the version of this function for a single query point.
+
+    \tparam ConcurrencyTag
+    enables sequential versus parallel computation. Possible values are `Sequential_tag`
+    (the default) and `Parallel_tag`.
+
+    \tparam PointRange
+    a model of `ConstRange` whose iterator type is `RandomAccessIterator`
+    and value type is `GeomTraits::Point_2`
+
+    \tparam QueryRange
+    a model of `ConstRange` whose iterator type is `RandomAccessIterator`
+    and value type is `GeomTraits::Point_2`
+
+    \tparam GeomTraits
+    a model of `BarycentricTraits_2`
+
+    \param polygon
+    an instance of `PointRange` with 2D points, which form a simple polygon
+
+    \param queries
+    the query points
+
+    \param coordinates
+    the matrix with the computed coordinates, resized to `queries.size() * polygon.size()`
+
+    \param traits
+    a traits class with geometric objects, predicates, and constructions;
+    this parameter can be omitted if the traits class can be deduced from the point type
+
+    \param policy
+    one of the `Computation_policy_2`;
+    the default is `Computation_policy_2::PRECISE_WITH_EDGE_CASES`
+
+    \pre polygon.size() >= 3
+    \pre polygon is simple
+  */
+  template<
+  typename ConcurrencyTag = Sequential_tag,
+  typename PointRange,
+  typename QueryRange,
+  typename GeomTraits>
+  void mean_value_coordinates_2(
+    const PointRange& polygon,
+    const QueryRange& queries,
+    std::vector<typename GeomTraits::FT>& coordinates,
+    const GeomTraits& traits,
+    const Computation_policy_2 policy =
+    Computation_policy_2::PRECISE_WITH_EDGE_CASES) {
+
+    const Mean_value_coordinates_2<PointRange, GeomTraits>
+      mean_value(polygon, policy, traits);
+    internal::evaluate_batch_2<ConcurrencyTag>(
+      mean_value, queries, polygon.size(), coordinates, true);
+  }
+
+  /// \cond SKIP_IN_MANUAL
+  template<
+  typename ConcurrencyTag = Sequential_tag,
+  typename PointRange,
+  typename QueryRange,
+  typename FT>
+  void mean_value_coordinates_2(
+    const PointRange& polygon,
+    const QueryRange& queries,
+    std::vector<FT>& coordinates,
+    const Computation_policy_2 policy =
+    Computation_policy_2::PRECISE_WITH_EDGE_CASES) {
+
+    using Point_2 = typename PointRange::value_type;
+    using GeomTraits = typename Kernel_traits<Point_2>::Kernel;
+    const GeomTraits traits;
+    mean_value_coordinates_2<ConcurrencyTag>(
+      polygon, queries, coordinates, traits, policy);
+  }
+  /// \endcond
+
 } // namespace Barycentric_coordinates
 } // namespace CGAL
 
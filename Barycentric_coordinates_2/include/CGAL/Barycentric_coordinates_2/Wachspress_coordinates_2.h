@@ -19,6 +19,7 @@
 // Internal includes.
 #include <CGAL/Weights/wachspress_weights.h>
 #include <CGAL/Barycentric_coordinates_2/internal/utils_2.h>
+#include <CGAL/Barycentric_coordinates_2/internal/batch_2.h>
 
 // [1] Reference: "M. S. Floater, K. Hormann, and G. Kos.
 // A general construction of barycentric coordinates over convex polygons.
@@ -130,6 +131,7 @@ namespace Barycentric_coordinates {
         internal::polygon_type_2(polygon, traits, point_map) ==
         internal::Polygon_type::STRICTLY_CONVEX);
       resize();
+      internal::corner_areas_2(polygon, traits, point_map, C);
     }
 
     /// @}
@@ -209,6 +211,7 @@ namespace Barycentric_coordinates {
     Wachspress_weights_2 m_wachspress_weights_2;
 
     std::vector<FT> A;
+    std::vector<FT> C;
     std::vector<FT> w;
 
     // Functions.
@@ -325,19 +328,17 @@ namespace Barycentric_coordinates {
       const auto& pn = get(m_point_map, *(m_polygon.begin() + (n - 1)));
       A[n - 1] = m_area_2(pn, p1, query);
 
-      // Initialize weights with areas C following the area notation from [1].
+      // Initialize weights with areas C following the area notation from [1],
+      // which are computed in the constructor.
       // Then we multiply them by areas A as in the formula (5) from [1].
       // We also split the loop.
-      w[0] = m_area_2(pn, p1, p2);
+      w[0] = C[0];
       for (std::size_t j = 1; j < n - 1; ++j) {
         w[0] *= A[j];
       }
 
       for (std::size_t i = 1; i < n - 1; ++i) {
-        const auto& pi0 = get(m_point_map, *(m_polygon.begin() + (i - 1)));
-        const auto& pi1 = get(m_point_map, *(m_polygon.begin() + (i + 0)));
-        const auto& pi2 = get(m_point_map, *(m_polygon.begin() + (i + 1)));
-        w[i] = m_area_2(pi0, pi1, pi2);
+        w[i] = C[i];
 
         for (std::size_t j = 0; j < i - 1; ++j) {
           w[i] *= A[j];
@@ -347,8 +348,7 @@ namespace Barycentric_coordinates {
         }
       }
 
-      const auto& pm = get(m_point_map, *(m_polygon.begin() + (n - 2)));
-      w[n - 1] = m_area_2(pm, pn, p1);
+      w[n - 1] = C[n - 1];
       for (std::size_t j = 0; j < n - 2; ++j) {
         w[n - 1] *= A[j];
       }
@@ -536,6 +536,188 @@ namespace Barycentric_coordinates {
   }
   /// \endcond
 
+  /*!
+    \ingroup PkgBarycentricCoordinates2RefFunctions
+
+    \brief computes 2D Wachspress weights at several query points.
+
+    This function computes 2D Wachspress weights at each point of `queries`
+    with respect to the vertices of a strictly convex polygon. The weights are stored
+    in a dense matrix with one row per query point and one column per polygon vertex:
+    the weight of the vertex `j` at the query point `queries[i]` is
+    `weights[i * polygon.size() + j]`.
+
+    The data that only depend on the polygon are computed once for all queries,
+    and the internal memory is allocated once per range of queries processed together.
+    The result is the same as the one of the version of this function for a single query point.
+
+    \tparam ConcurrencyTag
+    enables sequential versus parallel computation. Possible values are `Sequential_tag`
+    (the default) and `Parallel_tag`.
+
+    \tparam PointRange
+    a model of `ConstRange` whose iterator type is `RandomAccessIterator`
+    and value type is `GeomTraits::Point_2`
+
+    \tparam QueryRange
+    a model of `ConstRange` whose iterator type is `RandomAccessIterator`
+    and value type is `GeomTraits::Point_2`
+
+    \tparam GeomTraits
+    a model of `BarycentricTraits_2`
+
+    \param polygon
+    an instance of `PointRange` with 2D points, which form a strictly convex polygon
+
+    \param queries
+    the query points
+
+    \param weights
+    the matrix with the computed weights, resized to `queries.size() * polygon.size()`
+
+    \param traits
+    a traits class with geometric objects, predicates, and constructions;
+    this parameter can be omitted if the traits class can be deduced from the point type
+
+    \param policy
+    one of the `Computation_policy_2`;
+    the default is `Computation_policy_2::FAST_WITH_EDGE_CASES`
+
+    \pre polygon.size() >= 3
+    \pre polygon is simple
+    \pre polygon is strictly convex
+  */
+  template<
+  typename ConcurrencyTag = Sequential_tag,
+  typename PointRange,
+  typename QueryRange,
+  typename GeomTraits>
+  void wachspress_weights_2(
+    const PointRange& polygon,
+    const QueryRange& queries,
+    std::vector<typename GeomTraits::FT>& weights,
+    const GeomTraits& traits,
+    const Computation_policy_2 policy =
+    Computation_policy_2::FAST_WITH_EDGE_CASES) {
+
+    const Wachspress_coordinates_2<PointRange, GeomTraits>
+      wachspress(polygon, policy, traits);
+    internal::evaluate_batch_2<ConcurrencyTag>(
+      wachspress, queries, polygon.size(), weights, false);
+  }
+
+  /// \cond SKIP_IN_MANUAL
+  template<
+  typename ConcurrencyTag = Sequential_tag,
+  typename PointRange,
+  typename QueryRange,
+  typename FT>
+  void wachspress_weights_2(
+    const PointRange& polygon,
+    const QueryRange& queries,
+    std::vector<FT>& weights,
+    const Computation_policy_2 policy =
+    Computation_policy_2::FAST_WITH_EDGE_CASES) {
+
+    using Point_2 = typename PointRange::value_type;
+    using GeomTraits = typename Kernel_traits<Point_2>::Kernel;
+    const GeomTraits traits;
+    wachspress_weights_2<ConcurrencyTag>(
+      polygon, queries, weights, traits, policy);
+  }
+  /// \endcond
+
+  /*!
+    \ingroup PkgBarycentricCoordinates2RefFunctions
+
+    \brief computes 2D Wachspress coordinates at several query points.
+
+    This function computes 2D Wachspress coordinates at each point of `queries`
+    with respect to the vertices of a strictly convex polygon. The coordinates are stored
+    in a dense matrix with one row per query point and one column per polygon vertex:
+    the coordinate of the vertex `j` at the query point `queries[i]` is
+    `coordinates[i * polygon.size() + j]`.
+
+    The data that only depend on the polygon are computed once for all queries,
+    and the internal memory is allocated once per range of queries processed together.
+    The result is the same as the one of the version of this function for a single query point.
+
+    \tparam ConcurrencyTag
+    enables sequential versus parallel computation. Possible values are `Sequential_tag`
+    (the default) and `Parallel_tag`.
+
+    \tparam PointRange
+    a model of `ConstRange` whose iterator type is `RandomAccessIterator`
+    and value type is `GeomTraits::Point_2`
+
+    \tparam QueryRange
+    a model of `ConstRange` whose iterator type is `RandomAccessIterator`
+    and value type is `GeomTraits::Point_2`
+
+    \tparam GeomTraits
+    a model of `BarycentricTraits_2`
+
+    \param polygon
+    an instance of `PointRange` with 2D points, which form a strictly convex polygon
+
+    \param queries
+    the query points
+
+    \param coordinates
+    the matrix with the computed coordinates, resized to `queries.size() * polygon.size()`
+
+    \param traits
+    a traits class with geometric objects, predicates, and constructions;
+    this parameter can be omitted if the traits class can be deduced from the point type
+
+    \param policy
+    one of the `Computation_policy_2`;
+    the default is `Computation_policy_2::PRECISE_WITH_EDGE_CASES`
+
+    \pre polygon.size() >= 3
+    \pre polygon is simple
+    \pre polygon is strictly convex
+  */
+  template<
+  typename ConcurrencyTag = Sequential_tag,
+  typename PointRange,
+  typename QueryRange,
+  typename GeomTraits>
+  void wachspress_coordinates_2(
+    const PointRange& polygon,
+    const QueryRange& queries,
+    std::vector<typename GeomTraits::FT>& coordinates,
+    const GeomTraits& traits,
+    const Computation_policy_2 policy =
+    Computation_policy_2::PRECISE_WITH_EDGE_CASES) {
+
+    const Wachspress_coordinates_2<PointRange, GeomTraits>
+      wachspress(polygon, policy, traits);
+    internal::evaluate_batch_2<ConcurrencyTag>(
+      wachspress, queries, polygon.size(), coordinates, true);
+  }
+
+  /// \cond SKIP_IN_MANUAL
+  template<
+  typename ConcurrencyTag = Sequential_tag,
+  typename PointRange,
+  typename QueryRange,
+  typename FT>
+  void wachspress_coordinates_2(
+    const PointRange& polygon,
+    const QueryRange& queries,
+    std::vector<FT>& coordinates,
+    const Computation_policy_2 policy =
+    Computation_policy_2::PRECISE_WITH_EDGE_CASES) {
+
+    using Point_2 = typename PointRange::value_type;
+    using GeomTraits = typename Kernel_traits<Point_2>::Kernel;
+    const GeomTraits traits;
+    wachspress_coordinates_2<ConcurrencyTag>(
+      polygon, queries, coordinates, traits, policy);
+  }
+  /// \endcond
+
 } // namespace Barycentric_coordinates
 } // namespace CGAL
 
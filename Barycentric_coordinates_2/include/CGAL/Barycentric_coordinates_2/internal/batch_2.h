@@ -0,0 +1,71 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_BARYCENTRIC_INTERNAL_BATCH_2_H
+#define CGAL_BARYCENTRIC_INTERNAL_BATCH_2_H
+
+#include <CGAL/license/Barycentric_coordinates_2.h>
+
+// STL includes.
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// CGAL includes.
+#include <CGAL/tags.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+
+namespace CGAL {
+namespace Barycentric_coordinates {
+namespace internal {
+
+  // Fills the row `i` of the dense `queries.size()` x `n` matrix `values` with the
+  // coordinates (or the weights, if `normalize` is false) of `queries[i]`.
+  // The coordinate object keeps per query buffers, so the queries are evaluated
+  // in blocks, and each block uses its own copy of `coordinates`; the per polygon
+  // data is computed only once, when `coordinates` is constructed.
+  template<
+  typename ConcurrencyTag,
+  typename Coordinates,
+  typename QueryRange,
+  typename FT>
+  void evaluate_batch_2(
+    const Coordinates& coordinates,
+    const QueryRange& queries,
+    const std::size_t n,
+    std::vector<FT>& values,
+    const bool normalize) {
+
+    const std::size_t size = queries.size();
+    values.resize(size * n);
+
+    const std::size_t block_size = 256;
+    const std::size_t nb_blocks = (size + block_size - 1) / block_size;
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, nb_blocks),
+      [&](const std::size_t b) -> bool {
+        Coordinates local_coordinates(coordinates);
+        const std::size_t last = (std::min)(size, (b + 1) * block_size);
+        for (std::size_t i = b * block_size; i < last; ++i) {
+          const auto row = values.begin() + i * n;
+          if (normalize) {
+            local_coordinates(queries[i], row);
+          } else {
+            local_coordinates.weights(queries[i], row);
+          }
+        }
+        return true;
+      });
+  }
+
+} // namespace internal
+} // namespace Barycentric_coordinates
+} // namespace CGAL
+
+#endif // CGAL_BARYCENTRIC_INTERNAL_BATCH_2_H
@@ -103,6 +103,32 @@ namespace internal {
     }
   };
 
+  // Compute the signed areas of the triangles formed by each polygon vertex
+  // and its two neighbors. These areas only depend on the polygon.
+  template<
+  typename VertexRange,
+  typename GeomTraits,
+  typename PointMap>
+  void corner_areas_2(
+    const VertexRange& polygon,
+    const GeomTraits& traits,
+    const PointMap point_map,
+    std::vector<typename GeomTraits::FT>& areas) {
+
+    const auto area_2 = traits.compute_area_2_object();
+
+    CGAL_precondition(polygon.size() >= 3);
+    const std::size_t n = polygon.size();
+
+    areas.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto& p0 = get(point_map, *(polygon.begin() + (i + n - 1) % n));
+      const auto& p1 = get(point_map, *(polygon.begin() + i));
+      const auto& p2 = get(point_map, *(polygon.begin() + (i + 1) % n));
+      areas[i] = area_2(p0, p1, p2);
+    }
+  }
+
   // Get default values.
   template<typename OutputIterator>
   void get_default(
@@ -389,7 +415,7 @@ namespace internal {
 
         for (std::size_t i = 0; i < n; ++i)
           if (i == index) {
-            linear_coordinates_2(source, target, query, coordinates, traits); ++i;
+            coordinates = linear_coordinates_2(source, target, query, coordinates, traits); ++i;
           } else {
             *(coordinates++) = FT(0);
           }
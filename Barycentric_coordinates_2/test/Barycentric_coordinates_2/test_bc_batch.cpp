@@ -0,0 +1,108 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Barycentric_coordinates_2/Wachspress_coordinates_2.h>
+#include <CGAL/Barycentric_coordinates_2/Mean_value_coordinates_2.h>
+#include <CGAL/Barycentric_coordinates_2/Discrete_harmonic_coordinates_2.h>
+
+using Kernel  = CGAL::Exact_predicates_inexact_constructions_kernel;
+using FT      = typename Kernel::FT;
+using Point_2 = typename Kernel::Point_2;
+
+using Polygon = std::vector<Point_2>;
+using Policy  = CGAL::Barycentric_coordinates::Computation_policy_2;
+
+// The batch functions must give the same values as the functions for a single query point.
+template<typename ConcurrencyTag>
+void test_batch(
+  const Polygon& polygon,
+  const std::vector<Point_2>& queries,
+  const std::vector<Policy>& policies) {
+
+  namespace BC = CGAL::Barycentric_coordinates;
+  const std::size_t n = polygon.size();
+
+  for (const Policy policy : policies) {
+    std::vector<FT> wp, mv, dh;
+    BC::wachspress_coordinates_2<ConcurrencyTag>(polygon, queries, wp, policy);
+    BC::mean_value_coordinates_2<ConcurrencyTag>(polygon, queries, mv, policy);
+    BC::discrete_harmonic_coordinates_2<ConcurrencyTag>(polygon, queries, dh, policy);
+    assert(wp.size() == queries.size() * n);
+    assert(mv.size() == queries.size() * n);
+    assert(dh.size() == queries.size() * n);
+
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+      std::vector<FT> expected;
+      BC::wachspress_coordinates_2(polygon, queries[i], std::back_inserter(expected), policy);
+      BC::mean_value_coordinates_2(polygon, queries[i], std::back_inserter(expected), policy);
+      BC::discrete_harmonic_coordinates_2(polygon, queries[i], std::back_inserter(expected), policy);
+      for (std::size_t j = 0; j < n; ++j) {
+        assert(wp[i * n + j] == expected[j]);
+        assert(mv[i * n + j] == expected[n + j]);
+        assert(dh[i * n + j] == expected[2 * n + j]);
+      }
+    }
+  }
+
+  // The precise policies do not provide weights.
+  for (const Policy policy : policies) {
+    if (policy == Policy::PRECISE || policy == Policy::PRECISE_WITH_EDGE_CASES)
+      continue;
+
+    std::vector<FT> wp, mv, dh;
+    BC::wachspress_weights_2<ConcurrencyTag>(polygon, queries, wp, Kernel(), policy);
+    BC::mean_value_weights_2<ConcurrencyTag>(polygon, queries, mv, Kernel(), policy);
+    BC::discrete_harmonic_weights_2<ConcurrencyTag>(polygon, queries, dh, Kernel(), policy);
+
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+      std::vector<FT> expected;
+      BC::wachspress_weights_2(polygon, queries[i], std::back_inserter(expected), policy);
+      BC::mean_value_weights_2(polygon, queries[i], std::back_inserter(expected), policy);
+      BC::discrete_harmonic_weights_2(polygon, queries[i], std::back_inserter(expected), policy);
+      for (std::size_t j = 0; j < n; ++j) {
+        assert(wp[i * n + j] == expected[j]);
+        assert(mv[i * n + j] == expected[n + j]);
+        assert(dh[i * n + j] == expected[2 * n + j]);
+      }
+    }
+  }
+}
+
+int main() {
+
+  const Polygon polygon = {
+    Point_2(0, 0),
+    Point_2(1, 0),
+    Point_2( FT(5) / FT(4), FT(3) / FT(4)),
+    Point_2( FT(1) / FT(2), FT(3) / FT(2)),
+    Point_2(-FT(1) / FT(4), FT(3) / FT(4))
+  };
+
+  // Interior queries.
+  std::vector<Point_2> queries;
+  const FT step = FT(1) / FT(50);
+  for (FT x = step; x < FT(1); x += step)
+    for (FT y = step; y < FT(1); y += step)
+      queries.push_back(Point_2(x, y));
+
+  // Queries on the vertices and on the edges of the polygon.
+  std::vector<Point_2> boundary_queries = queries;
+  for (std::size_t i = 0; i < polygon.size(); ++i) {
+    boundary_queries.push_back(polygon[i]);
+    boundary_queries.push_back(CGAL::midpoint(polygon[i], polygon[(i + 1) % polygon.size()]));
+  }
+
+  const std::vector<Policy> policies = {
+    Policy::PRECISE, Policy::FAST };
+  const std::vector<Policy> edge_case_policies = {
+    Policy::PRECISE_WITH_EDGE_CASES, Policy::FAST_WITH_EDGE_CASES };
+
+  test_batch<CGAL::Sequential_tag>(polygon, queries, policies);
+  test_batch<CGAL::Sequential_tag>(polygon, boundary_queries, edge_case_policies);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  test_batch<CGAL::Parallel_tag>(polygon, queries, policies);
+  test_batch<CGAL::Parallel_tag>(polygon, boundary_queries, edge_case_policies);
+#endif
+
+  std::cout << "test_bc_batch: SUCCESS" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -18,6 +18,11 @@
 
 #include <CGAL/basic.h>
 #include <CGAL/Box_intersection_d/box_limits.h>
+#include <CGAL/Box_intersection_d/Box_traits_d.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_group.h>
+#endif
 
 #include <boost/random/linear_congruential.hpp>
 #include <boost/random/uniform_int.hpp>
@@ -30,6 +35,8 @@
 #include <cmath>
 #include <climits>
 #include <cstddef>
+#include <type_traits>
+#include <vector>
 
 namespace CGAL {
 
@@ -83,6 +90,227 @@ void all_pairs( ForwardIter p_begin, ForwardIter p_end,
 }
 
 
+// The scans below switch to a structure-of-arrays copy of the boxes when the
+// predicates are the default ones of `Predicate_traits_d` on an arithmetic
+// number type: the coordinates of each dimension are then stored contiguously
+// and the overlap tests in the dimensions other than the sweep dimension are
+// evaluated for blocks of candidates with branch-free loops that the compiler
+// can vectorize. Custom predicate traits always use the generic scans.
+template< class Traits >
+struct Is_soa_scannable : public std::false_type {};
+
+template< class BoxTraits, bool closed >
+struct Is_soa_scannable< Predicate_traits_d< BoxTraits, closed > >
+  : public std::is_arithmetic< typename BoxTraits::NT > {};
+
+// below this number of boxes, copying the coordinates does not pay off
+const std::ptrdiff_t soa_scan_cutoff = 32;
+
+template< class Traits >
+class Box_soa {
+    typedef typename Traits::NT NT;
+    typedef typename Traits::ID ID;
+
+    std::size_t n;
+    std::vector< NT > lo_, hi_;
+    std::vector< ID > id_;
+
+public:
+    template< class RandomAccessIter >
+    Box_soa( RandomAccessIter begin, RandomAccessIter end, int last_dim )
+      : n( std::distance( begin, end ) ),
+        lo_( n * ( last_dim + 1 ) ), hi_( n * ( last_dim + 1 ) ), id_( n )
+    {
+        for( std::size_t k = 0; k < n; ++k, ++begin ) {
+            id_[k] = Traits::id( *begin );
+            for( int dim = 0; dim <= last_dim; ++dim ) {
+                lo_[dim * n + k] = Traits::min_coord( *begin, dim );
+                hi_[dim * n + k] = Traits::max_coord( *begin, dim );
+            }
+        }
+    }
+
+    std::size_t size() const { return n; }
+    const NT* lo( int dim ) const { return lo_.data() + dim * n; }
+    const NT* hi( int dim ) const { return hi_.data() + dim * n; }
+    const ID* ids() const { return id_.data(); }
+
+    // same as `Traits::is_lo_less_lo()`
+    bool is_lo_less_lo( std::size_t k, const Box_soa& b, std::size_t j,
+                        int dim ) const
+    {
+        return lo( dim )[k] < b.lo( dim )[j] ||
+               ( lo( dim )[k] == b.lo( dim )[j] && id_[k] < b.id_[j] );
+    }
+};
+
+// mask[k] is set to true iff box `k0+k` of `a` is not box `j` of `b` and
+// both intersect in all dimensions in [1,last_dim], for k in [0,count).
+template< class Traits >
+void soa_intersection_mask( const Box_soa< Traits >& a,
+                            std::size_t k0, std::size_t count,
+                            const Box_soa< Traits >& b, std::size_t j,
+                            int last_dim, unsigned char* mask )
+{
+    typedef typename Traits::NT NT;
+    typedef typename Traits::ID ID;
+
+    const ID  b_id = b.ids()[j];
+    const ID* a_id = a.ids() + k0;
+    for( std::size_t k = 0; k < count; ++k )
+        mask[k] = ( a_id[k] != b_id );
+
+    for( int dim = 1; dim <= last_dim; ++dim ) {
+        const NT  b_lo = b.lo( dim )[j];
+        const NT  b_hi = b.hi( dim )[j];
+        const NT* a_lo = a.lo( dim ) + k0;
+        const NT* a_hi = a.hi( dim ) + k0;
+        for( std::size_t k = 0; k < count; ++k )
+            mask[k] &= (unsigned char)( Traits::hi_greater( b_hi, a_lo[k] ) &
+                                        Traits::hi_greater( a_hi[k], b_lo ) );
+    }
+}
+
+// mask[k] &= `Traits::contains_lo_point( i, p, dim )` where the interval `i`
+// and the point `p` are box `j` of `b` and box `k0+k` of `a`, or the other
+// way around if `a_is_interval` is true.
+template< class Traits >
+void soa_contains_lo_point_mask( const Box_soa< Traits >& a,
+                                 std::size_t k0, std::size_t count,
+                                 const Box_soa< Traits >& b, std::size_t j,
+                                 int dim, bool a_is_interval,
+                                 unsigned char* mask )
+{
+    typedef typename Traits::NT NT;
+    typedef typename Traits::ID ID;
+
+    const NT  b_lo = b.lo( dim )[j];
+    const NT  b_hi = b.hi( dim )[j];
+    const ID  b_id = b.ids()[j];
+    const NT* a_lo = a.lo( dim ) + k0;
+    const NT* a_hi = a.hi( dim ) + k0;
+    const ID* a_id = a.ids() + k0;
+    if( a_is_interval ) {
+        for( std::size_t k = 0; k < count; ++k )
+            mask[k] &= (unsigned char)(
+                ( ( a_lo[k] < b_lo ) | ( ( a_lo[k] == b_lo ) & ( a_id[k] < b_id ) ) ) &
+                Traits::hi_greater( a_hi[k], b_lo ) );
+    } else {
+        for( std::size_t k = 0; k < count; ++k )
+            mask[k] &= (unsigned char)(
+                ( ( b_lo < a_lo[k] ) | ( ( b_lo == a_lo[k] ) & ( b_id < a_id[k] ) ) ) &
+                Traits::hi_greater( b_hi, a_lo[k] ) );
+    }
+}
+
+const std::size_t soa_block_size = 64;
+
+// [p_begin,p_end) and [i_begin,i_end) must be sorted by `Traits::Compare(0)`
+template< class RandomAccessIter1, class RandomAccessIter2,
+          class Callback, class Traits >
+void one_way_scan_soa( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
+                       RandomAccessIter2 i_begin, RandomAccessIter2 i_end,
+                       Callback& callback, Traits, int last_dim,
+                       bool in_order )
+{
+    typedef typename Traits::NT NT;
+
+    const Box_soa< Traits > points( p_begin, p_end, last_dim );
+    const Box_soa< Traits > intervals( i_begin, i_end, last_dim );
+    const NT* p_lo = points.lo( 0 );
+    const NT* i_hi = intervals.hi( 0 );
+    unsigned char mask[soa_block_size];
+
+    std::size_t first = 0;
+    for( std::size_t j = 0; j < intervals.size(); ++j ) {
+        // look for the first box b with i.min <= p.min
+        while( first < points.size() &&
+               points.is_lo_less_lo( first, intervals, j, 0 ) )
+            ++first;
+
+        // look for all boxes with p.min < i.max
+        std::size_t last = first;
+        while( last < points.size() && Traits::hi_greater( i_hi[j], p_lo[last] ) )
+            ++last;
+
+        for( std::size_t k0 = first; k0 < last; k0 += soa_block_size ) {
+            const std::size_t count = (std::min)( soa_block_size, last - k0 );
+            soa_intersection_mask( points, k0, count, intervals, j, last_dim, mask );
+            for( std::size_t k = 0; k < count; ++k ) {
+                if( !mask[k] )
+                    continue;
+                if( in_order )
+                    callback( *( p_begin + ( k0 + k ) ), *( i_begin + j ) );
+                else
+                    callback( *( i_begin + j ), *( p_begin + ( k0 + k ) ) );
+            }
+        }
+    }
+}
+
+// [p_begin,p_end) and [i_begin,i_end) must be sorted by `Traits::Compare(0)`
+template< class RandomAccessIter1, class RandomAccessIter2,
+          class Callback, class Traits >
+void modified_two_way_scan_soa(
+    RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
+    RandomAccessIter2 i_begin, RandomAccessIter2 i_end,
+    Callback& callback, Traits, int last_dim,
+    bool in_order )
+{
+    typedef typename Traits::NT NT;
+
+    const Box_soa< Traits > points( p_begin, p_end, last_dim );
+    const Box_soa< Traits > intervals( i_begin, i_end, last_dim );
+    const NT* p_lo = points.lo( 0 );
+    const NT* p_hi = points.hi( 0 );
+    const NT* i_lo = intervals.lo( 0 );
+    const NT* i_hi = intervals.hi( 0 );
+    unsigned char mask[soa_block_size];
+
+    std::size_t p = 0, i = 0;
+    while( i < intervals.size() && p < points.size() ) {
+        if( intervals.is_lo_less_lo( i, points, p, 0 ) ) {
+            std::size_t last = p;
+            while( last < points.size() && Traits::hi_greater( i_hi[i], p_lo[last] ) )
+                ++last;
+            for( std::size_t k0 = p; k0 < last; k0 += soa_block_size ) {
+                const std::size_t count = (std::min)( soa_block_size, last - k0 );
+                soa_intersection_mask( points, k0, count, intervals, i, last_dim, mask );
+                soa_contains_lo_point_mask( points, k0, count, intervals, i,
+                                            last_dim, false, mask );
+                for( std::size_t k = 0; k < count; ++k ) {
+                    if( !mask[k] )
+                        continue;
+                    if( in_order )
+                        callback( *( p_begin + ( k0 + k ) ), *( i_begin + i ) );
+                    else
+                        callback( *( i_begin + i ), *( p_begin + ( k0 + k ) ) );
+                }
+            }
+            ++i;
+        } else {
+            std::size_t last = i;
+            while( last < intervals.size() && Traits::hi_greater( p_hi[p], i_lo[last] ) )
+                ++last;
+            for( std::size_t k0 = i; k0 < last; k0 += soa_block_size ) {
+                const std::size_t count = (std::min)( soa_block_size, last - k0 );
+                soa_intersection_mask( intervals, k0, count, points, p, last_dim, mask );
+                soa_contains_lo_point_mask( intervals, k0, count, points, p,
+                                            last_dim, true, mask );
+                for( std::size_t k = 0; k < count; ++k ) {
+                    if( !mask[k] )
+                        continue;
+                    if( in_order )
+                        callback( *( p_begin + p ), *( i_begin + ( k0 + k ) ) );
+                    else
+                        callback( *( i_begin + ( k0 + k ) ), *( p_begin + p ) );
+                }
+            }
+            ++p;
+        }
+    }
+}
+
 template< class RandomAccessIter1, class RandomAccessIter2,
           class Callback, class Traits >
 void one_way_scan( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
@@ -96,6 +324,15 @@ void one_way_scan( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
     std::sort( p_begin, p_end, Compare( 0 ) );
     std::sort( i_begin, i_end, Compare( 0 ) );
 
+    if constexpr( Is_soa_scannable< Traits >::value ) {
+        if( std::distance( p_begin, p_end ) >= soa_scan_cutoff &&
+            std::distance( i_begin, i_end ) >= soa_scan_cutoff ) {
+            one_way_scan_soa( p_begin, p_end, i_begin, i_end,
+                              callback, Traits(), last_dim, in_order );
+            return;
+        }
+    }
+
     // for each box viewed as interval i
     for( RandomAccessIter2 i = i_begin; i != i_end; ++i ) {
         // look for the first box b with i.min <= p.min
@@ -136,6 +373,15 @@ void modified_two_way_scan(
     std::sort( p_begin, p_end, Compare( 0 ) );
     std::sort( i_begin, i_end, Compare( 0 ) );
 
+    if constexpr( Is_soa_scannable< Traits >::value ) {
+        if( std::distance( p_begin, p_end ) >= soa_scan_cutoff &&
+            std::distance( i_begin, i_end ) >= soa_scan_cutoff ) {
+            modified_two_way_scan_soa( p_begin, p_end, i_begin, i_end,
+                                       callback, Traits(), last_dim, in_order );
+            return;
+        }
+    }
+
     // for each box viewed as interval
     while( i_begin != i_end && p_begin != p_end ) {
         if( Traits::is_lo_less_lo( *i_begin, *p_begin, 0 ) ) {
@@ -484,6 +730,76 @@ void segment_tree( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
                   callback, traits, cutoff, dim, in_order );
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+
+// below this number of boxes in either range, `parallel_segment_tree()`
+// falls back to the sequential `segment_tree()`
+const std::ptrdiff_t parallel_segment_tree_cutoff = 4096;
+
+// Same recursion as `segment_tree()`, but the two halves of the split
+// in `dim` are processed concurrently. The right half works on its own copy
+// of the intervals since the left half reorders them in place.
+template< class RandomAccessIter1, class RandomAccessIter2,
+          class Callback, class T, class Predicate_traits >
+void parallel_segment_tree( RandomAccessIter1 p_begin, RandomAccessIter1 p_end,
+                            RandomAccessIter2 i_begin, RandomAccessIter2 i_end,
+                            T lo, T hi,
+                            Callback callback, Predicate_traits traits,
+                            std::ptrdiff_t cutoff, int dim, bool in_order)
+{
+    typedef typename Predicate_traits::Spanning   Spanning;
+    typedef typename Predicate_traits::Lo_less    Lo_less;
+    typedef typename Predicate_traits::Hi_greater Hi_greater;
+    typedef typename std::iterator_traits<RandomAccessIter2>::value_type Interval;
+
+    const T inf = box_limits< T >::inf();
+    const T sup = box_limits< T >::sup();
+
+    const std::ptrdiff_t parallel_cutoff =
+      (std::max)( cutoff, parallel_segment_tree_cutoff );
+    if( dim == 0 || lo >= hi ||
+        std::distance( p_begin, p_end ) < parallel_cutoff ||
+        std::distance( i_begin, i_end ) < parallel_cutoff )
+    {
+        segment_tree( p_begin, p_end, i_begin, i_end, lo, hi,
+                      callback, traits, cutoff, dim, in_order );
+        return;
+    }
+
+    RandomAccessIter2 i_span_end = lo == inf || hi == sup ? i_begin :
+        std::partition( i_begin, i_end, Spanning( lo, hi, dim ) );
+
+    if( i_begin != i_span_end ) {
+        parallel_segment_tree( p_begin, p_end, i_begin, i_span_end, inf, sup,
+                               callback, traits, cutoff, dim - 1,  in_order );
+        parallel_segment_tree( i_begin, i_span_end, p_begin, p_end, inf, sup,
+                               callback, traits, cutoff, dim - 1, !in_order );
+    }
+
+    T mi;
+    RandomAccessIter1 p_mid = split_points( p_begin, p_end, traits, dim, mi );
+
+    if( p_mid == p_begin || p_mid == p_end )  {
+        modified_two_way_scan( p_begin, p_end, i_span_end, i_end,
+                               callback, traits, dim, in_order );
+        return;
+    }
+
+    std::vector< Interval > right_intervals;
+    std::copy_if( i_span_end, i_end, std::back_inserter( right_intervals ),
+                  Hi_greater( mi, dim ) );
+    RandomAccessIter2 i_mid = std::partition( i_span_end, i_end, Lo_less( mi, dim ) );
+
+    tbb::task_group g;
+    g.run( [=]{ parallel_segment_tree( p_begin, p_mid, i_span_end, i_mid, lo, mi,
+                                       callback, traits, cutoff, dim, in_order ); } );
+    parallel_segment_tree( p_mid, p_end, right_intervals.begin(), right_intervals.end(),
+                           mi, hi, callback, traits, cutoff, dim, in_order );
+    g.wait();
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
 #if CGAL_BOX_INTERSECTION_DEBUG
  #undef CGAL_BOX_INTERSECTION_DUMP
 #endif
@@ -191,8 +191,8 @@ void box_intersection_segment_tree_d(
 
         // Specify "copy by value" otherwise the values of iterators for next (i,j) iterations
         // become shared with different lambdas being run in parallel, and things go wrong
-        g.run([=]{ Box_intersection_d::segment_tree( r1_start, r1_end, r2_start, r2_end,
-                                                     inf, sup, callback, traits, cutoff, dim, in_order); });
+        g.run([=]{ Box_intersection_d::parallel_segment_tree( r1_start, r1_end, r2_start, r2_end,
+                                                              inf, sup, callback, traits, cutoff, dim, in_order); });
       }
     }
 
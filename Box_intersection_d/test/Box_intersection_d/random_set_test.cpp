@@ -20,6 +20,14 @@
 #include <iostream>
 #include <iterator>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+#endif
+
 #include "util.h"
 
 static unsigned int failed = 0;
@@ -92,7 +100,30 @@ test_n( unsigned int n,
     std::cout << "got " << callback2.get_counter() << " intersections in "
               << timer.time() << " seconds." << std::endl;
 
-    if( callback1.get_counter() != callback2.get_counter() ||
+    bool parallel_failed = false;
+#ifdef CGAL_LINKED_WITH_TBB
+    std::cout << "parallel segment tree ... " << std::flush;
+    std::atomic<unsigned int> c3(0);
+    timer.reset();
+    timer.start();
+    CGAL::box_intersection_custom_predicates_d<CGAL::Parallel_tag>(
+                                      boxes1.begin(), boxes1.end(),
+                                      boxes2.begin(), boxes2.end(),
+                                      [&c3]( const typename Uti1::Box& a,
+                                             const typename Uti1::Box& b )
+                                      {
+                                        Uti1::assert_intersection( a, b );
+                                        ++c3;
+                                      },
+                                      typename Uti1::Traits(),
+                                      cutoff, setting );
+    timer.stop();
+    std::cout << "got " << c3 << " intersections in "
+              << timer.time() << " seconds." << std::endl;
+    parallel_failed = ( c3 != callback2.get_counter() );
+#endif
+
+    if( callback1.get_counter() != callback2.get_counter() || parallel_failed ||
         ( n < allpairs_max && callback0.get_counter() != callback1.get_counter() ) )
     {
         ++failed;
@@ -101,6 +132,56 @@ test_n( unsigned int n,
         std::cout << "--- passed --- " << std::endl;
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+// large enough for the parallel segment tree to split its ranges
+// between tasks: compares the pairs reported in parallel and sequentially
+static void
+test_parallel_n( unsigned int n,
+                 CGAL::Box_intersection_d::Setting setting )
+{
+    typedef std::pair< std::size_t, std::size_t > Id_pair;
+    typename Uti1::Box_container boxes1, boxes2;
+    std::cout << "generating random box sets with size " << n
+              << " ... " << std::endl;
+    Uti1::fill_boxes( n, boxes1 );
+    if( setting == CGAL::Box_intersection_d::BIPARTITE )
+        Uti1::fill_boxes( n, boxes2 );
+    else
+        boxes2 = boxes1;
+
+    std::vector< Id_pair > sequential_pairs, parallel_pairs;
+    std::mutex mutex;
+    auto id_pair = []( const typename Uti1::Box& a, const typename Uti1::Box& b )
+                   { return std::make_pair( (std::min)( a.id(), b.id() ),
+                                            (std::max)( a.id(), b.id() ) ); };
+    std::cout << "segment tree ... " << std::flush;
+    CGAL::box_intersection_custom_predicates_d<CGAL::Sequential_tag>(
+                   boxes1.begin(), boxes1.end(), boxes2.begin(), boxes2.end(),
+                   [&]( const typename Uti1::Box& a, const typename Uti1::Box& b )
+                   { sequential_pairs.push_back( id_pair( a, b ) ); },
+                   typename Uti1::Traits(), n / 50, setting );
+    std::cout << "got " << sequential_pairs.size() << " intersections." << std::endl;
+    std::cout << "parallel segment tree ... " << std::flush;
+    CGAL::box_intersection_custom_predicates_d<CGAL::Parallel_tag>(
+                   boxes1.begin(), boxes1.end(), boxes2.begin(), boxes2.end(),
+                   [&]( const typename Uti1::Box& a, const typename Uti1::Box& b )
+                   {
+                     std::lock_guard<std::mutex> lock( mutex );
+                     parallel_pairs.push_back( id_pair( a, b ) );
+                   },
+                   typename Uti1::Traits(), n / 50, setting );
+    std::cout << "got " << parallel_pairs.size() << " intersections." << std::endl;
+
+    std::sort( sequential_pairs.begin(), sequential_pairs.end() );
+    std::sort( parallel_pairs.begin(), parallel_pairs.end() );
+    if( sequential_pairs != parallel_pairs ) {
+        ++failed;
+        std::cout << "!! failed !! " << std::endl;
+    } else
+        std::cout << "--- passed --- " << std::endl;
+}
+#endif
+
 void operator()() {
     std::cout << "-------------------------" << std::endl;
     std::cout << "DIM = " << DIM << std::endl;
@@ -111,6 +192,12 @@ void operator()() {
         std::cout << "complete case: " << std::endl;
         test_n( n, CGAL::Box_intersection_d::COMPLETE );
     }
+#ifdef CGAL_LINKED_WITH_TBB
+    std::cout << "bipartite case, parallel: " << std::endl;
+    test_parallel_n( 30000, CGAL::Box_intersection_d::BIPARTITE );
+    std::cout << "complete case, parallel: " << std::endl;
+    test_parallel_n( 30000, CGAL::Box_intersection_d::COMPLETE );
+#endif
 }
 
 }; // end struct  test
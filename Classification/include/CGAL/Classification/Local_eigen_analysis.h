@@ -27,17 +27,13 @@
 #include <CGAL/array.h>
 #include <CGAL/PCA_util.h>
 #include <CGAL/boost/graph/properties.h>
+#include <CGAL/property_map.h>
+#include <CGAL/for_each.h>
 
 #include <boost/graph/graph_traits.hpp>
 
-#ifdef CGAL_LINKED_WITH_TBB
-#include <tbb/parallel_for.h>
-#include <tbb/blocked_range.h>
-#include <tbb/scalable_allocator.h>
 #include <mutex>
 
-#endif // CGAL_LINKED_WITH_TBB
-
 namespace CGAL {
 
 namespace Classification {
@@ -61,136 +57,6 @@ public:
 
 private:
 
-#ifdef CGAL_LINKED_WITH_TBB
-  template <typename PointRange, typename PointMap, typename NeighborQuery, typename DiagonalizeTraits>
-  class Compute_eigen_values
-  {
-    Local_eigen_analysis& m_eigen;
-    const PointRange& m_input;
-    PointMap m_point_map;
-    const NeighborQuery& m_neighbor_query;
-    float& m_mean_range;
-    std::mutex& m_mutex;
-
-  public:
-
-    Compute_eigen_values (Local_eigen_analysis& eigen,
-                          const PointRange& input,
-                          PointMap point_map,
-                          const NeighborQuery& neighbor_query,
-                          float& mean_range,
-                          std::mutex& mutex)
-      : m_eigen (eigen), m_input (input), m_point_map (point_map),
-        m_neighbor_query (neighbor_query), m_mean_range (mean_range), m_mutex (mutex)
-    { }
-
-    void operator()(const tbb::blocked_range<std::size_t>& r) const
-    {
-      std::vector<std::size_t> neighbors;
-      for (std::size_t i = r.begin(); i != r.end(); ++ i)
-      {
-        neighbors.clear();
-        m_neighbor_query (get(m_point_map, *(m_input.begin()+i)), std::back_inserter (neighbors));
-
-        std::vector<typename PointMap::value_type> neighbor_points;
-        neighbor_points.reserve(neighbors.size());
-        for (std::size_t j = 0; j < neighbors.size(); ++ j)
-          neighbor_points.push_back (get(m_point_map, *(m_input.begin()+neighbors[j])));
-
-        m_mutex.lock();
-        m_mean_range += float(CGAL::sqrt
-                              (CGAL::squared_distance (get(m_point_map, *(m_input.begin() + i)),
-                                                       get(m_point_map, *(m_input.begin() + neighbors.back())))));
-        m_mutex.unlock();
-
-        m_eigen.compute<typename PointMap::value_type,
-                        DiagonalizeTraits> (i, get(m_point_map, *(m_input.begin()+i)), neighbor_points);
-      }
-    }
-
-  };
-
-  template <typename FaceListGraph, typename NeighborQuery, typename DiagonalizeTraits>
-  class Compute_eigen_values_graph
-  {
-    using face_descriptor = typename boost::graph_traits<FaceListGraph>::face_descriptor;
-    using face_index = typename boost::property_map<FaceListGraph, CGAL::face_index_t>::type::value_type;
-    using face_iterator = typename boost::graph_traits<FaceListGraph>::face_iterator;
-
-    Local_eigen_analysis& m_eigen;
-    const FaceListGraph& m_input;
-    const NeighborQuery& m_neighbor_query;
-    float& m_mean_range;
-    std::mutex& m_mutex;
-
-  public:
-
-    Compute_eigen_values_graph (Local_eigen_analysis& eigen,
-                                const FaceListGraph& input,
-                                const NeighborQuery& neighbor_query,
-                                float& mean_range,
-                                std::mutex& mutex)
-      : m_eigen (eigen), m_input (input),
-        m_neighbor_query (neighbor_query), m_mean_range (mean_range), m_mutex (mutex)
-    { }
-
-    void operator()(const tbb::blocked_range<std::size_t>& r) const
-    {
-      face_iterator begin = faces(m_input).first;
-      for (std::size_t i = r.begin(); i != r.end(); ++ i)
-      {
-        face_descriptor fd = *(begin + i);
-        std::vector<face_index> neighbors;
-        m_neighbor_query (fd, std::back_inserter (neighbors));
-
-        m_mutex.lock();
-        m_mean_range += m_eigen.face_radius(fd, m_input);
-        m_mutex.unlock();
-
-        m_eigen.compute_triangles<FaceListGraph, DiagonalizeTraits>
-          (m_input, fd, neighbors);
-      }
-    }
-
-  };
-#endif
-
-  template <typename ClusterRange, typename DiagonalizeTraits>
-  class Compute_clusters_eigen_values
-  {
-    Local_eigen_analysis& m_eigen;
-    const ClusterRange& m_input;
-
-  public:
-
-    Compute_clusters_eigen_values (Local_eigen_analysis& eigen,
-                                   const ClusterRange& input)
-      : m_eigen (eigen), m_input (input)
-    { }
-
-#ifdef CGAL_LINKED_WITH_TBB
-    void operator()(const tbb::blocked_range<std::size_t>& r) const
-    {
-      for (std::size_t i = r.begin(); i != r.end(); ++ i)
-        apply (i);
-    }
-#endif
-
-    inline void apply (std::size_t i) const
-    {
-      using Cluster = typename ClusterRange::value_type;
-      using Item = typename Cluster::Item;
-      const Cluster& cluster = m_input[i];
-
-      std::vector<typename ClusterRange::value_type::Item> points;
-      for (std::size_t j = 0; j < cluster.size(); ++ j)
-        points.push_back (cluster[j]);
-
-      m_eigen.compute<Item, DiagonalizeTraits> (i, Item(0.,0.,0.), points);
-    }
-
-  };
-
   using float3 = std::array<float, 3>;
   using float2 = std::array<float, 2>;
   using cfloat2 = std::array<compressed_float, 2>;
@@ -226,8 +92,9 @@ public:
     is `CGAL::Point_3`.
     \tparam NeighborQuery model of `NeighborQuery`
     \tparam ConcurrencyTag enables sequential versus parallel
-    algorithm. Possible values are `Parallel_tag` (default value if \cgal
-    is linked with TBB) or `Sequential_tag` (default value otherwise).
+    algorithm. Possible values are `Parallel_tag` (which requires TBB or OpenMP,
+    and is the default value if \cgal is linked with TBB) or `Sequential_tag`
+    (default value otherwise).
     \tparam DiagonalizeTraits model of `DiagonalizeTraits` used for
     matrix diagonalization. It can be omitted if Eigen 3 (or greater)
     is available and `CGAL_EIGEN3_ENABLED` is defined. In that case,
@@ -264,37 +131,31 @@ public:
 
     out.m_content->mean_range = 0.;
 
-#ifndef CGAL_LINKED_WITH_TBB
-    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
-                               "Parallel_tag is enabled but TBB is unavailable.");
-#else
-    if (std::is_convertible<ConcurrencyTag,Parallel_tag>::value)
-    {
-      std::mutex mutex;
-      Compute_eigen_values<PointRange, PointMap, NeighborQuery, DiagonalizeTraits>
-        f(out, input, point_map, neighbor_query, out.m_content->mean_range, mutex);
-      tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size ()), f);
-    }
-    else
-#endif
-    {
-      for (std::size_t i = 0; i < input.size(); i++)
-      {
-        std::vector<std::size_t> neighbors;
-        neighbor_query (get(point_map, *(input.begin()+i)), std::back_inserter (neighbors));
-
-        std::vector<typename PointMap::value_type> neighbor_points;
-        for (std::size_t j = 0; j < neighbors.size(); ++ j)
-          neighbor_points.push_back (get(point_map, *(input.begin()+neighbors[j])));
-
-        out.m_content->mean_range += float(CGAL::sqrt (CGAL::squared_distance
-                                          (get(point_map, *(input.begin() + i)),
-                                           get(point_map, *(input.begin() + neighbors.back())))));
-
-        out.compute<typename PointMap::value_type, DiagonalizeTraits>
-          (i, get(point_map, *(input.begin()+i)), neighbor_points);
-      }
-    }
+    std::mutex mutex;
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t> (0, input.size()),
+       [&](const std::size_t& i) -> bool
+       {
+         std::vector<std::size_t> neighbors;
+         neighbor_query (get(point_map, *(input.begin()+i)), std::back_inserter (neighbors));
+
+         std::vector<typename PointMap::value_type> neighbor_points;
+         neighbor_points.reserve (neighbors.size());
+         for (std::size_t j = 0; j < neighbors.size(); ++ j)
+           neighbor_points.push_back (get(point_map, *(input.begin()+neighbors[j])));
+
+         float range = float(CGAL::sqrt (CGAL::squared_distance
+                                         (get(point_map, *(input.begin() + i)),
+                                          get(point_map, *(input.begin() + neighbors.back())))));
+         {
+           std::lock_guard<std::mutex> lock (mutex);
+           out.m_content->mean_range += range;
+         }
+
+         out.compute<typename PointMap::value_type, DiagonalizeTraits>
+           (i, get(point_map, *(input.begin()+i)), neighbor_points);
+         return true;
+       });
     out.m_content->mean_range /= input.size();
 
     return out;
@@ -308,8 +169,9 @@ public:
     \tparam FaceListGraph model of `FaceListGraph`.
     \tparam NeighborQuery model of `NeighborQuery`
     \tparam ConcurrencyTag enables sequential versus parallel
-    algorithm. Possible values are `Parallel_tag` (default value if \cgal
-    is linked with TBB) or `Sequential_tag` (default value otherwise).
+    algorithm. Possible values are `Parallel_tag` (which requires TBB or OpenMP,
+    and is the default value if \cgal is linked with TBB) or `Sequential_tag`
+    (default value otherwise).
     \tparam DiagonalizeTraits model of `DiagonalizeTraits` used for
     matrix diagonalization. It can be omitted: if Eigen 3 (or greater)
     is available and `CGAL_EIGEN3_ENABLED` is defined then an overload
@@ -352,33 +214,24 @@ public:
 
     out.m_content->mean_range = 0.;
 
-#ifndef CGAL_LINKED_WITH_TBB
-    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
-                               "Parallel_tag is enabled but TBB is unavailable.");
-#else
-    if (std::is_convertible<ConcurrencyTag,Parallel_tag>::value)
-    {
-      std::mutex mutex;
-      Compute_eigen_values_graph<FaceListGraph, NeighborQuery, DiagonalizeTraits>
-        f(out, input, neighbor_query, out.m_content->mean_range, mutex);
-
-      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, range.size()), f);
-    }
-    else
-#endif
-    {
-      for(face_descriptor fd : range)
-      {
-        std::vector<face_index> neighbors;
-        neighbor_query (fd, std::back_inserter (neighbors));
-
-        out.m_content->mean_range += out.face_radius(fd, input);
-
-        out.compute_triangles<FaceListGraph, DiagonalizeTraits>
-          (input, fd, neighbors);
-
-      }
-    }
+    std::mutex mutex;
+    CGAL::for_each<ConcurrencyTag>
+      (range,
+       [&](face_descriptor fd) -> bool
+       {
+         std::vector<face_index> neighbors;
+         neighbor_query (fd, std::back_inserter (neighbors));
+
+         float radius = out.face_radius(fd, input);
+         {
+           std::lock_guard<std::mutex> lock (mutex);
+           out.m_content->mean_range += radius;
+         }
+
+         out.compute_triangles<FaceListGraph, DiagonalizeTraits>
+           (input, fd, neighbors);
+         return true;
+       });
 
     out.m_content->mean_range /= range.size();
     return out;
@@ -392,8 +245,9 @@ public:
     `RandomAccessIterator` and its value type is the key type of
     `PointMap`.
     \tparam ConcurrencyTag enables sequential versus parallel
-    algorithm. Possible values are `Parallel_tag` (default value if \cgal
-    is linked with TBB) or `Sequential_tag` (default value otherwise).
+    algorithm. Possible values are `Parallel_tag` (which requires TBB or OpenMP,
+    and is the default value if \cgal is linked with TBB) or `Sequential_tag`
+    (default value otherwise).
     \tparam DiagonalizeTraits model of `DiagonalizeTraits` used for
     matrix diagonalization. It can be omitted: if Eigen 3 (or greater)
     is available and `CGAL_EIGEN3_ENABLED` is defined then an overload
@@ -426,24 +280,22 @@ public:
 
     out.m_content->mean_range = 0.;
 
-    Compute_clusters_eigen_values<ClusterRange, DiagonalizeTraits>
-    f(out, input);
+    using Cluster = typename ClusterRange::value_type;
+    using Item = typename Cluster::Item;
 
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t> (0, input.size()),
+       [&](const std::size_t& i) -> bool
+       {
+         const Cluster& cluster = input[i];
 
-#ifndef CGAL_LINKED_WITH_TBB
-    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
-                               "Parallel_tag is enabled but TBB is unavailable.");
-#else
-    if (std::is_convertible<ConcurrencyTag,Parallel_tag>::value)
-    {
-      tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size ()), f);
-    }
-    else
-#endif
-    {
-      for (std::size_t i = 0; i < input.size(); ++ i)
-        f.apply (i);
-    }
+         std::vector<Item> points;
+         for (std::size_t j = 0; j < cluster.size(); ++ j)
+           points.push_back (cluster[j]);
+
+         out.compute<Item, DiagonalizeTraits> (i, Item(0.,0.,0.), points);
+         return true;
+       });
     return out;
   }
 
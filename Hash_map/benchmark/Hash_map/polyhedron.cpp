@@ -46,9 +46,9 @@ Point_3 lookup(Map& sm,vertex_descriptor vh){
     return Point_3();
 }
 
-template <typename X, typename Y>
-Point_3 lookup(CGAL::Unique_hash_map<X,Y>& sm,vertex_descriptor vh){
-    const CGAL::Unique_hash_map<X,Y>& const_sm = sm;
+template <typename X, typename Y, typename H, typename A, typename T>
+Point_3 lookup(CGAL::Unique_hash_map<X,Y,H,A,T>& sm,vertex_descriptor vh){
+    const CGAL::Unique_hash_map<X,Y,H,A,T>& const_sm = sm;
     return const_sm[vh];
 }
 
@@ -120,6 +120,8 @@ void  fct(int ii, int jj)
   typedef std::unordered_map<vertex_descriptor,Point_3> SUM;
   typedef boost::unordered_map<vertex_descriptor,Point_3> BUM;
   typedef CGAL::Unique_hash_map<vertex_descriptor, Point_3> UHM;
+  typedef CGAL::Unique_hash_map<vertex_descriptor, Point_3, CGAL::Handle_hash_function,
+                                CGAL_ALLOCATOR(Point_3), CGAL::Flat_hash_map_tag> FUHM;
 
   Mesh mesh1;
   VPM vpm1 = get(CGAL::vertex_point,mesh1);
@@ -141,7 +143,9 @@ void  fct(int ii, int jj)
   if(temp != res){ std::cout << temp << " != " << res << std::endl;}
   temp = fct<BUM>(ii,jj, V1,V2, vpm1, "boost::unordered_map\t|\t\t| " );
   if(temp != res){ std::cout << temp << " != " << res << std::endl;}
-  temp = fct<UHM>(ii,jj,V1,V2, vpm1, "CGAL::Unique_hash_map\t| master\t| " );
+  temp = fct<UHM>(ii,jj,V1,V2, vpm1, "CGAL::Unique_hash_map\t| chained\t| " );
+  if(temp != res){ std::cout << temp << " != " << res << std::endl;}
+  temp = fct<FUHM>(ii,jj,V1,V2, vpm1, "CGAL::Unique_hash_map\t| flat\t\t| " );
   if(temp != res){ std::cout << temp << " != " << res << std::endl;}
 }
 
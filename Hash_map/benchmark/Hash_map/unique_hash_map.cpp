@@ -0,0 +1,187 @@
+// Compares the chained and the flat implementations of CGAL::Unique_hash_map
+// (and std::unordered_map) with handles as keys, on the access patterns of
+// the packages that use them:
+// - index: number the elements in the order of iteration (Polyhedron IO, Arr_*_index_map),
+//   then read the numbers in the order of incidences (e.g. the vertices of the faces)
+// - mark: set marks while traversing the elements in incidence order,
+//   testing whether an element is already marked (Nef_3, Boolean_set_operations_2)
+// - miss: look up elements that are not in the map
+//
+// usage: unique_hash_map [number of points]
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Polyhedron_3.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/convex_hull_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Unique_hash_map.h>
+#include <CGAL/Timer.h>
+
+#include <unordered_map>
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel  K;
+typedef K::Point_3                                           Point_3;
+typedef CGAL::Polyhedron_3<K>                                Polyhedron;
+typedef CGAL::Delaunay_triangulation_3<K>                    Delaunay;
+
+typedef CGAL::Timer                                          Timer;
+
+template <typename Handle, typename Data>
+using Chained_map = CGAL::Unique_hash_map<Handle, Data>;
+
+template <typename Handle, typename Data>
+using Flat_map = CGAL::Unique_hash_map<Handle, Data, CGAL::Handle_hash_function,
+                                       CGAL_ALLOCATOR(Data), CGAL::Flat_hash_map_tag>;
+
+// same interface as `Unique_hash_map` for the operations used below
+template <typename Handle, typename Data>
+struct Std_map
+{
+  std::unordered_map<Handle, Data> m;
+  Data def;
+  Std_map(const Data& d) : def(d) {}
+  Data& operator[](const Handle& h) { return m.emplace(h, def).first->second; }
+  bool is_defined(const Handle& h) const { return m.find(h) != m.end(); }
+};
+
+template <template <typename, typename> class Map, typename Handle>
+void run(const std::string& name,
+         const std::vector<Handle>& elements,
+         const std::vector<Handle>& incidences,
+         const std::vector<Handle>& others,
+         int repeat)
+{
+  Timer index, mark, miss;
+  std::size_t sum = 0;
+
+  for(int r = 0; r < repeat; ++r)
+  {
+    index.start();
+    Map<Handle, std::size_t> indices(0);
+    std::size_t i = 0;
+    for(const Handle& h : elements)
+      indices[h] = i++;
+    for(const Handle& h : incidences)
+      sum += indices[h];
+    index.stop();
+
+    mark.start();
+    Map<Handle, bool> marks(false);
+    for(const Handle& h : incidences)
+      if(!marks.is_defined(h))
+        marks[h] = true;
+    mark.stop();
+
+    miss.start();
+    for(const Handle& h : others)
+      sum += std::size_t(indices.is_defined(h));
+    miss.stop();
+  }
+
+  std::cerr << name << "\t| " << index.time() << " sec.\t| " << mark.time()
+            << " sec.\t| " << miss.time() << " sec.\t(" << sum << ")" << std::endl;
+}
+
+template <typename Handle>
+void run_all(const std::string& title,
+             const std::vector<Handle>& elements,
+             const std::vector<Handle>& incidences,
+             const std::vector<Handle>& others,
+             int repeat)
+{
+  std::cerr << std::endl << title << ": " << elements.size() << " keys, "
+            << incidences.size() << " incidences (repeated " << repeat << " times)" << std::endl;
+  std::cerr << "Map\t\t| Index\t\t| Mark\t\t| Miss" << std::endl;
+  run<Std_map>("std::unordered_map", elements, incidences, others, repeat);
+  run<Chained_map>("chained\t", elements, incidences, others, repeat);
+  run<Flat_map>("flat\t", elements, incidences, others, repeat);
+}
+
+void polyhedron(const std::vector<Point_3>& points, int repeat)
+{
+  typedef Polyhedron::Vertex_handle    Vertex_handle;
+  typedef Polyhedron::Halfedge_handle  Halfedge_handle;
+
+  Polyhedron P, Q;
+  CGAL::convex_hull_3(points.begin(), points.end(), P);
+  CGAL::convex_hull_3(points.begin(), points.begin() + points.size() / 2, Q);
+
+  std::vector<Vertex_handle> vertices, incident_vertices, others;
+  for(Vertex_handle v = P.vertices_begin(); v != P.vertices_end(); ++v)
+    vertices.push_back(v);
+  for(Halfedge_handle h = P.halfedges_begin(); h != P.halfedges_end(); ++h)
+    incident_vertices.push_back(h->vertex());
+  for(Vertex_handle v = Q.vertices_begin(); v != Q.vertices_end(); ++v)
+    others.push_back(v);
+
+  run_all("Polyhedron_3 vertices", vertices, incident_vertices, others, repeat);
+
+  std::vector<Halfedge_handle> halfedges, next_halfedges, other_halfedges;
+  for(Halfedge_handle h = P.halfedges_begin(); h != P.halfedges_end(); ++h)
+  {
+    halfedges.push_back(h);
+    next_halfedges.push_back(h->opposite()->next());
+  }
+  for(Halfedge_handle h = Q.halfedges_begin(); h != Q.halfedges_end(); ++h)
+    other_halfedges.push_back(h);
+
+  run_all("Polyhedron_3 halfedges", halfedges, next_halfedges, other_halfedges, repeat);
+}
+
+void triangulation(const std::vector<Point_3>& points, int repeat)
+{
+  typedef Delaunay::Vertex_handle  Vertex_handle;
+  typedef Delaunay::Cell_handle    Cell_handle;
+
+  Delaunay T(points.begin(), points.end());
+  Delaunay U(points.begin(), points.begin() + points.size() / 2);
+
+  std::vector<Vertex_handle> vertices, incident_vertices, others;
+  for(Vertex_handle v : T.all_vertex_handles())
+    vertices.push_back(v);
+  for(Cell_handle c : T.all_cell_handles())
+    for(int i = 0; i < 4; ++i)
+      incident_vertices.push_back(c->vertex(i));
+  for(Vertex_handle v : U.all_vertex_handles())
+    others.push_back(v);
+
+  run_all("Delaunay_triangulation_3 vertices", vertices, incident_vertices, others, repeat);
+
+  std::vector<Cell_handle> cells, neighbors, other_cells;
+  for(Cell_handle c : T.all_cell_handles())
+  {
+    cells.push_back(c);
+    for(int i = 0; i < 4; ++i)
+      neighbors.push_back(c->neighbor(i));
+  }
+  for(Cell_handle c : U.all_cell_handles())
+    other_cells.push_back(c);
+
+  run_all("Delaunay_triangulation_3 cells", cells, neighbors, other_cells, repeat);
+}
+
+int main(int argc, char* argv[])
+{
+  const int n = (argc > 1) ? std::atoi(argv[1]) : 100000;
+
+  std::vector<Point_3> points;
+  CGAL::Random_points_in_sphere_3<Point_3> gen(1.);
+  std::copy_n(gen, n, std::back_inserter(points));
+  std::vector<Point_3> sphere_points;
+  CGAL::Random_points_on_sphere_3<Point_3> sgen(1.);
+  std::copy_n(sgen, n, std::back_inserter(sphere_points));
+
+  for(int size : { n / 100, n })
+  {
+    if(size == 0)
+      continue;
+    const int repeat = (std::max)(1, n / size);
+    polyhedron(std::vector<Point_3>(sphere_points.begin(), sphere_points.begin() + size), repeat);
+    triangulation(std::vector<Point_3>(points.begin(), points.begin() + size), repeat);
+  }
+
+  return EXIT_SUCCESS;
+}
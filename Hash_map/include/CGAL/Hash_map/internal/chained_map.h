@@ -16,6 +16,7 @@
 #ifndef CGAL_HASH_MAP_INTERNAL_CHAINED_MAP_H
 #define CGAL_HASH_MAP_INTERNAL_CHAINED_MAP_H
 
+#include <CGAL/assertions.h>
 #include <CGAL/memory.h>
 #include <iostream>
 #include <limits>
@@ -242,7 +243,11 @@ chained_map<T, Allocator>::chained_map(std::size_t n, const T& d)
 
 template <typename T, typename Allocator>
 chained_map<T, Allocator>::chained_map(const chained_map<T, Allocator>& D)
+  : table(nullptr), alloc(D.alloc), reserved_size(D.reserved_size), def(D.def)
 {
+  if(!D.table)
+    return;
+
   init_table(D.table_size);
 
   for(Item p = D.table; p < D.free; ++p)
@@ -268,7 +273,14 @@ chained_map<T, Allocator>::chained_map(chained_map<T, Allocator>&& D)
 template <typename T, typename Allocator>
 chained_map<T, Allocator>& chained_map<T, Allocator>::operator=(const chained_map<T, Allocator>& D)
 {
+  if(this == &D)
+    return *this;
+
   clear();
+  reserved_size = D.reserved_size;
+  def = D.def;
+  if(!D.table)
+    return *this;
 
   init_table(D.table_size);
 
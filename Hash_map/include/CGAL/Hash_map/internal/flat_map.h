@@ -0,0 +1,417 @@
+// Copyright (c) 2026
+// GeometryFactory (France).  All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : GeometryFactory
+
+#ifndef CGAL_HASH_MAP_INTERNAL_FLAT_MAP_H
+#define CGAL_HASH_MAP_INTERNAL_FLAT_MAP_H
+
+#include <CGAL/assertions.h>
+#include <CGAL/memory.h>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace CGAL {
+
+namespace internal {
+
+// An open addressing hash table with the interface of `chained_map`.
+//
+// The table is an array of slots and an array of control bytes, one per
+// slot. A control byte is either `empty` (high bit set), or the 7 low bits
+// of the hashed key of the slot. The slots are grouped by `group_size`,
+// and a lookup compares the control bytes of a whole group at once against
+// the 7 bits of the searched key, so that only the slots whose control byte
+// matches are compared, and a group with an empty slot ends the search.
+// Groups are probed in triangular order, which visits all the groups
+// as their number is a power of two.
+//
+// Keys cannot be erased, hence there are no tombstones.
+
+template <typename T, typename Allocator = CGAL_ALLOCATOR(T) > class flat_map;
+template <typename T> class flat_map_elem;
+
+template <typename T>
+class flat_map_elem
+{
+  template<typename T2, typename Alloc> friend class flat_map;
+  std::size_t k; T i;
+
+public:
+  flat_map_elem(std::size_t x, const T& y) : k(x), i(y) {}
+  flat_map_elem(std::size_t x, T&& y) : k(x), i(std::move(y)) {}
+};
+
+template <typename T, typename Allocator>
+class flat_map
+{
+   typedef std::uint64_t Group;
+
+   static constexpr std::size_t group_size = sizeof(Group);
+   static constexpr unsigned char empty = 0x80;
+   static constexpr Group lsbs = 0x0101010101010101ull;
+   static constexpr Group msbs = 0x8080808080808080ull;
+
+   flat_map_elem<T>* slots;
+   unsigned char* ctrl;
+   std::size_t capacity;      // number of slots, a power of two, or 0
+   std::size_t nb_elements;
+   std::size_t max_elements;  // growth threshold
+
+   typedef std::allocator_traits<Allocator> Allocator_traits;
+   typedef typename Allocator_traits::template rebind_alloc<flat_map_elem<T> > allocator_type;
+   typedef typename Allocator_traits::template rebind_alloc<unsigned char> ctrl_allocator_type;
+
+   allocator_type alloc;
+   std::size_t reserved_size;
+   T def;
+
+public:
+   T& xdef() { return def; }
+   const T& cxdef() const { return def; }
+
+private:
+   // The unique hash values are often consecutive integers: mix them
+   // so that both the group index and the 7 bits stored in the control
+   // bytes depend on all the bits of the key.
+   static std::uint64_t mix(std::size_t x)
+   {
+     std::uint64_t h = std::uint64_t(x) * 0x9E3779B97F4A7C15ull;
+     return h ^ (h >> 32);
+   }
+
+   static unsigned char h2(std::uint64_t h) { return static_cast<unsigned char>(h & 0x7F); }
+   std::size_t h1(std::uint64_t h) const { return std::size_t(h >> 7) & (capacity / group_size - 1); }
+
+   Group load_group(std::size_t g) const
+   {
+     Group w;
+     std::memcpy(&w, ctrl + g * group_size, group_size);
+     return w;
+   }
+
+   // bit 7 of byte j is set iff byte j might be equal to `c`
+   // (there can be false positives, the keys are compared anyway)
+   static Group match(Group w, unsigned char c)
+   {
+     Group x = w ^ (lsbs * c);
+     return (x - lsbs) & ~x & msbs;
+   }
+
+   static Group match_empty(Group w) { return w & msbs; }
+
+   // position in the group of the slot of the lowest bit set in `m`
+   static std::size_t lowest_slot(Group m)
+   {
+#if defined(__GNUC__) || defined(__clang__)
+     std::size_t j = std::size_t(__builtin_ctzll(m)) / 8;
+#else
+     std::size_t j = 0;
+     while((m & 0xFF) == 0) { m >>= 8; ++j; }
+#endif
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+     return group_size - 1 - j;
+#else
+     return j;
+#endif
+   }
+
+   std::size_t next_group(std::size_t g, std::size_t step) const
+   { return (g + step) & (capacity / group_size - 1); }
+
+   void init_table(std::size_t n);
+   void rehash();
+   void destroy_table();
+
+   // inserts `x`, known not to be in the table, in a table that has room
+   flat_map_elem<T>* insert_new(std::size_t x, T&& y);
+   flat_map_elem<T>* insert_new(std::size_t x, const T& y);
+   std::size_t find_empty(std::uint64_t h) const;
+
+public:
+   static constexpr std::size_t min_size = 32;
+   static constexpr std::size_t default_size = 512;
+   typedef flat_map_elem<T>*  Item;
+
+   std::size_t index(Item it) const { return it->k; }
+   T&            inf(Item it) const { return it->i; }
+
+   flat_map(std::size_t n = default_size, const T& d = T());
+   flat_map(const flat_map<T, Allocator>& D);
+   flat_map& operator=(const flat_map<T, Allocator>& D);
+   flat_map(flat_map<T, Allocator>&& D)
+     noexcept(std::is_nothrow_move_constructible_v<Allocator> && std::is_nothrow_move_constructible_v<T>);
+   flat_map& operator=(flat_map<T, Allocator>&& D)
+     noexcept(std::is_nothrow_move_assignable_v<Allocator> && std::is_nothrow_move_assignable_v<T>);
+
+   void reserve(std::size_t n);
+   void clear();
+   ~flat_map() { destroy_table(); }
+
+   T& access(std::size_t x);
+   Item lookup(std::size_t x) const;
+   void statistics() const;
+};
+
+template <typename T, typename Allocator>
+void flat_map<T, Allocator>::init_table(std::size_t n)
+{
+  // room for `n` elements with a load factor of at most 3/4
+  std::size_t t = min_size;
+  while (t - t/4 < n) t <<= 1;
+
+  capacity = t;
+  nb_elements = 0;
+  max_elements = t - t/4;
+  slots = alloc.allocate(t);
+  ctrl_allocator_type ctrl_alloc(alloc);
+  ctrl = ctrl_alloc.allocate(t);
+  std::memset(ctrl, empty, t);
+}
+
+template <typename T, typename Allocator>
+void flat_map<T, Allocator>::destroy_table()
+{
+  if(!slots)
+    return;
+  for (std::size_t s = 0; s < capacity; ++s)
+    if (ctrl[s] != empty)
+      std::allocator_traits<allocator_type>::destroy(alloc, slots + s);
+  alloc.deallocate(slots, capacity);
+  ctrl_allocator_type ctrl_alloc(alloc);
+  ctrl_alloc.deallocate(ctrl, capacity);
+  slots = nullptr;
+  ctrl = nullptr;
+  capacity = 0;
+  nb_elements = 0;
+}
+
+template <typename T, typename Allocator>
+std::size_t flat_map<T, Allocator>::find_empty(std::uint64_t h) const
+{
+  std::size_t g = h1(h);
+  for (std::size_t step = 1; ; ++step)
+  {
+    Group e = match_empty(load_group(g));
+    if (e)
+      return g * group_size + lowest_slot(e);
+    g = next_group(g, step);
+  }
+}
+
+template <typename T, typename Allocator>
+inline flat_map_elem<T>* flat_map<T, Allocator>::insert_new(std::size_t x, T&& y)
+{
+  std::uint64_t h = mix(x);
+  std::size_t s = find_empty(h);
+  std::allocator_traits<allocator_type>::construct(alloc, slots + s, x, std::move(y));
+  ctrl[s] = h2(h);
+  ++nb_elements;
+  return slots + s;
+}
+
+template <typename T, typename Allocator>
+inline flat_map_elem<T>* flat_map<T, Allocator>::insert_new(std::size_t x, const T& y)
+{
+  std::uint64_t h = mix(x);
+  std::size_t s = find_empty(h);
+  std::allocator_traits<allocator_type>::construct(alloc, slots + s, x, y);
+  ctrl[s] = h2(h);
+  ++nb_elements;
+  return slots + s;
+}
+
+template <typename T, typename Allocator>
+void flat_map<T, Allocator>::rehash()
+{
+  flat_map_elem<T>* old_slots = slots;
+  unsigned char* old_ctrl = ctrl;
+  std::size_t old_capacity = capacity;
+
+  init_table(2 * max_elements);
+
+  for (std::size_t s = 0; s < old_capacity; ++s)
+  {
+    if (old_ctrl[s] == empty)
+      continue;
+    insert_new(old_slots[s].k, std::move(old_slots[s].i));
+    std::allocator_traits<allocator_type>::destroy(alloc, old_slots + s);
+  }
+
+  alloc.deallocate(old_slots, old_capacity);
+  ctrl_allocator_type ctrl_alloc(alloc);
+  ctrl_alloc.deallocate(old_ctrl, old_capacity);
+}
+
+template <typename T, typename Allocator>
+inline typename flat_map<T, Allocator>::Item
+flat_map<T, Allocator>::lookup(std::size_t x) const
+{
+  if(!slots)
+    return nullptr;
+
+  std::uint64_t h = mix(x);
+  unsigned char c = h2(h);
+  std::size_t g = h1(h);
+  for (std::size_t step = 1; ; ++step)
+  {
+    Group w = load_group(g);
+    for (Group m = match(w, c); m; m &= m - 1)
+    {
+      Item p = slots + g * group_size + lowest_slot(m);
+      if (p->k == x)
+        return p;
+    }
+    if (match_empty(w))
+      return nullptr;
+    g = next_group(g, step);
+  }
+}
+
+template <typename T, typename Allocator>
+inline T& flat_map<T, Allocator>::access(std::size_t x)
+{
+  if(!slots)
+    init_table(reserved_size);
+
+  std::uint64_t h = mix(x);
+  unsigned char c = h2(h);
+  std::size_t g = h1(h);
+  for (std::size_t step = 1; ; ++step)
+  {
+    Group w = load_group(g);
+    for (Group m = match(w, c); m; m &= m - 1)
+    {
+      Item p = slots + g * group_size + lowest_slot(m);
+      if (p->k == x)
+        return p->i;
+    }
+    Group e = match_empty(w);
+    if (e)
+    {
+      // index x not present, insert it in the first empty slot of the probe sequence
+      if (nb_elements == max_elements)
+      {
+        rehash();
+        return insert_new(x, def)->i;
+      }
+      std::size_t s = g * group_size + lowest_slot(e);
+      std::allocator_traits<allocator_type>::construct(alloc, slots + s, x, def);
+      ctrl[s] = c;
+      ++nb_elements;
+      return slots[s].i;
+    }
+    g = next_group(g, step);
+  }
+}
+
+template <typename T, typename Allocator>
+flat_map<T, Allocator>::flat_map(std::size_t n, const T& d)
+  : slots(nullptr), ctrl(nullptr), capacity(0), nb_elements(0), max_elements(0),
+    reserved_size(n), def(d)
+{
+}
+
+template <typename T, typename Allocator>
+flat_map<T, Allocator>::flat_map(const flat_map<T, Allocator>& D)
+  : slots(nullptr), ctrl(nullptr), capacity(0), nb_elements(0), max_elements(0),
+    alloc(D.alloc), reserved_size(D.reserved_size), def(D.def)
+{
+  *this = D;
+}
+
+template <typename T, typename Allocator>
+flat_map<T, Allocator>::flat_map(flat_map<T, Allocator>&& D)
+  noexcept(std::is_nothrow_move_constructible_v<Allocator> && std::is_nothrow_move_constructible_v<T>)
+  : slots(std::exchange(D.slots, nullptr))
+  , ctrl(std::exchange(D.ctrl, nullptr))
+  , capacity(std::exchange(D.capacity, 0))
+  , nb_elements(std::exchange(D.nb_elements, 0))
+  , max_elements(std::exchange(D.max_elements, 0))
+  , alloc(std::move(D.alloc))
+  , reserved_size(std::exchange(D.reserved_size, 0))
+  , def(std::move(D.def))
+{}
+
+template <typename T, typename Allocator>
+flat_map<T, Allocator>& flat_map<T, Allocator>::operator=(const flat_map<T, Allocator>& D)
+{
+  if (this == &D)
+    return *this;
+
+  clear();
+  def = D.def;
+  reserved_size = D.reserved_size;
+  if (!D.slots)
+    return *this;
+
+  // same capacity, hence same positions: copy the control bytes as is
+  init_table(D.max_elements);
+  std::memcpy(ctrl, D.ctrl, capacity);
+  for (std::size_t s = 0; s < capacity; ++s)
+    if (ctrl[s] != empty)
+      std::allocator_traits<allocator_type>::construct(alloc, slots + s, D.slots[s].k, D.slots[s].i);
+  nb_elements = D.nb_elements;
+  return *this;
+}
+
+template <typename T, typename Allocator>
+flat_map<T, Allocator>& flat_map<T, Allocator>::operator=(flat_map<T, Allocator>&& D)
+  noexcept(std::is_nothrow_move_assignable_v<Allocator> && std::is_nothrow_move_assignable_v<T>)
+{
+  clear();
+
+  slots = std::exchange(D.slots, nullptr);
+  ctrl = std::exchange(D.ctrl, nullptr);
+  capacity = std::exchange(D.capacity, 0);
+  nb_elements = std::exchange(D.nb_elements, 0);
+  max_elements = std::exchange(D.max_elements, 0);
+  alloc = std::move(D.alloc);
+  reserved_size = std::exchange(D.reserved_size, 0);
+  def = std::move(D.def);
+
+  return *this;
+}
+
+template <typename T, typename Allocator>
+void flat_map<T, Allocator>::reserve(std::size_t n)
+{
+  CGAL_assertion(!slots);
+  reserved_size = n;
+}
+
+template <typename T, typename Allocator>
+void flat_map<T, Allocator>::clear()
+{
+  destroy_table();
+}
+
+template <typename T, typename Allocator>
+void flat_map<T, Allocator>::statistics() const
+{
+  std::cout << "table_size: " << capacity << "\n";
+  std::cout << "number of entries: " << nb_elements << "\n";
+  std::cout << "load factor: " << (capacity ? double(nb_elements) / capacity : 0.) << "\n";
+  std::size_t in_first_group = 0;
+  for (std::size_t s = 0; s < capacity; ++s)
+    if (ctrl[s] != empty && s / group_size == h1(mix(slots[s].k)))
+      ++in_first_group;
+  std::cout << "fraction of entries in first group: "
+            << (nb_elements ? double(in_first_group) / nb_elements : 0.) << "\n";
+}
+
+} // namespace internal
+} //namespace CGAL
+
+#endif // CGAL_HASH_MAP_INTERNAL_FLAT_MAP_H
@@ -24,29 +24,40 @@
 #include <CGAL/memory.h>
 #include <CGAL/Handle_hash_function.h>
 #include <CGAL/Hash_map/internal/chained_map.h>
+#include <CGAL/Hash_map/internal/flat_map.h>
 #include <cstddef>
+#include <type_traits>
 
 namespace CGAL {
 
+// Implementations of `Unique_hash_map`: chaining with overflow nodes,
+// or open addressing in a flat table.
+struct Chained_hash_map_tag {};
+struct Flat_hash_map_tag {};
+
 template <class Key_, class Data_,
           class UniqueHashFunction = Handle_hash_function,
-          class Allocator_ = CGAL_ALLOCATOR(Data_) >
+          class Allocator_ = CGAL_ALLOCATOR(Data_),
+          class ImplementationTag = Chained_hash_map_tag >
 class Unique_hash_map {
 public:
     typedef Key_                                     Key;
     typedef Data_                                    Data;
     typedef UniqueHashFunction                       Hash_function;
     typedef Allocator_                               Allocator;
+    typedef ImplementationTag                        Implementation_tag;
 
     // STL compliance
     typedef Key_                                     key_type;
     typedef Data_                                    data_type;
     typedef UniqueHashFunction                       hasher;
 
-    typedef Unique_hash_map<Key,Data,Hash_function,Allocator> Self;
+    typedef Unique_hash_map<Key,Data,Hash_function,Allocator,Implementation_tag> Self;
 
 private:
-    typedef internal::chained_map<Data, Allocator>   Map;
+    typedef std::conditional_t<std::is_same_v<Implementation_tag, Flat_hash_map_tag>,
+                               internal::flat_map<Data, Allocator>,
+                               internal::chained_map<Data, Allocator> > Map;
     typedef typename Map::Item                       Item;
 
 private:
@@ -138,11 +149,13 @@ namespace boost {
   struct lvalue_property_map_tag;
 
   template <typename KeyType, typename ValueType,
-            typename HashFunction, typename Allocator>
+            typename HashFunction, typename Allocator, typename ImplementationTag>
   class associative_property_map<CGAL::Unique_hash_map<KeyType, ValueType,
-                                                       HashFunction, Allocator> >
+                                                       HashFunction, Allocator,
+                                                       ImplementationTag> >
   {
-    typedef CGAL::Unique_hash_map<KeyType, ValueType, HashFunction, Allocator> C;
+    typedef CGAL::Unique_hash_map<KeyType, ValueType, HashFunction, Allocator,
+                                  ImplementationTag> C;
 
   public:
     typedef KeyType key_type;
@@ -176,14 +189,17 @@ namespace boost {
   };
 
   template <typename KeyType, typename ValueType,
-            typename HashFunction, typename Allocator>
+            typename HashFunction, typename Allocator, typename ImplementationTag>
   associative_property_map<CGAL::Unique_hash_map<KeyType, ValueType,
-                                                 HashFunction, Allocator> >
+                                                 HashFunction, Allocator,
+                                                 ImplementationTag> >
   make_assoc_property_map(CGAL::Unique_hash_map<KeyType, ValueType,
-                                                HashFunction, Allocator>& c)
+                                                HashFunction, Allocator,
+                                                ImplementationTag>& c)
   {
     return associative_property_map<CGAL::Unique_hash_map<KeyType, ValueType,
-                                                          HashFunction, Allocator> >(c);
+                                                          HashFunction, Allocator,
+                                                          ImplementationTag> >(c);
   }
 
 }
@@ -1,4 +1,5 @@
 #include <list>
+#include <vector>
 #include <CGAL/Unique_hash_map.h>
 #include <CGAL/test_macros.h>
 #include <type_traits>
@@ -11,8 +12,55 @@ struct Integer_hash_function
   int operator()(int i) const { return i; }
 };
 
+// many keys, to go through several rehashes, in both implementations
+template <class Tag>
+int test_implementation() {
+    CGAL_TEST_START;
+    typedef std::vector<double>::iterator                     Vector_iterator;
+    typedef CGAL::Unique_hash_map<Vector_iterator, int,
+                                  CGAL::Handle_hash_function,
+                                  CGAL_ALLOCATOR(int), Tag>   Hmap;
+    static_assert(std::is_nothrow_move_constructible_v<Hmap>);
+
+    const int n = 10000;
+    std::vector<double> V(n);
+    Hmap H(-1, 1);
+    for (int i = 0; i < n; i += 2)
+        H[V.begin() + i] = i;
+    for (int i = 0; i < n; ++i) {
+        CGAL_TEST( H.is_defined(V.begin() + i) == (i % 2 == 0));
+        CGAL_TEST( static_cast<const Hmap&>(H)[V.begin() + i] == (i % 2 == 0 ? i : -1));
+    }
+
+    Hmap H2(H);
+    Hmap H3;
+    H3 = H;
+    for (int i = 0; i < n; i += 2) {
+        CGAL_TEST( H2[V.begin() + i] == i);
+        CGAL_TEST( H3[V.begin() + i] == i);
+    }
+    CGAL_TEST( H2.default_value() == -1);
+    CGAL_TEST( !H2.is_defined(V.begin() + 1));
+
+    Hmap H4(std::move(H2));
+    CGAL_TEST( H4[V.begin() + 2] == 2);
+    H3.clear(-3);
+    CGAL_TEST( !H3.is_defined(V.begin()));
+    CGAL_TEST( H3[V.begin()] == -3);
+
+    Hmap H5(-1);
+    H5.reserve(n);
+    for (int i = 0; i < n; ++i)
+        H5[V.begin() + i] = i;
+    for (int i = 0; i < n; ++i)
+        CGAL_TEST( H5[V.begin() + i] == i);
+    CGAL_TEST_END;
+}
+
 int main() {
     CGAL_TEST_START;
+    CGAL_TEST( test_implementation<CGAL::Chained_hash_map_tag>() == 0);
+    CGAL_TEST( test_implementation<CGAL::Flat_hash_map_tag>() == 0);
     list<int> L;
     L.push_back(1);
     L.push_back(2);
@@ -80,6 +128,14 @@ int main() {
     CGAL_TEST(get(H5_pmap, -1) == 1);
     CGAL_TEST(H5_pmap[0] == -1);
 
+    typedef CGAL::Unique_hash_map<int, int, Integer_hash_function,
+                                  CGAL_ALLOCATOR(int), CGAL::Flat_hash_map_tag> Int_flat_hmap;
+    Int_flat_hmap H6(-1);
+    boost::associative_property_map<Int_flat_hmap> H6_pmap = boost::make_assoc_property_map(H6);
+    put(H6_pmap, -1, 1);
+    CGAL_TEST(get(H6_pmap, -1) == 1);
+    CGAL_TEST(H6_pmap[0] == -1);
+
     std::cerr << "done" << std::endl;
     CGAL_TEST_END;
 }
@@ -26,6 +26,8 @@
 #include <CGAL/squared_distance_3.h>
 #include <CGAL/number_utils.h>
 #include <CGAL/Default.h>
+#include <CGAL/tags.h>
+#include <CGAL/for_each.h>
 
 #ifdef CGAL_EIGEN3_ENABLED
 #include <CGAL/Eigen_solver_traits.h>
@@ -34,6 +36,9 @@
 #include <CGAL/Weights/utils.h>
 #include <boost/range/has_range_iterator.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
 #include <vector>
 #include <set>
 
@@ -286,14 +291,22 @@ private:
 
   void
   compute_unit_gradient()
+  {
+    compute_unit_gradient([this](Index i) { return m_solved_u(i); }, m_X);
+  }
+
+  // computes in `X` the normalized gradient of the heat values `u(i)` in each face
+  template <typename HeatValues>
+  void
+  compute_unit_gradient(const HeatValues& u, std::vector<Vector_3>& X) const
   {
     typename Traits::Construct_vector_3 construct_vector = Traits().construct_vector_3_object();
     typename Traits::Construct_sum_of_vectors_3 sum = Traits().construct_sum_of_vectors_3_object();
     typename Traits::Compute_scalar_product_3 scalar_product = Traits().compute_scalar_product_3_object();
     typename Traits::Construct_cross_product_vector_3 cross_product = Traits().construct_cross_product_vector_3_object();
     typename Traits::Construct_scaled_vector_3 scale = Traits().construct_scaled_vector_3_object();
-    if(m_X.empty()){
-      m_X.resize(num_faces(tm));
+    if(X.empty()){
+      X.resize(num_faces(tm));
     }
     CGAL::Vertex_around_face_iterator<TriangleMesh> vbegin, vend, vmiddle;
     for(face_descriptor f : faces(tm)) {
@@ -323,9 +336,9 @@ private:
       double N_cross = (CGAL::sqrt(to_double(scalar_product(cross,cross))));
       Vector_3 unit_cross = scale(cross, 1./N_cross);
       double area_face = N_cross * (1./2);
-      double u_i = CGAL::abs(m_solved_u(i));
-      double u_j = CGAL::abs(m_solved_u(j));
-      double u_k = CGAL::abs(m_solved_u(k));
+      double u_i = CGAL::abs(u(i));
+      double u_j = CGAL::abs(u(j));
+      double u_k = CGAL::abs(u(k));
       double r_Mag = 1./(std::max)((std::max)(u_i, u_j),u_k);
       /* normalize heat values so that they have roughly unit magnitude */
       if(!std::isinf(r_Mag)) {
@@ -338,16 +351,26 @@ private:
       edge_sums = sum(edge_sums, scale(cross_product(unit_cross, construct_vector(p_k,p_i)), u_j));
       edge_sums = scale(edge_sums, (1./area_face));
       double e_magnitude = CGAL::sqrt(to_double(scalar_product(edge_sums,edge_sums)));
-      m_X[face_i] = scale(edge_sums,(1./e_magnitude));
+      X[face_i] = scale(edge_sums,(1./e_magnitude));
     }
   }
 
   void
   compute_divergence()
+  {
+    Matrix indexD(dimension,1);
+    compute_divergence(m_X, [&indexD](Index i, double value) { indexD.add_coef(i, 0, value); });
+    indexD.swap(m_index_divergence);
+  }
+
+  // calls `add_divergence(i, value)` for the contributions of each face to the
+  // divergence of the vector field `X` at the vertex of index `i`
+  template <typename AddDivergence>
+  void
+  compute_divergence(const std::vector<Vector_3>& X, const AddDivergence& add_divergence) const
   {
     typename Traits::Compute_scalar_product_3 scalar_product = Traits().compute_scalar_product_3_object();
     typename Traits::Construct_vector_3 construct_vector = Traits().construct_vector_3_object();
-    Matrix indexD(dimension,1);
     CGAL::Vertex_around_face_iterator<TriangleMesh> vbegin, vend, vmiddle;
     for(face_descriptor f : faces(tm)) {
       boost::tie(vbegin, vend) = vertices_around_face(halfedge(f,tm),tm);
@@ -374,7 +397,7 @@ private:
       const FT cotan_j = CGAL::Weights::cotangent(p_k, p_j, p_i, traits);
       const FT cotan_k = CGAL::Weights::cotangent(p_j, p_k, p_i, traits);
 
-      const Vector_3& a = m_X[face_i];
+      const Vector_3& a = X[face_i];
       const double i_entry = (CGAL::to_double(scalar_product(a, v_ij) * cotan_k)) +
                              (CGAL::to_double(scalar_product(a, v_ik) * cotan_j));
       const double j_entry = (CGAL::to_double(scalar_product(a, v_jk) * cotan_i)) +
@@ -382,11 +405,10 @@ private:
       const double k_entry = (CGAL::to_double(scalar_product(a, v_ki) * cotan_j)) +
                              (CGAL::to_double(scalar_product(a, v_kj) * cotan_i));
 
-      indexD.add_coef(i, 0, (1./2)*i_entry);
-      indexD.add_coef(j, 0, (1./2)*j_entry);
-      indexD.add_coef(k, 0, (1./2)*k_entry);
+      add_divergence(i, (1./2)*i_entry);
+      add_divergence(j, (1./2)*j_entry);
+      add_divergence(k, (1./2)*k_entry);
     }
-    indexD.swap(m_index_divergence);
   }
 
   // modifies m_solved_phi
@@ -400,26 +422,37 @@ private:
       }
       source_set_val = phi-source_set_val;
     } else {
+      std::vector<Index> source_indices;
+      for(vertex_descriptor vd : sources()){
+        source_indices.push_back(get(vertex_id_map, vd));
+      }
       for(int i = 0; i<dimension; i++) {
-        double min_val = (std::numeric_limits<double>::max)();
-        Index vd_index;
-        //go through the distances to the sources and leave the minimum distance;
-        for(vertex_descriptor vd : sources()){
-          vd_index = get(vertex_id_map, vd);
-          double new_d = CGAL::abs(-phi.coeff(vd_index,0)+phi.coeff(i,0));
-          if(phi.coeff(vd_index,0)==phi.coeff(i,0)) {
-            min_val = 0.;
-          }
-          if(new_d < min_val) {
-            min_val = new_d;
-          }
-        }
-        source_set_val(i,0) = min_val;
+        source_set_val(i,0) = value_at_source_set([&phi](Index j) { return phi.coeff(j,0); }, source_indices, i);
       }
     }
     m_solved_phi.swap(source_set_val);
   }
 
+  // returns the distance at the vertex of index `i` to the non-empty set of
+  // source vertices of indices `source_indices`, given the solution `phi(j)` of the Poisson equation
+  template <typename Phi>
+  double
+  value_at_source_set(const Phi& phi, const std::vector<Index>& source_indices, Index i) const
+  {
+    double min_val = (std::numeric_limits<double>::max)();
+    //go through the distances to the sources and leave the minimum distance;
+    for(Index vd_index : source_indices){
+      double new_d = CGAL::abs(-phi(vd_index)+phi(i));
+      if(phi(vd_index)==phi(i)) {
+        min_val = 0.;
+      }
+      if(new_d < min_val) {
+        min_val = new_d;
+      }
+    }
+    return min_val;
+  }
+
   void
   factor_phi()
   {
@@ -477,6 +510,134 @@ public:
     }
   }
 
+  /**
+   *  Computes the distances to each set of `source_sets` with the factorizations computed in `build()`,
+   *  independently of the current source set. The distance of the `k`-th vertex of `output_vertices`
+   *  to the `s`-th source set is stored in `distances[s * output_vertices.size() + k]`.
+   **/
+  template <typename ConcurrencyTag, typename SourceSetRange, typename VertexRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   const VertexRange& output_vertices,
+                                   std::vector<double>& distances)
+  {
+    std::vector<std::vector<Index> > source_indices;
+    for(const auto& source_set : source_sets){
+      std::vector<Index> indices;
+      for(const auto& vd : source_set){
+        indices.push_back(get(vertex_id_map, v2v(vd)));
+      }
+      std::sort(indices.begin(), indices.end());
+      indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+      source_indices.push_back(std::move(indices));
+    }
+
+    std::vector<Index> output_indices;
+    for(const auto& vd : output_vertices){
+      output_indices.push_back(get(vertex_id_map, v2v(vd)));
+    }
+
+    const std::size_t nb_sets = source_indices.size();
+    const std::size_t nb_outputs = output_indices.size();
+    distances.assign(nb_sets * nb_outputs, 0.);
+    if(is_empty(tm)){
+      return;
+    }
+
+    // the source sets are processed by blocks, whose heat values, divergences,
+    // and solutions of the Poisson equation are stored column by column
+    const std::size_t n = static_cast<std::size_t>(dimension);
+    const std::size_t block_size = 64;
+    std::vector<double> heat, divergence;
+    for(std::size_t first = 0; first < nb_sets; first += block_size) {
+      const std::size_t m = (std::min)(block_size, nb_sets - first);
+
+      heat.assign(n * m, 0.);
+      for(std::size_t c = 0; c < m; ++c) {
+        if(source_indices[first + c].empty()) {
+          heat[c * n] = 1;
+        } else {
+          for(Index i : source_indices[first + c]) {
+            heat[c * n + i] = 1;
+          }
+        }
+      }
+      if(! solve_columns(la, heat)) {
+        // solving failed
+        CGAL_error_msg("Eigen Solving in cotan failed");
+      }
+
+      divergence.assign(n * m, 0.);
+      CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, m),
+                                     [&](std::size_t c) -> bool
+      {
+        std::vector<Vector_3> X;
+        const double* u = heat.data() + c * n;
+        double* div = divergence.data() + c * n;
+        compute_unit_gradient([u](Index i) { return u[i]; }, X);
+        compute_divergence(X, [div](Index i, double value) { div[i] += value; });
+        return true;
+      });
+
+      if(! solve_columns(la_cotan, divergence)) {
+        // solving failed
+        CGAL_error_msg("Eigen Solving in solve_phi() failed");
+      }
+
+      CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, m),
+                                     [&](std::size_t c) -> bool
+      {
+        const double* phi = divergence.data() + c * n;
+        const std::vector<Index>& sources = source_indices[first + c];
+        double* out = distances.data() + (first + c) * nb_outputs;
+        for(std::size_t k = 0; k < nb_outputs; ++k) {
+          const Index i = output_indices[k];
+          out[k] = sources.empty() ? phi[i] - phi[0]
+                                   : value_at_source_set([phi](Index j) { return phi[j]; }, sources, i);
+        }
+        return true;
+      });
+    }
+  }
+
+private:
+  // solves the systems whose right-hand sides are the columns of `b` with the
+  // factorization stored in `solver`, and replaces them by the solutions
+  template <typename Solver>
+  bool
+  solve_columns(Solver& solver, std::vector<double>& b) const
+  {
+    const std::size_t n = static_cast<std::size_t>(dimension);
+    typename Solver::Vector rhs(dimension), x(dimension);
+    for(std::size_t c = 0; c < b.size() / n; ++c) {
+      for(std::size_t i = 0; i < n; ++i) {
+        rhs[i] = b[c * n + i];
+      }
+      if(! solver.linear_solver(rhs, x)) {
+        return false;
+      }
+      for(std::size_t i = 0; i < n; ++i) {
+        b[c * n + i] = x[i];
+      }
+    }
+    return true;
+  }
+
+#ifdef CGAL_EIGEN3_ENABLED
+  // Eigen solvers solve all the columns at once
+  template <typename EigenSolver>
+  bool
+  solve_columns(Eigen_solver_traits<EigenSolver>& solver, std::vector<double>& b) const
+  {
+    Eigen::Map<Eigen::MatrixXd> columns(b.data(), dimension, b.size() / dimension);
+    const Eigen::MatrixXd x = solver.solver().solve(columns);
+    if(solver.solver().info() != Eigen::Success) {
+      return false;
+    }
+    columns = x;
+    return true;
+  }
+#endif
+
 private:
   void
   build()
@@ -631,6 +792,17 @@ struct Base_helper
         base().triangle_mesh(), Traits()));
     base().estimate_geodesic_distances(vdm);
   }
+
+  template <typename ConcurrencyTag, typename SourceSetRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   std::vector<double>& distances)
+  {
+    CGAL_assertion(
+      !CGAL::Heat_method_3::internal::has_degenerate_faces(
+        base().triangle_mesh(), Traits()));
+    base().template estimate_geodesic_distances<ConcurrencyTag>(
+      source_sets, vertices(base().triangle_mesh()), distances);
+  }
 };
 
 template<class TriangleMesh,
@@ -639,13 +811,14 @@ template<class TriangleMesh,
 struct Idt_storage
 {
   Intrinsic_Delaunay_triangulation_3<TriangleMesh, Traits> m_idt;
+  const TriangleMesh& m_input_tm;
 
   Idt_storage(const TriangleMesh& tm, VertexPointMap vpm)
-    : m_idt(tm, vpm)
+    : m_idt(tm, vpm), m_input_tm(tm)
   {}
 
   Idt_storage(const TriangleMesh& tm)
-    : m_idt(tm)
+    : m_idt(tm), m_input_tm(tm)
   {}
 };
 
@@ -690,6 +863,14 @@ struct Base_helper<TriangleMesh, Traits, Intrinsic_Delaunay, LA, VertexPointMap>
   {
     base().estimate_geodesic_distances(this->m_idt.vertex_distance_map(vdm));
   }
+
+  template <typename ConcurrencyTag, typename SourceSetRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   std::vector<double>& distances)
+  {
+    base().template estimate_geodesic_distances<ConcurrencyTag>(
+      source_sets, vertices(this->m_input_tm), distances);
+  }
 };
 
 } // namespace internal
@@ -885,6 +1066,31 @@ public:
   {
     Base_helper::estimate_geodesic_distances(vdm);
   }
+
+  /**
+   * fills `distances` with the estimated geodesic distance of each vertex to the closest vertex of each source set of `source_sets`.
+   * The source sets are independent of the source set of this object, which is left unchanged.
+   *
+   * The distances are stored in a dense matrix with one column per source set:
+   * the distance of the `k`-th vertex of `vertices(triangle_mesh())` to the `s`-th source set is
+   * `distances[s * num_vertices(triangle_mesh()) + k]`.
+   * The linear systems of all the source sets are solved with the factorizations computed at construction,
+   * several source sets at a time.
+   *
+   * \tparam ConcurrencyTag enables sequential versus parallel computation of the gradients and the divergences.
+   *         Possible values are `Sequential_tag` (the default) and `Parallel_tag`.
+   * \tparam SourceSetRange a model of the concept `ConstRange` whose value type is a model of `ConstRange`
+   *         with value type `vertex_descriptor`
+   * \param source_sets the source sets
+   * \param distances the matrix of distances, resized to `source_sets.size() * num_vertices(triangle_mesh())`
+   * \pre If `Mode` is `Direct`, the support triangle mesh does not have any degenerate faces
+   **/
+  template <typename ConcurrencyTag = Sequential_tag, typename SourceSetRange>
+  void estimate_geodesic_distances(const SourceSetRange& source_sets,
+                                   std::vector<double>& distances)
+  {
+    Base_helper::template estimate_geodesic_distances<ConcurrencyTag>(source_sets, distances);
+  }
 };
 
 #if defined(DOXYGEN_RUNNING) || defined(CGAL_EIGEN3_ENABLED)
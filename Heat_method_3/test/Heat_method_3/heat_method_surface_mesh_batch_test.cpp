@@ -0,0 +1,93 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Heat_method_3/Surface_mesh_geodesic_distances_3.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double>                       Kernel;
+typedef Kernel::Point_3                                      Point_3;
+typedef CGAL::Surface_mesh<Point_3>                          Surface_mesh;
+
+typedef boost::graph_traits<Surface_mesh>::vertex_descriptor vertex_descriptor;
+typedef Surface_mesh::Property_map<vertex_descriptor,double> Vertex_distance_map;
+
+// the batched distances are computed with a different summation order
+// than the distances of a single source set
+bool close(double a, double b)
+{
+  return std::abs(a - b) <= 1e-8 * (std::max)(1., (std::max)(std::abs(a), std::abs(b)));
+}
+
+template <typename Mode, typename ConcurrencyTag>
+void test(const Surface_mesh& sm, const std::vector<std::vector<vertex_descriptor> >& source_sets)
+{
+  typedef CGAL::Heat_method_3::Surface_mesh_geodesic_distances_3<Surface_mesh, Mode> Heat_method;
+
+  Heat_method hm(sm);
+  hm.add_source(*(vertices(sm).first));
+
+  std::vector<double> distances;
+  hm.template estimate_geodesic_distances<ConcurrencyTag>(source_sets, distances);
+  assert(distances.size() == source_sets.size() * num_vertices(sm));
+
+  // the source set of `hm` is not modified
+  assert(hm.sources().size() == 1);
+
+  Surface_mesh copy(sm);
+  Vertex_distance_map vertex_distance = copy.add_property_map<vertex_descriptor, double>("v:distance", 0).first;
+  for(std::size_t s = 0; s < source_sets.size(); ++s) {
+    hm.clear_sources();
+    hm.add_sources(source_sets[s]);
+    hm.estimate_geodesic_distances(vertex_distance);
+
+    std::size_t k = 0;
+    for(vertex_descriptor vd : vertices(sm)) {
+      assert(close(distances[s * num_vertices(sm) + k], get(vertex_distance, vd)));
+      ++k;
+    }
+    for(vertex_descriptor vd : source_sets[s]) {
+      assert(distances[s * num_vertices(sm) + vd.idx()] == 0.);
+    }
+  }
+}
+
+template <typename ConcurrencyTag>
+void test(const Surface_mesh& sm)
+{
+  // more source sets than processed together, with one or several sources
+  std::vector<vertex_descriptor> vds(vertices(sm).begin(), vertices(sm).end());
+  std::vector<std::vector<vertex_descriptor> > source_sets;
+  for(std::size_t s = 0; s < 70; ++s) {
+    std::vector<vertex_descriptor> source_set;
+    for(std::size_t j = 0; j <= s % 3; ++j) {
+      source_set.push_back(vds[(s * 37 + j * 101) % vds.size()]);
+    }
+    source_sets.push_back(source_set);
+  }
+
+  test<CGAL::Heat_method_3::Direct, ConcurrencyTag>(sm, source_sets);
+  test<CGAL::Heat_method_3::Intrinsic_Delaunay, ConcurrencyTag>(sm, source_sets);
+}
+
+int main(int argc, char* argv[])
+{
+  Surface_mesh sm;
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/sphere.off");
+  std::ifstream in(filename);
+  in >> sm;
+  assert(num_vertices(sm) > 0);
+
+  test<CGAL::Sequential_tag>(sm);
+
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
+  test<CGAL::Parallel_tag>(sm);
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
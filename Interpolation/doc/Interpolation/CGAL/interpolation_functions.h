@@ -116,6 +116,35 @@ linear_interpolation(CoordinateInputIterator first, CoordinateInputIterator beyo
 /*!
 \ingroup PkgInterpolation2Interpolation
 
+Applies `linear_interpolation()` to the coordinates of several query points,
+as computed by the version of `natural_neighbor_coordinates_2()` that takes a range of queries:
+the coordinates of the `i`-th query are `coordinates[offsets[i]]`, ..., `coordinates[offsets[i+1]-1]`,
+and their normalization factor is `norms[i]`.
+
+\tparam ConcurrencyTag enables sequential versus parallel computation.
+Possible values are `Sequential_tag` (the default) and `Parallel_tag`.
+\tparam CoordinateVector must be a `std::vector` whose value type is a pair associating
+an entity to a (non-normalized) barycentric coordinate.
+\tparam ValueFunctor must be as in `linear_interpolation()`. It is called concurrently with `Parallel_tag`.
+\tparam ResultVector must be `std::vector<std::pair<VT, bool> >`, where `VT` is the function value type.
+
+\param coordinates, offsets, norms are the coordinates of the queries.
+\param value_function is a functor that allows to access values of the interpolated function.
+\param results is resized to `norms.size()`. `results[i]` is the interpolated value at the `i`-th query, and `true`,
+or `false` as second value if the range of coordinates of the query is empty.
+
+\sa `CGAL::sibson_c1_interpolation()`
+*/
+template < class ConcurrencyTag, class CoordinateVector, class ValueFunctor, class ResultVector >
+void linear_interpolation(const CoordinateVector& coordinates,
+                          const std::vector<std::size_t>& offsets,
+                          const std::vector<typename CoordinateVector::value_type::second_type>& norms,
+                          ValueFunctor value_function,
+                          ResultVector& results);
+
+/*!
+\ingroup PkgInterpolation2Interpolation
+
 The function `quadratic_interpolation()` generates the
 interpolated function value as the weighted sum of the values plus a
 linear term in the gradient for each entity of the entity/coordinate
@@ -252,6 +281,44 @@ sibson_c1_interpolation(CoordinateInputIterator first, CoordinateInputIterator b
 /*!
 \ingroup PkgInterpolation2Interpolation
 
+Applies `sibson_c1_interpolation()` to the coordinates of several query points,
+as computed by the version of `natural_neighbor_coordinates_2()` that takes a range of queries:
+the coordinates of `queries[i]` are `coordinates[offsets[i]]`, ..., `coordinates[offsets[i+1]-1]`,
+and their normalization factor is `norms[i]`.
+
+\tparam ConcurrencyTag enables sequential versus parallel computation.
+Possible values are `Sequential_tag` (the default) and `Parallel_tag`.
+\tparam CoordinateVector must be a `std::vector` whose value type is a pair associating
+an entity to a (non-normalized) barycentric coordinate.
+\tparam PointRange must be a model of `RandomAccessRange` with value type `Traits::Point_d` or `Traits::Weighted_point_d`.
+\tparam ValueFunctor, GradFunctor, Traits must be as in `sibson_c1_interpolation()`.
+The functors are called concurrently with `Parallel_tag`.
+\tparam ResultVector must be `std::vector<std::pair<VT, bool> >`, where `VT` is the function value type.
+
+\param coordinates, offsets, norms are the coordinates of the queries.
+\param queries are the query points.
+\param value_function is a functor that allows to access values of the interpolated function.
+\param gradient_function is a functor that allows to access the function gradients.
+\param traits is an instance of the traits class.
+\param results is resized to `queries.size()`. `results[i]` is the result of `sibson_c1_interpolation()` for `queries[i]`,
+or has `false` as second value if the range of coordinates of `queries[i]` is empty.
+
+\sa `CGAL::linear_interpolation()`
+*/
+template < class ConcurrencyTag, class CoordinateVector, class PointRange,
+           class ValueFunctor, class GradFunctor, class Traits, class ResultVector >
+void sibson_c1_interpolation(const CoordinateVector& coordinates,
+                             const std::vector<std::size_t>& offsets,
+                             const std::vector<typename CoordinateVector::value_type::second_type>& norms,
+                             const PointRange& queries,
+                             ValueFunctor value_function,
+                             GradFunctor gradient_function,
+                             const Traits& traits,
+                             ResultVector& results);
+
+/*!
+\ingroup PkgInterpolation2Interpolation
+
 Same as `sibson_c1_interpolation()`, except that no square root operation is required
 for the number type `Traits::FT`.
 
@@ -115,6 +115,46 @@ natural_neighbor_coordinates_2(const Dt& dt,
                                CoordinateOutputIterator out,
                                OutputFunctor fct);
 
+/*!
+Computes the natural neighbor coordinates of each point of `queries` with respect to the points
+in the two-dimensional Delaunay triangulation `dt`.
+
+This is equivalent to calling `natural_neighbor_coordinates_2()` for each query, but faster:
+the queries are processed along a Hilbert curve, so that each point location starts
+from the face containing the previous query, and the buffers used for the conflict zones are reused.
+The triangulation is not modified, so the queries can be distributed among threads.
+
+\tparam ConcurrencyTag enables sequential versus parallel computation.
+Possible values are `Sequential_tag` (the default) and `Parallel_tag`.
+With `Parallel_tag`, \ref thirdpartyTBB must be available and linked.
+\tparam PointRange must be a model of `RandomAccessRange` with value type `Dt::Geom_traits::Point_2`.
+\tparam CoordinateVector must be `std::vector<OutputFunctor::result_type>`.
+\tparam OutputFunctor must be a functor with argument type `std::pair<Dt::Vertex_handle, Dt::Geom_traits::FT>`.
+        It can be omitted, and the value type of `CoordinateVector` is then
+        `std::pair<Dt::Point, Dt::Geom_traits::FT>`.
+
+\param dt is the Delaunay triangulation.
+\param queries are the query points.
+\param coordinates receives the coordinates of all the queries, stored contiguously: the coordinates of
+`queries[i]` are `coordinates[offsets[i]]`, ..., `coordinates[offsets[i+1]-1]`.
+\param offsets is resized to `queries.size() + 1`. It gives the positions of the coordinates of each query in `coordinates`.
+\param norms is resized to `queries.size()`, and `norms[i]` is the normalization factor of the coordinates of `queries[i]`.
+\param fct is an object of type `OutputFunctor`.
+
+The range of coordinates of a query is empty if the computation was not successful,
+that is if the query lies outside the convex hull of the points of `dt`.
+
+\sa `CGAL::linear_interpolation()`
+\sa `CGAL::sibson_c1_interpolation()`
+*/
+template < class ConcurrencyTag, class Dt, class PointRange, class CoordinateVector, class OutputFunctor >
+void natural_neighbor_coordinates_2(const Dt& dt,
+                                    const PointRange& queries,
+                                    CoordinateVector& coordinates,
+                                    std::vector<std::size_t>& offsets,
+                                    std::vector<typename Dt::Geom_traits::FT>& norms,
+                                    OutputFunctor fct);
+
 /// @}
 
 } /* namespace CGAL */
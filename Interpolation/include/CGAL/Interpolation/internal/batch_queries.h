@@ -0,0 +1,150 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_INTERPOLATION_INTERNAL_BATCH_QUERIES_H
+#define CGAL_INTERPOLATION_INTERNAL_BATCH_QUERIES_H
+
+#include <CGAL/license/Interpolation.h>
+
+#include <CGAL/Hilbert_policy_tags.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/spatial_sort_permutation.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace CGAL {
+
+namespace Interpolation {
+
+namespace internal {
+
+// Computes the coordinates of all the points of `queries`, and stores them contiguously:
+// the coordinates of `queries[i]` are `coordinates[offsets[i]]`, ..., `coordinates[offsets[i+1]-1]`
+// and their normalization factor is `norms[i]`. The range of a query for which the computation
+// fails is empty.
+//
+// The queries are processed along a Hilbert curve, in blocks of consecutive queries.
+// Each block has its own `Workspace`, which keeps the buffers and the locate hint
+// of the triangulation from one query to the next.
+// `query(p, workspace, out)` computes the coordinates of `p` with the output iterator `out`,
+// and returns a triple whose last two values are the normalization factor and the success.
+//
+// The blocks do not depend on the number of threads, so the results are the same
+// with `Sequential_tag` and with `Parallel_tag`.
+template <class ConcurrencyTag, class Workspace,
+          class PointRange, class Traits, class CoordinateVector, class FT, class Query>
+void batch_coordinates(const PointRange& queries,
+                       const Traits& traits,
+                       CoordinateVector& coordinates,
+                       std::vector<std::size_t>& offsets,
+                       std::vector<FT>& norms,
+                       const Query& query)
+{
+  typedef typename CoordinateVector::value_type            Coordinate;
+
+  const std::size_t size = queries.size();
+  const std::vector<std::size_t> order =
+    spatial_sort_permutation<ConcurrencyTag>(queries.begin(), queries.end(), traits,
+                                             Hilbert_sort_median_policy());
+
+  const std::size_t block_size = 256;
+  const std::size_t nb_blocks = (size + block_size - 1) / block_size;
+
+  // the coordinates are first computed per block, and then copied in the order of the queries
+  std::vector<std::vector<Coordinate> > block_coordinates(nb_blocks);
+  std::vector<std::size_t> local_offsets(size), counts(size);
+  norms.assign(size, FT(1));
+
+  CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, nb_blocks),
+                                 [&](std::size_t b) -> bool
+  {
+    Workspace workspace;
+    std::vector<Coordinate>& out = block_coordinates[b];
+    const std::size_t end = (std::min)(size, (b + 1) * block_size);
+    for(std::size_t k = b * block_size; k < end; ++k)
+    {
+      const std::size_t i = order[k];
+      local_offsets[i] = out.size();
+      auto result = query(queries[i], workspace, std::back_inserter(out));
+      if(result.third)
+      {
+        norms[i] = result.second;
+      }
+      else
+      {
+        out.resize(local_offsets[i]);
+      }
+      counts[i] = out.size() - local_offsets[i];
+    }
+    return true;
+  });
+
+  offsets.resize(size + 1);
+  offsets[0] = 0;
+  for(std::size_t i = 0; i < size; ++i)
+    offsets[i + 1] = offsets[i] + counts[i];
+
+  coordinates.clear();
+  coordinates.resize(offsets[size]);
+  CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, nb_blocks),
+                                 [&](std::size_t b) -> bool
+  {
+    const std::size_t end = (std::min)(size, (b + 1) * block_size);
+    for(std::size_t k = b * block_size; k < end; ++k)
+    {
+      const std::size_t i = order[k];
+      std::copy(block_coordinates[b].begin() + local_offsets[i],
+                block_coordinates[b].begin() + local_offsets[i] + counts[i],
+                coordinates.begin() + offsets[i]);
+    }
+    return true;
+  });
+}
+
+// Evaluates `interpolate(first, beyond, norm, i)` for the coordinates of each query `i`,
+// as stored by `batch_coordinates()`, and stores the results in `results`.
+// The second value of a result is `false` if the coordinates of the query could not be computed.
+template <class ConcurrencyTag, class CoordinateVector, class FT, class ResultVector, class Interpolate>
+void batch_interpolation(const CoordinateVector& coordinates,
+                         const std::vector<std::size_t>& offsets,
+                         const std::vector<FT>& norms,
+                         ResultVector& results,
+                         const Interpolate& interpolate)
+{
+  typedef typename ResultVector::value_type                Result;
+
+  CGAL_precondition(!offsets.empty());
+  CGAL_precondition(norms.size() + 1 == offsets.size());
+
+  const std::size_t size = norms.size();
+  results.resize(size);
+  CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, size),
+                                 [&](std::size_t i) -> bool
+  {
+    if(offsets[i] == offsets[i + 1])
+      results[i] = Result(typename Result::first_type(), false);
+    else
+      results[i] = interpolate(coordinates.begin() + offsets[i], coordinates.begin() + offsets[i + 1],
+                               norms[i], i);
+    return true;
+  });
+}
+
+} // namespace internal
+
+} // namespace Interpolation
+
+} // namespace CGAL
+
+#endif // CGAL_INTERPOLATION_INTERNAL_BATCH_QUERIES_H
@@ -14,11 +14,14 @@
 
 #include <CGAL/license/Interpolation.h>
 
+#include <CGAL/Interpolation/internal/batch_queries.h>
 #include <CGAL/Interpolation/internal/helpers.h>
+#include <CGAL/tags.h>
 #include <CGAL/double.h>
 #include <CGAL/use.h>
 
 #include <boost/utility/result_of.hpp>
+#include <cstddef>
 #include <iterator>
 #include <utility>
 #include <vector>
@@ -197,6 +200,56 @@ sibson_c1_interpolation(ForwardIterator first, ForwardIterator beyond,
                         (term4 + term2), true);
 }
 
+// The batch versions of `linear_interpolation()` and `sibson_c1_interpolation()` take the
+// coordinates of several queries, stored contiguously as by the functions computing the natural
+// neighbor coordinates of a range of points: the coordinates of the `i`-th query are
+// `coordinates[offsets[i]]`, ..., `coordinates[offsets[i+1]-1]` and their normalization factor is `norms[i]`.
+// The `i`-th result is a pair of the interpolated value and a Boolean, which is `false` if the range
+// of coordinates of the query is empty or if the interpolation failed.
+template < class ConcurrencyTag = Sequential_tag, class CoordinateVector, class ValueFunctor, class ResultVector >
+void
+linear_interpolation(const CoordinateVector& coordinates,
+                     const std::vector<std::size_t>& offsets,
+                     const std::vector<typename CoordinateVector::value_type::second_type>& norms,
+                     ValueFunctor value_function,
+                     ResultVector& results)
+{
+  typedef typename CoordinateVector::value_type::second_type FT;
+  typedef typename ResultVector::value_type                  Result;
+
+  Interpolation::internal::batch_interpolation<ConcurrencyTag>(
+    coordinates, offsets, norms, results,
+    [&](auto first, auto beyond, const FT& norm, std::size_t)
+    {
+      return Result(linear_interpolation(first, beyond, norm, value_function), true);
+    });
+}
+
+template < class ConcurrencyTag = Sequential_tag, class CoordinateVector, class PointRange,
+           class ValueFunctor, class GradFunctor, class Traits, class ResultVector >
+void
+sibson_c1_interpolation(const CoordinateVector& coordinates,
+                        const std::vector<std::size_t>& offsets,
+                        const std::vector<typename CoordinateVector::value_type::second_type>& norms,
+                        const PointRange& queries,
+                        ValueFunctor value_function,
+                        GradFunctor gradient_function,
+                        const Traits& traits,
+                        ResultVector& results)
+{
+  typedef typename CoordinateVector::value_type::second_type FT;
+
+  CGAL_precondition(queries.size() == norms.size());
+
+  Interpolation::internal::batch_interpolation<ConcurrencyTag>(
+    coordinates, offsets, norms, results,
+    [&](auto first, auto beyond, const FT& norm, std::size_t i)
+    {
+      return sibson_c1_interpolation(first, beyond, norm, queries[i],
+                                     value_function, gradient_function, traits);
+    });
+}
+
 // This method works with rational number types:
 // modification of Sibson's interpolant without sqrt
 // following a proposition by Gunther Rote:
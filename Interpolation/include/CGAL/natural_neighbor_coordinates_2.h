@@ -14,6 +14,7 @@
 
 #include <CGAL/license/Interpolation.h>
 
+#include <CGAL/Interpolation/internal/batch_queries.h>
 #include <CGAL/Interpolation/internal/helpers.h>
 
 #include <CGAL/function_objects.h>
@@ -21,10 +22,12 @@
 #include <CGAL/Iterator_project.h>
 #include <CGAL/Polygon_2.h>
 #include <CGAL/number_utils_classes.h>
+#include <CGAL/tags.h>
 #include <CGAL/utility.h>
 
+#include <array>
+#include <cstddef>
 #include <iterator>
-#include <list>
 #include <map>
 #include <utility>
 #include <vector>
@@ -49,22 +52,98 @@ namespace CGAL {
 //                               typename Dt::Vertex_handle vh,
 //                               OutputIterator out, const Traits& traits)
 
-//the following two functions suppose that
+// This function is called when the conflict zone is known.
 // OutputIterator has value type `pair<Dt::Vertex_handle, Dt::Geom_traits::FT>`
-//!!!they are not documented!!!
+//
+// \pre p must lie inside the hole (=^ inside convex hull of neighbors)
+template < class Dt, class OutputIterator, class EdgeIterator >
+Triple< OutputIterator, typename Dt::Geom_traits::FT, bool >
+natural_neighbors_2(const Dt& dt,
+                    const typename Dt::Geom_traits::Point_2& p,
+                    OutputIterator out,
+                    EdgeIterator hole_begin, EdgeIterator hole_end)
+{
+  CGAL_precondition(dt.dimension() == 2);
+
+  typedef typename Dt::Geom_traits       Traits;
+  typedef typename Traits::FT            Coord_type;
+  typedef typename Traits::Point_2       Point_2;
+
+  typedef typename Dt::Vertex_handle     Vertex_handle;
+  typedef typename Dt::Face_circulator   Face_circulator;
+
+  std::array<Point_2, 3> vor;
+
+  Coord_type area_sum(0);
+  EdgeIterator hit = hole_end;
+  --hit;
+
+  // At the beginning, `prev` is the "last" vertex of the hole.
+  // Later, `prev` is the last vertex processed (previously).
+  Vertex_handle prev = hit->first->vertex(dt.cw(hit->second));
+  hit = hole_begin;
+
+  while (hit != hole_end)
+  {
+    Coord_type area(0);
+    Vertex_handle current = hit->first->vertex(dt.cw(hit->second));
+
+    vor[0] = dt.geom_traits().construct_circumcenter_2_object()(
+               current->point(),
+               hit->first->vertex(dt.ccw(hit->second))->point(),
+               p);
+
+    Face_circulator fc = dt.incident_faces(current, hit->first);
+    ++fc;
+    vor[1] = dt.dual(fc);
+
+    while(!fc->has_vertex(prev))
+    {
+      ++fc;
+      vor[2] = dt.dual(fc);
+      area += polygon_area_2(vor.begin(), vor.end(), dt.geom_traits());
+      vor[1] = vor[2];
+    }
+
+    vor[2] = dt.geom_traits().construct_circumcenter_2_object()(prev->point(),
+                                                                current->point(),
+                                                                p);
+
+    area += polygon_area_2(vor.begin(), vor.end(), dt.geom_traits());
+
+    if(area > 0)
+    {
+      *out++ = std::make_pair(current,area);
+      area_sum += area;
+    }
+
+    //update prev and hit:
+    prev = current;
+    ++hit;
+  }
+  return make_triple(out, area_sum, true);
+}
+
+
+namespace Interpolation {
+namespace internal {
+
+// Same as `natural_neighbors_2(dt, p, out, start)`, but the boundary of the conflict zone
+// is collected in `hole`, which can be reused from one query to the next.
+// `start` is set to the face containing `p`, which is a good hint for a nearby query.
 template < class Dt, class OutputIterator >
 Triple< OutputIterator, typename Dt::Geom_traits::FT, bool >
 natural_neighbors_2(const Dt& dt,
                     const typename Dt::Geom_traits::Point_2& p,
                     OutputIterator out,
-                    typename Dt::Face_handle start = typename Dt::Face_handle())
+                    typename Dt::Face_handle& start,
+                    std::vector<typename Dt::Edge>& hole)
 {
   typedef typename Dt::Geom_traits       Traits;
   typedef typename Traits::FT            Coord_type;
   typedef typename Traits::Point_2       Point_2;
   typedef typename Dt::Face_handle       Face_handle;
   typedef typename Dt::Vertex_handle     Vertex_handle;
-  typedef typename Dt::Edge              Edge;
   typedef typename Dt::Locate_type       Locate_type;
   typedef typename Traits::Equal_x_2     Equal_x_2;
 
@@ -73,6 +152,8 @@ natural_neighbors_2(const Dt& dt,
   Locate_type lt;
   int li;
   Face_handle fh = dt.locate(p, lt, li, start);
+  if(!dt.is_infinite(fh))
+    start = fh;
 
   if (lt == Dt::OUTSIDE_AFFINE_HULL || lt == Dt::OUTSIDE_CONVEX_HULL)
   {
@@ -119,84 +200,30 @@ natural_neighbors_2(const Dt& dt,
     return make_triple(out, Coord_type(1), true);
   }
 
-  std::list<Edge> hole;
+  hole.clear();
   dt.get_boundary_of_conflicts(p, std::back_inserter(hole), fh);
 
-  return natural_neighbors_2(dt, p, out, hole.begin(), hole.end());
+  return CGAL::natural_neighbors_2(dt, p, out, hole.begin(), hole.end());
 }
 
+} // namespace internal
+} // namespace Interpolation
 
-// This function is called when the conflict zone is known.
+//the following two functions suppose that
 // OutputIterator has value type `pair<Dt::Vertex_handle, Dt::Geom_traits::FT>`
-//
-// \pre p must lie inside the hole (=^ inside convex hull of neighbors)
-template < class Dt, class OutputIterator, class EdgeIterator >
+//!!!they are not documented!!!
+template < class Dt, class OutputIterator >
 Triple< OutputIterator, typename Dt::Geom_traits::FT, bool >
 natural_neighbors_2(const Dt& dt,
                     const typename Dt::Geom_traits::Point_2& p,
                     OutputIterator out,
-                    EdgeIterator hole_begin, EdgeIterator hole_end)
+                    typename Dt::Face_handle start = typename Dt::Face_handle())
 {
-  CGAL_precondition(dt.dimension() == 2);
-
-  typedef typename Dt::Geom_traits       Traits;
-  typedef typename Traits::FT            Coord_type;
-  typedef typename Traits::Point_2       Point_2;
-
-  typedef typename Dt::Vertex_handle     Vertex_handle;
-  typedef typename Dt::Face_circulator   Face_circulator;
-
-  std::vector<Point_2> vor(3);
-
-  Coord_type area_sum(0);
-  EdgeIterator hit = hole_end;
-  --hit;
-
-  // At the beginning, `prev` is the "last" vertex of the hole.
-  // Later, `prev` is the last vertex processed (previously).
-  Vertex_handle prev = hit->first->vertex(dt.cw(hit->second));
-  hit = hole_begin;
-
-  while (hit != hole_end)
-  {
-    Coord_type area(0);
-    Vertex_handle current = hit->first->vertex(dt.cw(hit->second));
-
-    vor[0] = dt.geom_traits().construct_circumcenter_2_object()(
-               current->point(),
-               hit->first->vertex(dt.ccw(hit->second))->point(),
-               p);
-
-    Face_circulator fc = dt.incident_faces(current, hit->first);
-    ++fc;
-    vor[1] = dt.dual(fc);
-
-    while(!fc->has_vertex(prev))
-    {
-      ++fc;
-      vor[2] = dt.dual(fc);
-      area += polygon_area_2(vor.begin(), vor.end(), dt.geom_traits());
-      vor[1] = vor[2];
-    }
-
-    vor[2] = dt.geom_traits().construct_circumcenter_2_object()(prev->point(),
-                                                                current->point(),
-                                                                p);
+  std::vector<typename Dt::Edge> hole;
+  return Interpolation::internal::natural_neighbors_2(dt, p, out, start, hole);
+}
 
-    area += polygon_area_2(vor.begin(), vor.end(), dt.geom_traits());
 
-    if(area > 0)
-    {
-      *out++ = std::make_pair(current,area);
-      area_sum += area;
-    }
-
-    //update prev and hit:
-    prev = current;
-    ++hit;
-  }
-  return make_triple(out, area_sum, true);
-}
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -349,6 +376,66 @@ natural_neighbor_coordinates_2(const Dt& dt,
 ////////////////////////////////////////////////////////////////////////////////
 
 
+// Function with a range of query points.
+// The coordinates of `queries[i]` are `coordinates[offsets[i]]`, ..., `coordinates[offsets[i+1]-1]`,
+// and their normalization factor is `norms[i]`. The range is empty if `queries[i]` is outside the convex hull.
+template < class ConcurrencyTag = Sequential_tag, class Dt, class PointRange,
+           class CoordinateVector, class OutputFunctor >
+void
+natural_neighbor_coordinates_2(const Dt& dt,
+                               const PointRange& queries,
+                               CoordinateVector& coordinates,
+                               std::vector<std::size_t>& offsets,
+                               std::vector<typename Dt::Geom_traits::FT>& norms,
+                               OutputFunctor fct)
+{
+  CGAL_precondition(dt.dimension() == 2);
+
+  typedef Interpolation::internal::
+            Project_vertex_output_iterator<
+              std::back_insert_iterator<std::vector<typename CoordinateVector::value_type> >,
+              OutputFunctor>                                              OutputIteratorWithFunctor;
+  typedef typename Dt::Geom_traits::FT                                    FT;
+
+  // the locate hint and the boundary of the conflict zone are kept from one query to the next
+  struct Workspace
+  {
+    typename Dt::Face_handle start;
+    std::vector<typename Dt::Edge> hole;
+  };
+
+  Interpolation::internal::batch_coordinates<ConcurrencyTag, Workspace>(
+    queries, dt.geom_traits(), coordinates, offsets, norms,
+    [&](const typename Dt::Geom_traits::Point_2& p, Workspace& workspace,
+        std::back_insert_iterator<std::vector<typename CoordinateVector::value_type> > out)
+    {
+      Triple<OutputIteratorWithFunctor, FT, bool> result =
+        Interpolation::internal::natural_neighbors_2(dt, p, OutputIteratorWithFunctor(out, fct),
+                                                     workspace.start, workspace.hole);
+      return make_triple(result.first.base(), result.second, result.third);
+    });
+}
+
+// Same as above but without OutputFunctor. Default to extracting the point, for backward compatibility.
+template < class ConcurrencyTag = Sequential_tag, class Dt, class PointRange, class CoordinateVector >
+void
+natural_neighbor_coordinates_2(const Dt& dt,
+                               const PointRange& queries,
+                               CoordinateVector& coordinates,
+                               std::vector<std::size_t>& offsets,
+                               std::vector<typename Dt::Geom_traits::FT>& norms)
+{
+  typedef typename Dt::Geom_traits::FT                            FT;
+  typedef Interpolation::internal::Extract_point_in_pair<Dt, FT>  OutputFunctor;
+
+  natural_neighbor_coordinates_2<ConcurrencyTag>(dt, queries, coordinates, offsets, norms, OutputFunctor());
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+
+
 // OutputIterator has value type `std::pair< Dt::Geom_traits::Point_2, Dt::Geom_traits::FT>`
 template < class Dt, class OutputIterator, class OutputFunctor >
 class natural_neighbor_coordinates_2_object
@@ -15,16 +15,19 @@
 
 #include <CGAL/license/Interpolation.h>
 
+#include <CGAL/Interpolation/internal/batch_queries.h>
+
 #include <CGAL/tags.h>
+#include <CGAL/Handle_hash_function.h>
 #include <CGAL/iterator.h>
 #include <CGAL/utility.h>
 #include <CGAL/assertions.h>
 #include <CGAL/number_utils.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <iostream> //TO DO : to remove
-#include <map>
-#include <set>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -61,15 +64,95 @@ construct_circumcenter(const typename DT::Facet& f,
 // - The normalizing coefficient (sum over i of the a_i)
 // - A boolean specifying whether the calculation has succeeded or not
 
+namespace Interpolation {
+namespace internal {
+
+// The buffers used to compute the natural neighbor coordinates of a point,
+// which can be reused from one query to the next.
+//
+// The cells in conflict with the query are found by a traversal that does not
+// modify the triangulation, so that several queries can be answered concurrently.
+template <class Dt>
+struct Natural_neighbors_3_workspace
+{
+  typedef typename Dt::Cell_handle                  Cell_handle;
+  typedef typename Dt::Vertex_handle                Vertex_handle;
+  typedef typename Dt::Geom_traits::FT              Coord_type;
+
+  // locate hint, set to the cell containing the last query
+  Cell_handle start;
+
+  // the cells in conflict with the query, sorted
+  std::vector<Cell_handle> cells;
+
+  // the contributions of the boundary facets to the coordinates of their vertices
+  std::vector<std::pair<Vertex_handle, Coord_type> > contributions;
+
+  std::unordered_set<Cell_handle, Handle_hash_function> visited;
+  std::vector<Cell_handle> stack;
+
+  bool in_conflict(Cell_handle c) const
+  {
+    return std::binary_search(cells.begin(), cells.end(), c);
+  }
+
+  // collects the cells in conflict with `Q`, starting from the cell `c` which contains `Q`
+  void find_conflicts(const Dt& dt, const typename Dt::Geom_traits::Point_3& Q, Cell_handle c)
+  {
+    cells.clear();
+    visited.clear();
+    stack.clear();
+
+    visited.insert(c);
+    stack.push_back(c);
+    while(!stack.empty())
+    {
+      Cell_handle cc = stack.back();
+      stack.pop_back();
+      cells.push_back(cc);
+      for(int i=0; i<4; ++i)
+      {
+        Cell_handle next = cc->neighbor(i);
+        if(visited.insert(next).second && dt.side_of_sphere(next, Q, true) == ON_BOUNDED_SIDE)
+          stack.push_back(next);
+      }
+    }
+    std::sort(cells.begin(), cells.end());
+  }
+
+  // sums the contributions of each vertex, in the order in which they were added,
+  // and outputs the coordinates sorted by vertex
+  template <class OutputIterator, class Weight>
+  Triple<OutputIterator, Coord_type, bool>
+  output_coordinates(OutputIterator nn_out, Coord_type& norm_coeff, const Weight& weight)
+  {
+    std::stable_sort(contributions.begin(), contributions.end(),
+                     [](const std::pair<Vertex_handle, Coord_type>& a,
+                        const std::pair<Vertex_handle, Coord_type>& b) { return a.first < b.first; });
+
+    norm_coeff = 0;
+    for(std::size_t i=0; i<contributions.size(); )
+    {
+      Vertex_handle v = contributions[i].first;
+      Coord_type coordinate = contributions[i].second;
+      for(++i; i<contributions.size() && contributions[i].first == v; ++i)
+        coordinate += contributions[i].second;
+
+      Coord_type co = weight(v, coordinate);
+      *nn_out++ = std::make_pair(v, co);
+      norm_coeff += co;
+    }
+    return make_triple(nn_out, norm_coeff, true);
+  }
+};
+
 template <class Dt, class OutputIterator>
-Triple< OutputIterator,  // iterator with value type std::pair<Dt::Vertex_handle, Dt::Geom_traits::FT>
-        typename Dt::Geom_traits::FT,  // Should provide 0 and 1
-        bool >
+Triple< OutputIterator, typename Dt::Geom_traits::FT, bool >
 laplace_natural_neighbor_coordinates_3(const Dt& dt,
                                        const typename Dt::Geom_traits::Point_3& Q,
                                        OutputIterator nn_out,
-                                       typename Dt::Geom_traits::FT&  norm_coeff,
-                                       const typename Dt::Cell_handle start = CGAL_TYPENAME_DEFAULT_ARG Dt::Cell_handle())
+                                       typename Dt::Geom_traits::FT& norm_coeff,
+                                       Natural_neighbors_3_workspace<Dt>& workspace)
 {
   typedef typename Dt::Geom_traits Gt;
   typedef typename Gt::Point_3 Point;
@@ -83,7 +166,7 @@ laplace_natural_neighbor_coordinates_3(const Dt& dt,
 
   Locate_type lt;
   int li, lj;
-  Cell_handle c = dt.locate( Q, lt, li, lj, start);
+  Cell_handle c = dt.locate( Q, lt, li, lj, workspace.start);
 
   if ( lt == Dt::VERTEX )
   {
@@ -95,83 +178,68 @@ laplace_natural_neighbor_coordinates_3(const Dt& dt,
     //point outside the convex-hull
     return make_triple(nn_out, Coord_type(1), false);
   }
-
-  std::set<Cell_handle> cells;
-  // To replace the forbidden access to the "in conflict" flag :
-  // std::find operations on this set
-  std::vector<Facet> bound_facets;
-  bound_facets.reserve(32);
+  workspace.start = c;
 
   // Find the cells in conflict with Q
-  dt.find_conflicts(Q, c,
-                    std::back_inserter(bound_facets),
-                    std::inserter(cells, cells.begin()));
+  workspace.find_conflicts(dt, Q, c);
+  workspace.contributions.clear();
 
-  std::map<Vertex_handle,Coord_type> coordinate;
-  typename std::map<Vertex_handle,Coord_type>::iterator coor_it;
-
-  typename std::vector<Facet>::iterator bound_it;
-  for (bound_it = bound_facets.begin(); bound_it != bound_facets.end(); ++bound_it)
+  for(Cell_handle cc1 : workspace.cells)
   {
-    //for each facet on the boundary
-    Facet f1 = *bound_it;
-    Cell_handle cc1 = f1.first;
-    if (dt.is_infinite(cc1))
-      return make_triple(nn_out, norm_coeff=Coord_type(1), false);//point outside the convex-hull
-
-    CGAL_assertion_code(Cell_handle cc2 = cc1->neighbor(f1.second);)
-    CGAL_assertion(std::find(cells.begin(),cells.end(),cc1) != cells.end());//TODO : Delete
-    CGAL_assertion(std::find(cells.begin(),cells.end(),cc2) == cells.end());//TODO : Delete
-
-    Point C_1 = construct_circumcenter<Dt>(f1, Q, dt.geom_traits());
-    for(int j=1; j<4; j++)
+    for(int i=0; i<4; ++i)
     {
-      //for each vertex P of the boundary facet
-      Vertex_handle vP = cc1->vertex((f1.second+j)&3);
-      Vertex_handle vR = cc1->vertex(dt.next_around_edge(f1.second,(f1.second+j)&3));
+      if(workspace.in_conflict(cc1->neighbor(i)))
+        continue;
 
-      // turn around the oriented edge vR vP
-      Cell_handle cc3 = cc1;
-      int num_next = dt.next_around_edge((f1.second+j)&3,f1.second);
+      //for each facet on the boundary
+      Facet f1(cc1, i);
+      if (dt.is_infinite(cc1))
+        return make_triple(nn_out, norm_coeff=Coord_type(1), false);//point outside the convex-hull
 
-      Cell_handle next = cc3->neighbor(num_next);
-      while (std::find(cells.begin(),cells.end(),next) != cells.end())
+      Point C_1 = construct_circumcenter<Dt>(f1, Q, dt.geom_traits());
+      for(int j=1; j<4; j++)
       {
-        CGAL_assertion( next != cc1 );
-        cc3 = next;
-        num_next = dt.next_around_edge(cc3->index(vR),cc3->index(vP));
-        next = cc3->neighbor(num_next);
-      }
+        //for each vertex P of the boundary facet
+        Vertex_handle vP = cc1->vertex((f1.second+j)&3);
+        Vertex_handle vR = cc1->vertex(dt.next_around_edge(f1.second,(f1.second+j)&3));
+
+        // turn around the oriented edge vR vP
+        Cell_handle cc3 = cc1;
+        int num_next = dt.next_around_edge((f1.second+j)&3,f1.second);
+
+        Cell_handle next = cc3->neighbor(num_next);
+        while (workspace.in_conflict(next))
+        {
+          CGAL_assertion( next != cc1 );
+          cc3 = next;
+          num_next = dt.next_around_edge(cc3->index(vR),cc3->index(vP));
+          next = cc3->neighbor(num_next);
+        }
 
-      Point C_3 = construct_circumcenter<Dt>(Facet(cc3,num_next), Q, dt.geom_traits());
-      Point midPQ = midpoint(vP->point(),Q);
-      Coord_type coor_add = signed_area<Gt>(C_3,C_1,midPQ, vP->point(), dt.geom_traits());
-      ((coor_it = coordinate.find(vP)) == coordinate.end())?
-            coordinate[vP] = coor_add : coor_it->second += coor_add; // Replace by a function call
+        Point C_3 = construct_circumcenter<Dt>(Facet(cc3,num_next), Q, dt.geom_traits());
+        Point midPQ = midpoint(vP->point(),Q);
+        Coord_type coor_add = signed_area<Gt>(C_3,C_1,midPQ, vP->point(), dt.geom_traits());
+        workspace.contributions.push_back(std::make_pair(vP, coor_add));
+      }
     }
   } //end : for each facet on the boundary
 
-  norm_coeff = 0;
-  for (coor_it=coordinate.begin(); coor_it!=coordinate.end(); ++coor_it)
-  {
-    Coord_type co = coor_it->second /
-      (CGAL_NTS sqrt(dt.geom_traits().compute_squared_distance_3_object()(
-                                        coor_it->first->point(),Q)));
-    *nn_out++ = std::make_pair(coor_it->first,co);
-    norm_coeff += co;
-  }
-  return make_triple(nn_out, norm_coeff, true);
+  return workspace.output_coordinates(nn_out, norm_coeff,
+                                      [&](Vertex_handle v, const Coord_type& coordinate)
+                                      {
+                                        return coordinate /
+                                          (CGAL_NTS sqrt(dt.geom_traits().compute_squared_distance_3_object()(
+                                                                            v->point(),Q)));
+                                      });
 }
 
 template <class Dt, class OutputIterator>
-Triple< OutputIterator,  // iterator with value type std::pair<Dt::Vertex_handle, Dt::Geom_traits::FT>
-        typename Dt::Geom_traits::FT,  // Should provide 0 and 1
-        bool >
+Triple< OutputIterator, typename Dt::Geom_traits::FT, bool >
 sibson_natural_neighbor_coordinates_3(const Dt& dt,
                                       const typename Dt::Geom_traits::Point_3& Q,
                                       OutputIterator nn_out,
-                                      typename Dt::Geom_traits::FT&  norm_coeff,
-                                      const typename Dt::Cell_handle start = CGAL_TYPENAME_DEFAULT_ARG Dt::Cell_handle())
+                                      typename Dt::Geom_traits::FT& norm_coeff,
+                                      Natural_neighbors_3_workspace<Dt>& workspace)
 {
   typedef typename Dt::Geom_traits Gt;
   typedef typename Gt::Point_3 Point;
@@ -185,7 +253,7 @@ sibson_natural_neighbor_coordinates_3(const Dt& dt,
 
   Locate_type lt;
   int li, lj;
-  Cell_handle c = dt.locate( Q, lt, li, lj, start);
+  Cell_handle c = dt.locate( Q, lt, li, lj, workspace.start);
 
   if ( lt == Dt::VERTEX )
   {
@@ -197,38 +265,27 @@ sibson_natural_neighbor_coordinates_3(const Dt& dt,
     //point outside the convex-hull
     return make_triple(nn_out, Coord_type(1), false);
   }
-
-  std::set<Cell_handle> cells;
-  typename std::set<Cell_handle>::iterator cit;
-  // To replace the forbidden access to the "in conflict" flag :
-  // std::find operations on this set
+  workspace.start = c;
 
   // Find the cells in conflict with Q
-  dt.find_conflicts(Q, c,
-                    Emptyset_iterator(),
-                    std::inserter(cells,cells.begin()));
+  workspace.find_conflicts(dt, Q, c);
+  workspace.contributions.clear();
 
-  std::map<Vertex_handle,Coord_type> coordinate;
-  typename std::map<Vertex_handle,Coord_type>::iterator coor_it;
+  typename Dt::Geom_traits::Compute_volume_3 vol =
+      dt.geom_traits().compute_volume_3_object();
 
-  for (cit = cells.begin(); cit != cells.end(); ++cit)
+  for(Cell_handle cc1 : workspace.cells)
   {
     // for each cell cc1 in conflict
-    Cell_handle cc1 = *cit;
-    CGAL_assertion(std::find(cells.begin(),cells.end(),cc1)!=cells.end());//TODO : Delete
-
     if (dt.is_infinite(cc1))
       return make_triple(nn_out,norm_coeff=Coord_type(1), false);//point outside the convex-hull
 
-    typename Dt::Geom_traits::Compute_volume_3 vol =
-        dt.geom_traits().compute_volume_3_object();
-
     Point C1 = dt.dual(cc1);
     for(int i=0; i<4; i++)
     {
       //for each neighboring cell cc2 of cc1
       Cell_handle cc2 = cc1->neighbor(i);
-      if(std::find(cells.begin(),cells.end(),cc2) == cells.end())
+      if(!workspace.in_conflict(cc2))
       {
         // cc2 outside the conflict cavity
         Point C_1 = construct_circumcenter<Dt>(Facet(cc1,i), Q, dt.geom_traits());
@@ -243,7 +300,7 @@ sibson_natural_neighbor_coordinates_3(const Dt& dt,
           int num_next = dt.next_around_edge((i+j)&3,i);
           Cell_handle next = cc3->neighbor(num_next);
 
-          while (std::find(cells.begin(),cells.end(),next) != cells.end())
+          while (workspace.in_conflict(next))
           { //next is in conflict
             CGAL_assertion( next != cc1 );
             cc3 = next;
@@ -263,13 +320,11 @@ sibson_natural_neighbor_coordinates_3(const Dt& dt,
           Coord_type coor_add = vol(C_1,C1,midPR,midPQ);
           coor_add -= vol(C_1,C_3,midPR,midPQ);
           coor_add += vol(C3,C_3,midPR,midPQ);
-          ((coor_it = coordinate.find(vP)) == coordinate.end())?
-                coordinate[vP] = coor_add : coor_it->second += coor_add;// Replace by a function call
+          workspace.contributions.push_back(std::make_pair(vP, coor_add));
         }
       }
       else // cc2 in the conflict cavity
       {
-        CGAL_assertion(std::find(cells.begin(),cells.end(),cc2)!=cells.end());//TODO : Delete
         if (dt.is_infinite(cc2))
         {
           //point outside the convex-hull
@@ -285,20 +340,91 @@ sibson_natural_neighbor_coordinates_3(const Dt& dt,
           Point midPQ = midpoint(vP->point(),Q);
           Point midPR = midpoint(vP->point(),vR->point());
           Coord_type coor_add = vol(C2,C1,midPR,midPQ);
-          ((coor_it=coordinate.find(vP))==coordinate.end())?
-                coordinate[vP]=coor_add : coor_it->second+=coor_add;// Replace by a function call
+          workspace.contributions.push_back(std::make_pair(vP, coor_add));
         }
       }
     }
   }
 
-  norm_coeff=0;
-  for (coor_it=coordinate.begin(); coor_it!=coordinate.end(); ++coor_it)
-  {
-    *nn_out++ = std::make_pair(coor_it->first,coor_it->second);
-    norm_coeff += coor_it->second;
-  }
-  return make_triple(nn_out,norm_coeff,true);
+  return workspace.output_coordinates(nn_out, norm_coeff,
+                                      [](Vertex_handle, const Coord_type& coordinate) { return coordinate; });
+}
+
+} // namespace internal
+} // namespace Interpolation
+
+template <class Dt, class OutputIterator>
+Triple< OutputIterator,  // iterator with value type std::pair<Dt::Vertex_handle, Dt::Geom_traits::FT>
+        typename Dt::Geom_traits::FT,  // Should provide 0 and 1
+        bool >
+laplace_natural_neighbor_coordinates_3(const Dt& dt,
+                                       const typename Dt::Geom_traits::Point_3& Q,
+                                       OutputIterator nn_out,
+                                       typename Dt::Geom_traits::FT&  norm_coeff,
+                                       const typename Dt::Cell_handle start = CGAL_TYPENAME_DEFAULT_ARG Dt::Cell_handle())
+{
+  Interpolation::internal::Natural_neighbors_3_workspace<Dt> workspace;
+  workspace.start = start;
+  return Interpolation::internal::laplace_natural_neighbor_coordinates_3(dt, Q, nn_out, norm_coeff, workspace);
+}
+
+template <class Dt, class OutputIterator>
+Triple< OutputIterator,  // iterator with value type std::pair<Dt::Vertex_handle, Dt::Geom_traits::FT>
+        typename Dt::Geom_traits::FT,  // Should provide 0 and 1
+        bool >
+sibson_natural_neighbor_coordinates_3(const Dt& dt,
+                                      const typename Dt::Geom_traits::Point_3& Q,
+                                      OutputIterator nn_out,
+                                      typename Dt::Geom_traits::FT&  norm_coeff,
+                                      const typename Dt::Cell_handle start = CGAL_TYPENAME_DEFAULT_ARG Dt::Cell_handle())
+{
+  Interpolation::internal::Natural_neighbors_3_workspace<Dt> workspace;
+  workspace.start = start;
+  return Interpolation::internal::sibson_natural_neighbor_coordinates_3(dt, Q, nn_out, norm_coeff, workspace);
+}
+
+// The next two functions compute the natural neighbors and coordinates of each point of `queries`.
+// The coordinates of `queries[i]` are `coordinates[offsets[i]]`, ..., `coordinates[offsets[i+1]-1]`,
+// with value type `std::pair<Dt::Vertex_handle, Dt::Geom_traits::FT>`, and their normalizing
+// coefficient is `norms[i]`. The range is empty if the calculation has not succeeded.
+// The triangulation is not modified, and the queries are distributed among threads with `Parallel_tag`.
+
+template <class ConcurrencyTag = Sequential_tag, class Dt, class PointRange, class CoordinateVector>
+void
+laplace_natural_neighbor_coordinates_3(const Dt& dt,
+                                       const PointRange& queries,
+                                       CoordinateVector& coordinates,
+                                       std::vector<std::size_t>& offsets,
+                                       std::vector<typename Dt::Geom_traits::FT>& norms)
+{
+  typedef Interpolation::internal::Natural_neighbors_3_workspace<Dt> Workspace;
+
+  Interpolation::internal::batch_coordinates<ConcurrencyTag, Workspace>(
+    queries, dt.geom_traits(), coordinates, offsets, norms,
+    [&](const typename Dt::Geom_traits::Point_3& Q, Workspace& workspace, auto out)
+    {
+      typename Dt::Geom_traits::FT norm_coeff;
+      return Interpolation::internal::laplace_natural_neighbor_coordinates_3(dt, Q, out, norm_coeff, workspace);
+    });
+}
+
+template <class ConcurrencyTag = Sequential_tag, class Dt, class PointRange, class CoordinateVector>
+void
+sibson_natural_neighbor_coordinates_3(const Dt& dt,
+                                      const PointRange& queries,
+                                      CoordinateVector& coordinates,
+                                      std::vector<std::size_t>& offsets,
+                                      std::vector<typename Dt::Geom_traits::FT>& norms)
+{
+  typedef Interpolation::internal::Natural_neighbors_3_workspace<Dt> Workspace;
+
+  Interpolation::internal::batch_coordinates<ConcurrencyTag, Workspace>(
+    queries, dt.geom_traits(), coordinates, offsets, norms,
+    [&](const typename Dt::Geom_traits::Point_3& Q, Workspace& workspace, auto out)
+    {
+      typename Dt::Geom_traits::FT norm_coeff;
+      return Interpolation::internal::sibson_natural_neighbor_coordinates_3(dt, Q, out, norm_coeff, workspace);
+    });
 }
 
 template <typename Dt, typename InputIterator>
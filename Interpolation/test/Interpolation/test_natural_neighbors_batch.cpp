@@ -0,0 +1,232 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Interpolation_traits_2.h>
+#include <CGAL/function_objects.h>
+#include <CGAL/interpolation_functions.h>
+#include <CGAL/natural_neighbor_coordinates_2.h>
+#include <CGAL/natural_neighbor_coordinates_3.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::FT                                               FT;
+typedef K::Point_2                                          Point_2;
+typedef K::Point_3                                          Point_3;
+typedef K::Vector_2                                         Vector_2;
+
+typedef CGAL::Delaunay_triangulation_2<K>                   Dt2;
+typedef CGAL::Delaunay_triangulation_3<K>                   Dt3;
+typedef CGAL::Interpolation_traits_2<K>                     Traits;
+
+bool close(double a, double b)
+{
+  return std::abs(a - b) <= 1e-10 * (std::max)(1., (std::max)(std::abs(a), std::abs(b)));
+}
+
+// the single query functions do not use the locate hint of the previous query,
+// so the coordinates may be listed in a different order, or differ by rounding
+template <class Coordinate>
+void compare_coordinates(std::vector<Coordinate> single, const FT& single_norm, bool single_success,
+                         const std::vector<Coordinate>& coordinates,
+                         const std::vector<std::size_t>& offsets,
+                         const std::vector<FT>& norms,
+                         std::size_t i)
+{
+  if(!single_success)
+  {
+    assert(offsets[i] == offsets[i + 1]);
+    return;
+  }
+
+  std::vector<Coordinate> batch(coordinates.begin() + offsets[i], coordinates.begin() + offsets[i + 1]);
+  assert(single.size() == batch.size());
+  assert(close(single_norm, norms[i]));
+
+  auto less = [](const Coordinate& a, const Coordinate& b) { return a.first < b.first; };
+  std::sort(single.begin(), single.end(), less);
+  std::sort(batch.begin(), batch.end(), less);
+  for(std::size_t j = 0; j < single.size(); ++j)
+  {
+    assert(single[j].first == batch[j].first);
+    assert(close(single[j].second, batch[j].second));
+  }
+}
+
+template <class ConcurrencyTag>
+void test_2(const Dt2& dt, const std::vector<Point_2>& queries)
+{
+  typedef std::pair<Dt2::Vertex_handle, FT>                     Vertex_coordinate;
+  typedef std::pair<Point_2, FT>                                Point_coordinate;
+  typedef CGAL::Identity<Vertex_coordinate>                     Identity;
+
+  // coordinates given with vertices
+  std::vector<Vertex_coordinate> coordinates;
+  std::vector<std::size_t> offsets;
+  std::vector<FT> norms;
+  CGAL::natural_neighbor_coordinates_2<ConcurrencyTag>(dt, queries, coordinates, offsets, norms, Identity());
+  assert(offsets.size() == queries.size() + 1);
+  assert(norms.size() == queries.size());
+  assert(offsets.back() == coordinates.size());
+
+  std::size_t nb_outside = 0;
+  for(std::size_t i = 0; i < queries.size(); ++i)
+  {
+    std::vector<Vertex_coordinate> single;
+    CGAL::Triple<std::back_insert_iterator<std::vector<Vertex_coordinate> >, FT, bool> result =
+      CGAL::natural_neighbor_coordinates_2(dt, queries[i], std::back_inserter(single), Identity());
+    compare_coordinates(single, result.second, result.third, coordinates, offsets, norms, i);
+    if(!result.third)
+      ++nb_outside;
+  }
+  assert(nb_outside > 0);
+
+  // coordinates given with points (default), used for interpolation
+  std::vector<Point_coordinate> point_coordinates;
+  std::vector<std::size_t> point_offsets;
+  std::vector<FT> point_norms;
+  CGAL::natural_neighbor_coordinates_2<ConcurrencyTag>(dt, queries, point_coordinates, point_offsets, point_norms);
+  assert(point_offsets == offsets);
+  assert(point_norms == norms);
+
+  // a linear function, reproduced by both interpolants
+  std::map<Point_2, FT, K::Less_xy_2> values;
+  std::map<Point_2, Vector_2, K::Less_xy_2> gradients;
+  for(Dt2::Finite_vertices_iterator vit = dt.finite_vertices_begin(); vit != dt.finite_vertices_end(); ++vit)
+  {
+    values[vit->point()] = 1 + 2 * vit->point().x() - 3 * vit->point().y();
+    gradients[vit->point()] = Vector_2(2, -3);
+  }
+  CGAL::Data_access<std::map<Point_2, FT, K::Less_xy_2> > value_function(values);
+  CGAL::Data_access<std::map<Point_2, Vector_2, K::Less_xy_2> > gradient_function(gradients);
+
+  std::vector<std::pair<FT, bool> > linear_results, sibson_results;
+  CGAL::linear_interpolation<ConcurrencyTag>(point_coordinates, point_offsets, point_norms,
+                                             value_function, linear_results);
+  CGAL::sibson_c1_interpolation<ConcurrencyTag>(point_coordinates, point_offsets, point_norms, queries,
+                                                value_function, gradient_function, Traits(), sibson_results);
+  assert(linear_results.size() == queries.size());
+  assert(sibson_results.size() == queries.size());
+
+  for(std::size_t i = 0; i < queries.size(); ++i)
+  {
+    const bool inside = (point_offsets[i] != point_offsets[i + 1]);
+    assert(linear_results[i].second == inside);
+    assert(sibson_results[i].second == inside);
+    if(!inside)
+      continue;
+
+    const FT expected = 1 + 2 * queries[i].x() - 3 * queries[i].y();
+    assert(close(linear_results[i].first, expected));
+    assert(close(sibson_results[i].first, expected));
+
+    const FT linear = CGAL::linear_interpolation(point_coordinates.begin() + point_offsets[i],
+                                                 point_coordinates.begin() + point_offsets[i + 1],
+                                                 point_norms[i], value_function);
+    assert(linear == linear_results[i].first);
+  }
+}
+
+template <class ConcurrencyTag>
+void test_3(const Dt3& dt, const std::vector<Point_3>& queries)
+{
+  typedef std::pair<Dt3::Vertex_handle, FT>                     Vertex_coordinate;
+
+  std::vector<Vertex_coordinate> sibson_coordinates, laplace_coordinates;
+  std::vector<std::size_t> sibson_offsets, laplace_offsets;
+  std::vector<FT> sibson_norms, laplace_norms;
+  CGAL::sibson_natural_neighbor_coordinates_3<ConcurrencyTag>(dt, queries, sibson_coordinates,
+                                                              sibson_offsets, sibson_norms);
+  CGAL::laplace_natural_neighbor_coordinates_3<ConcurrencyTag>(dt, queries, laplace_coordinates,
+                                                               laplace_offsets, laplace_norms);
+  assert(sibson_offsets.size() == queries.size() + 1);
+  assert(laplace_offsets.size() == queries.size() + 1);
+
+  for(std::size_t i = 0; i < queries.size(); ++i)
+  {
+    std::vector<Vertex_coordinate> single;
+    FT norm;
+    CGAL::Triple<std::back_insert_iterator<std::vector<Vertex_coordinate> >, FT, bool> result =
+      CGAL::sibson_natural_neighbor_coordinates_3(dt, queries[i], std::back_inserter(single), norm);
+    compare_coordinates(single, norm, result.third, sibson_coordinates, sibson_offsets, sibson_norms, i);
+
+    // the barycenter of the natural neighbors is the query
+    if(result.third)
+    {
+      double x = 0, y = 0, z = 0;
+      for(const Vertex_coordinate& c : single)
+      {
+        x += c.second * c.first->point().x();
+        y += c.second * c.first->point().y();
+        z += c.second * c.first->point().z();
+      }
+      assert(close(x / norm, queries[i].x()) && close(y / norm, queries[i].y()) && close(z / norm, queries[i].z()));
+    }
+
+    single.clear();
+    result = CGAL::laplace_natural_neighbor_coordinates_3(dt, queries[i], std::back_inserter(single), norm);
+    compare_coordinates(single, norm, result.third, laplace_coordinates, laplace_offsets, laplace_norms, i);
+  }
+}
+
+int main()
+{
+  CGAL::Random random(17);
+
+  std::vector<Point_2> points_2;
+  CGAL::Random_points_in_square_2<Point_2> gen_2(1., random);
+  std::copy_n(gen_2, 2000, std::back_inserter(points_2));
+  Dt2 dt2(points_2.begin(), points_2.end());
+
+  // queries inside and outside the convex hull, and on vertices
+  std::vector<Point_2> queries_2;
+  CGAL::Random_points_in_square_2<Point_2> gen_queries_2(1.2, random);
+  std::copy_n(gen_queries_2, 3000, std::back_inserter(queries_2));
+  std::copy_n(points_2.begin(), 20, std::back_inserter(queries_2));
+
+  std::vector<Point_3> points_3;
+  CGAL::Random_points_in_cube_3<Point_3> gen_3(1., random);
+  std::copy_n(gen_3, 1000, std::back_inserter(points_3));
+  Dt3 dt3(points_3.begin(), points_3.end());
+
+  std::vector<Point_3> queries_3;
+  CGAL::Random_points_in_cube_3<Point_3> gen_queries_3(1.1, random);
+  std::copy_n(gen_queries_3, 1000, std::back_inserter(queries_3));
+  std::copy_n(points_3.begin(), 10, std::back_inserter(queries_3));
+
+  std::cout << "Testing batched natural neighbor coordinates" << std::endl;
+  test_2<CGAL::Sequential_tag>(dt2, queries_2);
+  test_3<CGAL::Sequential_tag>(dt3, queries_3);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Testing parallel batched natural neighbor coordinates" << std::endl;
+  test_2<CGAL::Parallel_tag>(dt2, queries_2);
+  test_3<CGAL::Parallel_tag>(dt3, queries_3);
+
+  // the results do not depend on the concurrency tag
+  std::vector<std::pair<Point_2, FT> > sequential_coordinates, parallel_coordinates;
+  std::vector<std::size_t> sequential_offsets, parallel_offsets;
+  std::vector<FT> sequential_norms, parallel_norms;
+  CGAL::natural_neighbor_coordinates_2<CGAL::Sequential_tag>(dt2, queries_2, sequential_coordinates,
+                                                             sequential_offsets, sequential_norms);
+  CGAL::natural_neighbor_coordinates_2<CGAL::Parallel_tag>(dt2, queries_2, parallel_coordinates,
+                                                           parallel_offsets, parallel_norms);
+  assert(sequential_coordinates == parallel_coordinates);
+  assert(sequential_offsets == parallel_offsets);
+  assert(sequential_norms == parallel_norms);
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
@@ -492,27 +492,28 @@ private:
   template <typename Refine_cells_>
   class Scan_cell
   {
+    typedef typename Tr::Triangulation_data_structure::Cell_range::Splittable_range
+                                                  Cell_range;
+
     Refine_cells_                   & m_refine_cells;
-    const std::vector<Cell_handle>  & m_cells;
 
   public:
     // Constructor
-    Scan_cell(Refine_cells_ & rc,
-              const std::vector<Cell_handle> & cells)
-    : m_refine_cells(rc), m_cells(cells)
+    Scan_cell(Refine_cells_ & rc)
+    : m_refine_cells(rc)
     {}
 
     // Constructor
     Scan_cell(const Scan_cell &sc)
-    : m_refine_cells(sc.m_refine_cells), m_cells(sc.m_cells)
+    : m_refine_cells(sc.m_refine_cells)
     {}
 
     // operator()
-    void operator()( const tbb::blocked_range<size_t>& r ) const
+    void operator()( const Cell_range& r ) const
     {
-      for( size_t i = r.begin() ; i != r.end() ; ++i)
+      for(typename Cell_range::iterator it = r.begin() ; it != r.end() ; ++it)
       {
-        Cell_handle c = m_cells[i];
+        Cell_handle c = it;
         if (!m_refine_cells.triangulation().is_infinite(c))
           m_refine_cells.treat_new_cell(c);
       }
@@ -668,28 +669,17 @@ scan_triangulation_impl()
 # endif
     add_to_TLS_lists(true);
 
-    typedef typename Tr::All_cells_iterator All_cells_iterator;
-
     // WITH PARALLEL_FOR
-    // Copy cells into an std::vector to enable the use of tbb::parallel_for
-    // which requires random-access.
-    // Note that we're using all_cells_begin() instead of finite_cells_begin()
+    // The cells are iterated directly in the blocks of the cell container
+    // of the triangulation data structure.
+    // Note that we're iterating over all the cells instead of the finite cells
     // because it's faster to do the is_infinite() test in parallel.
-    std::vector<Cell_handle> cells;
-    cells.reserve(r_tr_.number_of_cells());
-    for(All_cells_iterator cell_it = r_tr_.all_cells_begin();
-        cell_it != r_tr_.all_cells_end();
-        ++cell_it)
-    {
-      cells.push_back(cell_it);
-    }
-
 # if defined(CGAL_MESH_3_VERBOSE) || defined(CGAL_MESH_3_PROFILING)
-    std::cerr << " - Num cells to scan = " << cells.size() << "..." << std::endl;
+    std::cerr << " - Num cells to scan = " << r_tr_.number_of_cells() << "..." << std::endl;
 # endif
     tbb::parallel_for(
-      tbb::blocked_range<size_t>(0, cells.size(), 1000),
-      Scan_cell<Self>(*this, cells)
+      r_tr_.tds().cells().splittable_range(1000),
+      Scan_cell<Self>(*this)
     );
 
     splice_local_lists();
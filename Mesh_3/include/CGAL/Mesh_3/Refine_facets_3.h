@@ -26,6 +26,7 @@
 #include <CGAL/Mesh_3/Mesher_level_default_implementations.h>
 #ifdef CGAL_LINKED_WITH_TBB
   #include <tbb/enumerable_thread_specific.h>
+  #include <tbb/parallel_for.h>
   #include <tbb/parallel_for_each.h>
 #endif
 
@@ -365,6 +366,8 @@ protected:
     Refine_facets_ & m_refine_facets;
 
     typedef typename Refine_facets_::Facet Facet;
+    typedef typename Tr::Triangulation_data_structure::Cell_range::Splittable_range
+                                                  Cell_range;
 
   public:
     // Constructor
@@ -383,6 +386,24 @@ protected:
     {
       m_refine_facets.treat_new_facet(f);
     }
+
+    // operator() for a range of cells, in dimension 3: the facets are
+    // reported by the same cell as with the facet iterator of the TDS
+    void operator()( const Cell_range& r ) const
+    {
+      const Tr& tr = m_refine_facets.triangulation();
+      for(typename Cell_range::iterator it = r.begin() ; it != r.end() ; ++it)
+      {
+        const Cell_handle c = it;
+        for(int i = 0 ; i < 4 ; ++i)
+        {
+          if(c->neighbor(i) < c || tr.is_infinite(c, i))
+            continue;
+          Facet f(c, i);
+          m_refine_facets.treat_new_facet(f);
+        }
+      }
+    }
   };
 
 
@@ -991,11 +1012,23 @@ scan_triangulation_impl()
 # endif
     add_to_TLS_lists(true);
 
-    // PARALLEL FOR_EACH
-    tbb::parallel_for_each(
-      this->r_tr_.finite_facets_begin(), this->r_tr_.finite_facets_end(),
-      typename Rf_base::template Scan_facet<Self>(*this)
-    );
+    // In dimension 3, the facets are found in the blocks of the cell container
+    // of the triangulation data structure, without copying or iterating sequentially
+    if (this->r_tr_.dimension() == 3)
+    {
+      tbb::parallel_for(
+        this->r_tr_.tds().cells().splittable_range(1000),
+        typename Rf_base::template Scan_facet<Self>(*this)
+      );
+    }
+    else
+    {
+      // PARALLEL FOR_EACH
+      tbb::parallel_for_each(
+        this->r_tr_.finite_facets_begin(), this->r_tr_.finite_facets_end(),
+        typename Rf_base::template Scan_facet<Self>(*this)
+      );
+    }
 
     splice_local_lists();
     add_to_TLS_lists(false);
@@ -19,6 +19,10 @@ The parameter `Allocator` has to match the standard allocator
 requirements, with value type `Data`. This parameter has the default
 value `CGAL_ALLOCATOR(Data)`.
 
+The parameter `ImplementationTag` selects the hash table, either
+`Chained_hash_map_tag` (the default) or `Flat_hash_map_tag`,
+see the section Implementation below.
+
 All variables are initialized to `default_data`, a value
 of type `Data` specified in the definition of `map`.
 
@@ -37,8 +41,21 @@ allow for a more time- and space-efficient implementation, see also
 \cgalCite{mn-lpcgc-00}, Chapter 5. This implementation makes also use
 of sentinels that lead to defined keys that have not been inserted.
 
+With `Flat_hash_map_tag`, `Unique_hash_map` is implemented via open
+addressing: the keys and their variables are stored in a single array,
+next to an array of one byte per slot that holds a few bits of the hash
+value, and that is scanned by groups of eight slots. At most three quarters
+of the slots are used. This avoids the overflow area of the chained hashing
+scheme, and is faster when the keys are handles of individually allocated
+elements, such as the ones of a `Polyhedron_3`, and are found in the map.
+As the hash values are mixed before being used, the chained hashing scheme,
+which keeps keys with consecutive hash values next to each other, remains
+faster when the keys are handles of elements stored contiguously, such as
+the ones of a `Compact_container` used by the triangulations, and for the
+lookups of keys that are not in the map.
+
 */
-template< typename Key, typename Data, typename UniqueHashFunction, typename Allocator>
+template< typename Key, typename Data, typename UniqueHashFunction, typename Allocator, typename ImplementationTag>
 class Unique_hash_map {
 public:
 
@@ -174,4 +191,19 @@ Data insert( Key first1, Key beyond1, Data first2);
 /// @}
 
 }; /* end Unique_hash_map */
+
+/*!
+\ingroup MiscellanyRef
+
+Tag selecting the chained hashing implementation of `Unique_hash_map`.
+*/
+struct Chained_hash_map_tag {};
+
+/*!
+\ingroup MiscellanyRef
+
+Tag selecting the open addressing implementation of `Unique_hash_map`.
+*/
+struct Flat_hash_map_tag {};
+
 } /* end namespace CGAL */
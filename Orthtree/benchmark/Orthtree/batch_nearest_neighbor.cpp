@@ -0,0 +1,99 @@
+
+#define CGAL_TRACE_STREAM std::cerr
+
+#include "util.h"
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Octree.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+
+#include <iostream>
+#include <chrono>
+
+using std::chrono::milliseconds;
+
+using Kernel = CGAL::Exact_predicates_inexact_constructions_kernel;
+using Point = Kernel::Point_3;
+using Point_set = CGAL::Point_set_3<Point>;
+using Point_map = Point_set::Point_map;
+using Octree = CGAL::Octree<Kernel, Point_set, Point_map>;
+using Kd_tree_traits = CGAL::Search_traits_3<Kernel>;
+using Kd_tree_search = CGAL::Orthogonal_k_neighbor_search<Kd_tree_traits>;
+using Kdtree = Kd_tree_search::Tree;
+
+// Searches the k nearest neighbors of every point of the set,
+// as done when estimating normals or averaging spacings
+int main(int argc, char **argv) {
+
+  std::size_t k = 10;
+
+  // Set output file
+  std::ofstream file;
+  file.open((argc > 1) ? argv[1] : "../batch_nearest_neighbor_benchmark.csv");
+
+  // Add header for CSV
+  file << "Number of Points,kDTree,Octree,Batched Octree,Parallel Batched Octree \n";
+
+  // Perform tests for various dataset sizes
+  for (std::size_t num_points = 1000; num_points < 2000000; num_points *= 2) {
+
+    auto points = generate<Kernel>(num_points);
+    std::vector<Point> queries(points.points().begin(), points.points().end());
+
+    Kdtree kdtree(points.points().begin(), points.points().end());
+    kdtree.build();
+
+    Octree octree(points, points.point_map());
+    octree.refine();
+
+    // One search object per query with the kd tree
+    auto kdtreeTime = bench<milliseconds>(
+            [&] {
+              for (const Point& query : queries) {
+                Kd_tree_search search(kdtree, query, (unsigned int) (k));
+              }
+            }
+    );
+
+    // One call per query with the octree
+    auto octreeTime = bench<milliseconds>(
+            [&] {
+              std::vector<Point_set::Index> nearest_neighbors;
+              for (const Point& query : queries) {
+                nearest_neighbors.clear();
+                octree.nearest_k_neighbors(query, k, std::back_inserter(nearest_neighbors));
+              }
+            }
+    );
+
+    // All queries at once
+    std::vector<Point_set::Index> neighbors;
+    std::vector<std::size_t> offsets;
+    auto batchedTime = bench<milliseconds>(
+            [&] {
+              octree.nearest_k_neighbors(queries, k, neighbors, offsets);
+            }
+    );
+
+    auto parallelBatchedTime = bench<milliseconds>(
+            [&] {
+              octree.nearest_k_neighbors<CGAL::Parallel_if_available_tag>(queries, k, neighbors, offsets);
+            }
+    );
+
+    file << num_points << ",";
+    file << kdtreeTime.count() << ",";
+    file << octreeTime.count() << ",";
+    file << batchedTime.count() << ",";
+    file << parallelBatchedTime.count() << ",";
+    file << "\n";
+
+    std::cout << num_points << std::endl;
+  }
+
+  file.close();
+
+  return 0;
+}
@@ -33,7 +33,7 @@ int main(int argc, char **argv) {
   file.open((argc > 1) ? argv[1] : "../construction_benchmark.csv");
 
   // Add header for CSV
-  file << "Number of Points,Octree,kDTree \n";
+  file << "Number of Points,Octree,Parallel Octree,Morton Octree,kDTree \n";
 
   // Perform tests for various dataset sizes
   for (size_t num_points = 10; num_points < 10000000; num_points *= 1.1) {
@@ -50,6 +50,24 @@ int main(int argc, char **argv) {
             }
     );
 
+    auto parallelOctreePoints = points;
+    auto parallelOctreeTime = bench<milliseconds>(
+            [&] {
+              // Build the tree in parallel
+              Octree octree(parallelOctreePoints, parallelOctreePoints.point_map());
+              octree.refine<CGAL::Parallel_if_available_tag>();
+            }
+    );
+
+    auto mortonOctreePoints = points;
+    auto mortonOctreeTime = bench<milliseconds>(
+            [&] {
+              // Build the tree from the sorted Morton codes of the points
+              Octree octree(mortonOctreePoints, mortonOctreePoints.point_map());
+              octree.refine_with_morton_codes<CGAL::Parallel_if_available_tag>();
+            }
+    );
+
     auto kdtreePoints = points;
     auto kdtreeTime = bench<milliseconds>(
             [&] {
@@ -61,6 +79,8 @@ int main(int argc, char **argv) {
 
     file << num_points << ",";
     file << octreeTime.count() << ",";
+    file << parallelOctreeTime.count() << ",";
+    file << mortonOctreeTime.count() << ",";
     file << kdtreeTime.count() << "\n";
 
     std::cout << num_points << std::endl;
@@ -54,6 +54,9 @@ public:
    * For a tree in which each node contains a span, this may mean rearranging the contents of the original node
    * and producing spans containing a subset of its contents for each of its children.
    * For compatibility with locate, the center of the node is considered to be part of the upper half.
+   *
+   * When the tree is refined in parallel, the functor is called concurrently on different nodes and must
+   * therefore only modify the data of the node and of its children.
    */
   using Distribute_node_contents = unspecified_type;
 
@@ -72,5 +75,13 @@ public:
    */
   Distribute_node_contents distribute_node_contents_object() const;
 
+  /*!
+   * optionally, constructs an object of type `Distribute_node_contents` which distributes the contents
+   * of a single node in parallel if `ConcurrencyTag` is `Parallel_tag`. If this overload is not provided,
+   * `distribute_node_contents_object()` is used.
+   */
+  template <typename ConcurrencyTag>
+  Distribute_node_contents distribute_node_contents_object() const;
+
   /// @}
 };
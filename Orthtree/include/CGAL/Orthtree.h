@@ -26,6 +26,13 @@
 #include <CGAL/property_map.h>
 #include <CGAL/intersections.h>
 #include <CGAL/squared_distance_3.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
 
 #include <boost/function.hpp>
 #include <boost/iterator/iterator_facade.hpp>
@@ -36,11 +43,17 @@
 #include <ostream>
 #include <functional>
 
+#include <algorithm>
+#include <array>
 #include <bitset>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
 #include <stack>
 #include <queue>
 #include <vector>
 #include <math.h>
+#include <tuple>
 #include <utility>
 
 #include <boost/mpl/has_xxx.hpp>
@@ -52,6 +65,81 @@ namespace Orthtree_impl {
 BOOST_MPL_HAS_XXX_TRAIT_DEF(Node_data)
 BOOST_MPL_HAS_XXX_TRAIT_DEF(Squared_distance_of_element)
 
+// detects traits providing `distribute_node_contents_object<ConcurrencyTag>()`,
+// in which case the contents of a single node may be distributed in parallel
+template <class GT, class ConcurrencyTag, class = void>
+struct Has_concurrent_distribute_node_contents : std::false_type {};
+
+template <class GT, class ConcurrencyTag>
+struct Has_concurrent_distribute_node_contents<GT, ConcurrencyTag,
+  std::void_t<decltype(std::declval<const GT&>().template distribute_node_contents_object<ConcurrencyTag>())> >
+  : std::true_type {};
+
+// Sorts `keys` by increasing value of their `nb_bits` lowest bits, with an LSD radix sort,
+// and applies the same permutation to `values`. The sort is stable.
+template <typename ConcurrencyTag, typename Value>
+void radix_sort_by_keys(std::vector<std::uint64_t>& keys, std::vector<Value>& values, int nb_bits)
+{
+  constexpr int digit_bits = 8;
+  constexpr std::size_t nb_digits = std::size_t(1) << digit_bits;
+
+  const std::size_t size = keys.size();
+  std::size_t nb_blocks = 1;
+#ifdef CGAL_LINKED_WITH_TBB
+  if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    nb_blocks = (std::max)(std::size_t(1), (std::min)(std::size_t(256), size / (std::size_t(1) << 14)));
+#endif
+  const std::size_t block_size = (size + nb_blocks - 1) / nb_blocks;
+
+  std::vector<std::uint64_t> other_keys(size);
+  std::vector<Value> other_values(size);
+  std::vector<std::size_t> offsets(nb_blocks * nb_digits);
+
+  auto for_each_block = [&](const auto& f) {
+#ifdef CGAL_LINKED_WITH_TBB
+    if (nb_blocks > 1) {
+      tbb::parallel_for(std::size_t(0), nb_blocks, f);
+      return;
+    }
+#endif
+    for (std::size_t b = 0; b < nb_blocks; ++b)
+      f(b);
+  };
+
+  for (int shift = 0; shift < nb_bits; shift += digit_bits) {
+
+    // Histogram of the digits of each block
+    std::fill(offsets.begin(), offsets.end(), 0);
+    for_each_block([&](std::size_t b) {
+      std::size_t* histogram = offsets.data() + b * nb_digits;
+      for (std::size_t i = b * block_size; i < (std::min)(size, (b + 1) * block_size); ++i)
+        ++histogram[(keys[i] >> shift) & (nb_digits - 1)];
+    });
+
+    // Exclusive prefix sum, digit-major so that the sort is stable
+    std::size_t sum = 0;
+    for (std::size_t d = 0; d < nb_digits; ++d) {
+      for (std::size_t b = 0; b < nb_blocks; ++b) {
+        std::size_t count = offsets[b * nb_digits + d];
+        offsets[b * nb_digits + d] = sum;
+        sum += count;
+      }
+    }
+
+    for_each_block([&](std::size_t b) {
+      std::size_t* offset = offsets.data() + b * nb_digits;
+      for (std::size_t i = b * block_size; i < (std::min)(size, (b + 1) * block_size); ++i) {
+        std::size_t target = offset[(keys[i] >> shift) & (nb_digits - 1)]++;
+        other_keys[target] = keys[i];
+        other_values[target] = std::move(values[i]);
+      }
+    });
+
+    keys.swap(other_keys);
+    values.swap(other_values);
+  }
+}
+
 template <class GT, bool has_data>
 struct Node_data_wrapper;
 
@@ -331,10 +419,28 @@ public:
     while nodes that were not split and for which `split_predicate`
     returns `true` are split.
 
+    \tparam ConcurrencyTag enables sequential versus parallel refinement.
+    Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    In parallel mode, the tree is refined level by level: the split predicate is evaluated
+    and the contents of the split nodes are distributed concurrently, so both must be thread-safe.
+    The resulting tree, including its node indices and the set of elements of each node, is the same
+    as in sequential mode, but the order of the elements within the range of a node may differ.
+
     \param split_predicate determines whether or not a leaf node needs to be subdivided.
    */
+  template <typename ConcurrencyTag = Sequential_tag>
   void refine(const Split_predicate& split_predicate) {
 
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      parallel_refine(split_predicate);
+      return;
+    }
+#endif
+
     // Initialize a queue of nodes that need to be refined
     std::queue<Node_index> todo;
     todo.push(0);
@@ -382,11 +488,145 @@ public:
     \warning This convenience method is only appropriate for trees with traits classes where
     `Node_data` is a model of `Range`. `RandomAccessRange` is suggested for performance.
 
+    \tparam ConcurrencyTag enables sequential versus parallel refinement.
+    Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
     \param max_depth deepest a tree is allowed to be (nodes at this depth will not be split).
     \param bucket_size maximum number of items a node is allowed to contain.
    */
+  template <typename ConcurrencyTag = Sequential_tag>
   void refine(size_t max_depth = 10, size_t bucket_size = 20) {
-    refine(Orthtrees::Maximum_depth_and_maximum_contained_elements(max_depth, bucket_size));
+    refine<ConcurrencyTag>(Orthtrees::Maximum_depth_and_maximum_contained_elements(max_depth, bucket_size));
+  }
+
+  /*!
+    \brief refines the orthtree using a maximum depth and a maximum number of contained
+    elements in a node as split predicate, by sorting the elements along a Morton curve.
+
+    This builds a linear orthtree: the Morton code of each element is computed, the
+    elements are radix-sorted by code, and the nodes are derived from the sorted codes
+    in a single breadth-first pass, without redistributing the contents of each split node.
+    The resulting tree, including its node indices and the set of elements of each node,
+    is the same as with `refine(max_depth, bucket_size)`, but the order of the elements within
+    the range of a node may differ.
+
+    \tparam ConcurrencyTag enables sequential versus parallel computation and sorting of the codes.
+    Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
+    \param max_depth deepest a tree is allowed to be (nodes at this depth will not be split).
+    \param bucket_size maximum number of items a node is allowed to contain.
+
+    \pre The orthtree has not been refined yet, that is, the root is a leaf.
+
+    \warning This function is only available for traits classes where `Node_data` is a
+    `boost::iterator_range` over a `RandomAccessRange` of elements and that provide the function
+    `get_geometric_object_for_element_object()` returning the point of an element, such as
+    `Orthtree_traits_point`. If `dimension * max_depth` exceeds 64, `refine(max_depth, bucket_size)` is used instead.
+   */
+  template <typename ConcurrencyTag = Sequential_tag>
+  void refine_with_morton_codes(std::size_t max_depth = 10, std::size_t bucket_size = 20) {
+
+    CGAL_precondition(is_leaf(root()));
+
+    if (std::size_t(dimension) * max_depth > 64) {
+      refine<ConcurrencyTag>(max_depth, bucket_size);
+      return;
+    }
+
+    using Element = typename std::iterator_traits<decltype(data(root()).begin())>::value_type;
+
+    const auto begin = data(root()).begin();
+    const auto element_point = m_traits.get_geometric_object_for_element_object();
+    const int nb_bits = int(dimension * max_depth);
+
+    // The codes are computed by descending along each axis with the barycenters
+    // of the nodes, exactly as `split()` would, which requires the side lengths
+    // of all depths up to `max_depth`.
+    while (m_side_per_depth.size() <= max_depth) {
+      Bbox_dimensions child_size;
+      for (int i = 0; i < dimension; ++i)
+        child_size[i] = m_side_per_depth.back()[i] / FT(2);
+      m_side_per_depth.push_back(child_size);
+    }
+
+    const std::size_t nb_elements = std::distance(begin, data(root()).end());
+    std::vector<std::uint64_t> codes(nb_elements);
+    std::vector<std::size_t> order(nb_elements);
+
+    auto compute_codes = [&](std::size_t first, std::size_t last) {
+      for (std::size_t e = first; e < last; ++e) {
+        const auto& p = element_point(*(begin + e));
+        std::uint64_t code = 0;
+        for (int i = 0; i < dimension; ++i) {
+          // the global coordinate is kept as a `FT`, as it may not fit in an `int` at deep levels
+          FT gc(0);
+          for (std::size_t d = 0; d < max_depth; ++d) {
+            // same as `compute_cartesian_coordinate(2 * gc + 1, d + 1, i)` since `2 * gc + 1` is odd
+            const FT center = (m_bbox.min)()[i] + (FT(2) * gc + FT(1)) * m_side_per_depth[d + 1][i];
+            const bool upper = !(p[i] < center);
+            gc = FT(2) * gc + FT(int(upper));
+            if (upper)
+              code |= std::uint64_t(1) << (dimension * (max_depth - 1 - d) + i);
+          }
+        }
+        codes[e] = code;
+        order[e] = e;
+      }
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_elements),
+                        [&](const tbb::blocked_range<std::size_t>& r) { compute_codes(r.begin(), r.end()); });
+    }
+    else
+#endif
+    {
+      compute_codes(0, nb_elements);
+    }
+
+    Orthtree_impl::radix_sort_by_keys<ConcurrencyTag>(codes, order, nb_bits);
+
+    // Reorder the elements along the curve
+    {
+      std::vector<Element> elements(begin, begin + nb_elements);
+      for (std::size_t e = 0; e < nb_elements; ++e)
+        *(begin + e) = std::move(elements[order[e]]);
+    }
+
+    // Nodes are created in the same breadth-first order as `refine()`
+    std::queue<std::tuple<Node_index, std::size_t, std::size_t> > todo;
+    todo.emplace(root(), 0, nb_elements);
+    std::size_t deepest = 0;
+
+    while (!todo.empty()) {
+      auto [current, first, last] = todo.front();
+      todo.pop();
+
+      const std::size_t current_depth = depth(current);
+      deepest = (std::max)(deepest, current_depth);
+
+      if (last - first <= bucket_size || current_depth >= max_depth)
+        continue;
+
+      create_children(current);
+
+      // The codes of the elements of `current` share their first `current_depth` digits,
+      // and their next digit is the local coordinates of the child containing them
+      const int shift = int(dimension * (max_depth - 1 - current_depth));
+      for (int c = 0; c < degree; ++c) {
+        std::size_t child_last = std::partition_point(codes.begin() + first, codes.begin() + last,
+                                                      [&](std::uint64_t code) {
+                                                        return int((code >> shift) & (degree - 1)) <= c;
+                                                      }) - codes.begin();
+        Node_index ch = child(current, c);
+        data(ch) = {begin + first, begin + child_last};
+        todo.emplace(ch, first, child_last);
+        first = child_last;
+      }
+    }
+
+    m_side_per_depth.resize(deepest + 1);
   }
 
   /*!
@@ -394,9 +634,25 @@ public:
     between two immediate neighbor leaves is never more than 1.
 
     This is done only by adding nodes, nodes are never removed.
+
+    \tparam ConcurrencyTag enables sequential versus parallel grading.
+    Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    The resulting tree has the same topology in both modes, but node indices may differ.
+    In parallel mode, the contents of the split nodes are distributed concurrently.
    */
+  template <typename ConcurrencyTag = Sequential_tag>
   void grade() {
 
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      parallel_grade();
+      return;
+    }
+#endif
+
     // Collect all the leaf nodes
     std::queue<Node_index> leaf_nodes;
     for (Node_index leaf: traverse(Orthtrees::Leaves_traversal<Self>(*this))) {
@@ -415,6 +671,7 @@ public:
         continue;
 
       // Iterate over each of the neighbors
+      bool split_neighbor = false;
       for (int direction = 0; direction < 6; ++direction) {
 
         // Get the neighbor
@@ -444,8 +701,13 @@ public:
           for (int i = 0; i < degree; ++i) {
             leaf_nodes.push(child(*neighbor, i));
           }
+          split_neighbor = true;
         }
       }
+
+      // The children of a split neighbor may still be too large compared to this node
+      if (split_neighbor)
+        leaf_nodes.push(node);
     }
   }
 
@@ -735,12 +997,6 @@ public:
     CGAL_precondition(k > 0);
     Sphere query_sphere = query;
 
-    // todo: this type is over-constrained, this must be made more generic
-    struct Node_element_with_distance {
-      typename Traits::Node_data_element element;
-      FT distance;
-    };
-
     // Create an empty list of elements
     std::vector<Node_element_with_distance> element_list;
     if (k != (std::numeric_limits<std::size_t>::max)())
@@ -756,6 +1012,94 @@ public:
     return output;
   }
 
+  /*!
+  \brief finds the `k` nearest neighbors of each point of `queries`.
+
+  The results are stored contiguously: the neighbors of the `i`-th query are
+  `neighbors[offsets[i]]`, ..., `neighbors[offsets[i+1]-1]`, in order of increasing distance to the query.
+  This is equivalent to calling `nearest_k_neighbors()` for each query, but the search buffers are reused
+  from one query to the next and, with `CGAL::Parallel_tag`, the queries are distributed among threads.
+
+  \tparam ConcurrencyTag enables sequential versus parallel queries.
+  Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+  \tparam QueryRange a model of `ForwardRange` with value type `Point`
+  (random access iterators are recommended with `CGAL::Parallel_tag`).
+  \tparam NeighborVector `std::vector<GeomTraits::Node_data_element>`
+
+  \param queries query points
+  \param k number of neighbors to find for each query
+  \param neighbors the elements found (cleared first)
+  \param offsets resized to `queries.size() + 1`, positions in `neighbors` of the results of each query
+
+  \warning Nearest neighbor searches requires `GeomTraits` to be a model of `CollectionPartitioningOrthtreeTraits`.
+ */
+  template <typename ConcurrencyTag = Sequential_tag, typename QueryRange, typename NeighborVector>
+  auto nearest_k_neighbors(const QueryRange& queries,
+                           std::size_t k,
+                           NeighborVector& neighbors,
+                           std::vector<std::size_t>& offsets) const -> std::enable_if_t<supports_neighbor_search> {
+    CGAL_precondition(k > 0);
+    batch_neighbor_search<ConcurrencyTag>(queries, k,
+                                          [&](const Point& query) {
+                                            return Sphere(query, (std::numeric_limits<FT>::max)());
+                                          },
+                                          neighbors, offsets);
+  }
+
+  /*!
+  \brief finds the elements in each sphere of `queries`.
+
+  The results are stored as for the batched `nearest_k_neighbors()`, in order of increasing distance
+  to the center of the corresponding sphere.
+
+  \tparam ConcurrencyTag enables sequential versus parallel queries.
+  Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+  \tparam QueryRange a model of `ForwardRange` with value type `Sphere`
+  \tparam NeighborVector `std::vector<GeomTraits::Node_data_element>`
+
+  \param queries query spheres
+  \param neighbors the elements found (cleared first)
+  \param offsets resized to `queries.size() + 1`, positions in `neighbors` of the results of each query
+
+  \warning Nearest neighbor searches requires `GeomTraits` to be a model of `CollectionPartitioningOrthtreeTraits`.
+ */
+  template <typename ConcurrencyTag = Sequential_tag, typename QueryRange, typename NeighborVector>
+  auto neighbors_within_radius(const QueryRange& queries,
+                               NeighborVector& neighbors,
+                               std::vector<std::size_t>& offsets) const -> std::enable_if_t<supports_neighbor_search> {
+    batch_neighbor_search<ConcurrencyTag>(queries, (std::numeric_limits<std::size_t>::max)(),
+                                          [](const Sphere& query) { return query; },
+                                          neighbors, offsets);
+  }
+
+  /*!
+  \brief finds, for each sphere of `queries`, at most `k` elements of the sphere that are nearest to its center.
+
+  The results are stored as for the batched `nearest_k_neighbors()`.
+
+  \tparam ConcurrencyTag enables sequential versus parallel queries.
+  Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+  \tparam QueryRange a model of `ForwardRange` with value type `Sphere`
+  \tparam NeighborVector `std::vector<GeomTraits::Node_data_element>`
+
+  \param queries query spheres
+  \param k maximal number of elements to find for each query
+  \param neighbors the elements found (cleared first)
+  \param offsets resized to `queries.size() + 1`, positions in `neighbors` of the results of each query
+
+  \warning Nearest neighbor searches requires `GeomTraits` to be a model of `CollectionPartitioningOrthtreeTraits`.
+ */
+  template <typename ConcurrencyTag = Sequential_tag, typename QueryRange, typename NeighborVector>
+  auto nearest_k_neighbors_within_radius(const QueryRange& queries,
+                                         std::size_t k,
+                                         NeighborVector& neighbors,
+                                         std::vector<std::size_t>& offsets) const -> std::enable_if_t<supports_neighbor_search> {
+    CGAL_precondition(k > 0);
+    batch_neighbor_search<ConcurrencyTag>(queries, k,
+                                          [](const Sphere& query) { return query; },
+                                          neighbors, offsets);
+  }
+
   /*!
     \brief finds the leaf nodes that intersect with any primitive.
 
@@ -1054,43 +1398,8 @@ public:
     \param n index of the node to split
  */
   void split(Node_index n) {
-
-    // Make sure the node hasn't already been split
-    CGAL_precondition (is_leaf(n));
-
-    // Split the node to create children
-    using Local_coordinates = Local_coordinates;
-    m_node_children[n] = m_node_properties.emplace_group(degree);
-    for (std::size_t i = 0; i < degree; i++) {
-
-      Node_index c = *m_node_children[n] + i;
-
-      // Make sure the node isn't one of its own children
-      CGAL_assertion(n != *m_node_children[n] + i);
-
-      Local_coordinates local_coordinates{i};
-      for (int i = 0; i < dimension; i++)
-        m_node_coordinates[c][i] = (2 * m_node_coordinates[n][i]) + local_coordinates[i];
-      m_node_depths[c] = m_node_depths[n] + 1;
-      m_node_parents[c] = n;
-    }
-
-    // Check if we've reached a new max depth
-    if (depth(n) + 1 == m_side_per_depth.size()) {
-      // Update the side length map with the dimensions of the children
-      Bbox_dimensions size = m_side_per_depth.back();
-      Bbox_dimensions child_size;
-      for (int i = 0; i < dimension; ++i)
-        child_size[i] = size[i] / FT(2);
-      m_side_per_depth.push_back(child_size);
-    }
-
-    // Find the point around which the node is split
-    Point center = barycenter(n);
-
-    // Add the node's contents to its children
-    if constexpr (has_data)
-      m_traits.distribute_node_contents_object()(n, *this, center);
+    create_children(n);
+    distribute_node_contents<Sequential_tag>(n);
   }
 
   /*!
@@ -1261,6 +1570,176 @@ public:
 
 private: // functions :
 
+  // Creates the children of `n` without distributing its contents
+  void create_children(Node_index n) {
+
+    // Make sure the node hasn't already been split
+    CGAL_precondition (is_leaf(n));
+
+    // Split the node to create children
+    using Local_coordinates = Local_coordinates;
+    // Nodes are never erased, so there is no free region to look for
+    m_node_children[n] = m_node_properties.emplace_group_back(degree);
+    for (std::size_t i = 0; i < degree; i++) {
+
+      Node_index c = *m_node_children[n] + i;
+
+      // Make sure the node isn't one of its own children
+      CGAL_assertion(n != *m_node_children[n] + i);
+
+      Local_coordinates local_coordinates{i};
+      for (int i = 0; i < dimension; i++)
+        m_node_coordinates[c][i] = (2 * m_node_coordinates[n][i]) + local_coordinates[i];
+      m_node_depths[c] = m_node_depths[n] + 1;
+      m_node_parents[c] = n;
+    }
+
+    // Check if we've reached a new max depth
+    if (depth(n) + 1 == m_side_per_depth.size()) {
+      // Update the side length map with the dimensions of the children
+      Bbox_dimensions size = m_side_per_depth.back();
+      Bbox_dimensions child_size;
+      for (int i = 0; i < dimension; ++i)
+        child_size[i] = size[i] / FT(2);
+      m_side_per_depth.push_back(child_size);
+    }
+  }
+
+  // Adds the node's contents to its children
+  template <typename ConcurrencyTag>
+  void distribute_node_contents(Node_index n) {
+    if constexpr (has_data) {
+
+      // Find the point around which the node is split
+      Point center = barycenter(n);
+
+      if constexpr (Orthtree_impl::Has_concurrent_distribute_node_contents<Traits, ConcurrencyTag>::value)
+        m_traits.template distribute_node_contents_object<ConcurrencyTag>()(n, *this, center);
+      else
+        m_traits.distribute_node_contents_object()(n, *this, center);
+    }
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // Distributes the contents of the nodes in `nodes`, which must have just been split.
+  // Large nodes get their contents distributed one at a time, with the traits
+  // parallel distribution if available, small ones are processed concurrently.
+  void parallel_distribute_node_contents(const std::vector<Node_index>& nodes) {
+    if constexpr (has_data) {
+      if constexpr (Orthtree_impl::Has_concurrent_distribute_node_contents<Traits, Parallel_tag>::value) {
+        if (nodes.size() < 8) {
+          for (Node_index n : nodes)
+            distribute_node_contents<Parallel_tag>(n);
+          return;
+        }
+      }
+
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nodes.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r) {
+                          for (std::size_t i = r.begin(); i != r.end(); ++i)
+                            distribute_node_contents<Sequential_tag>(nodes[i]);
+                        });
+    }
+  }
+
+  void parallel_refine(const Split_predicate& split_predicate) {
+
+    // The tree is refined level by level. Nodes are created sequentially in the
+    // order of the breadth-first traversal of `refine()`, so that node indices are
+    // the same as in sequential mode. Property arrays are only resized during that
+    // sequential step, which makes the concurrent evaluation of the split predicate
+    // and distribution of the node contents safe.
+    std::vector<Node_index> level{root()}, next_level, split_nodes;
+    std::vector<unsigned char> must_split;
+
+    while (!level.empty()) {
+
+      must_split.assign(level.size(), false);
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, level.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r) {
+                          for (std::size_t i = r.begin(); i != r.end(); ++i)
+                            must_split[i] = split_predicate(level[i], *this);
+                        });
+
+      split_nodes.clear();
+      next_level.clear();
+      for (std::size_t i = 0; i < level.size(); ++i) {
+        Node_index current = level[i];
+        if (must_split[i] && is_leaf(current)) {
+          create_children(current);
+          split_nodes.push_back(current);
+        }
+
+        if (!is_leaf(current))
+          for (int c = 0; c < degree; ++c)
+            next_level.push_back(child(current, c));
+      }
+
+      parallel_distribute_node_contents(split_nodes);
+
+      level.swap(next_level);
+    }
+  }
+
+  void parallel_grade() {
+
+    // Same as `grade()`, but processed in rounds: the leaves violating the grading rule
+    // are found concurrently, then split, and their children are checked in the next round.
+    std::vector<Node_index> leaves;
+    for (Node_index leaf: traverse(Orthtrees::Leaves_traversal<Self>(*this)))
+      leaves.push_back(leaf);
+
+    std::vector<std::array<std::optional<Node_index>, 6> > to_split;
+    std::vector<Node_index> split_nodes, next_leaves;
+
+    while (!leaves.empty()) {
+
+      to_split.assign(leaves.size(), {});
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, leaves.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r) {
+                          for (std::size_t i = r.begin(); i != r.end(); ++i) {
+                            Node_index node = leaves[i];
+                            if (!is_leaf(node))
+                              continue;
+
+                            for (int direction = 0; direction < 6; ++direction) {
+                              auto neighbor = adjacent_node(node, direction);
+                              if (!neighbor || parent(*neighbor) == parent(node) || !is_leaf(*neighbor))
+                                continue;
+                              if ((depth(node) - depth(*neighbor)) > 1)
+                                to_split[i][direction] = neighbor;
+                            }
+                          }
+                        });
+
+      split_nodes.clear();
+      next_leaves.clear();
+      for (std::size_t i = 0; i < leaves.size(); ++i) {
+        bool split_neighbor = false;
+        for (const auto& neighbor : to_split[i]) {
+          if (!neighbor)
+            continue;
+          split_neighbor = true;
+          // a neighbor may be shared by several leaves
+          if (!is_leaf(*neighbor))
+            continue;
+          create_children(*neighbor);
+          split_nodes.push_back(*neighbor);
+          for (int c = 0; c < degree; ++c)
+            next_leaves.push_back(child(*neighbor, c));
+        }
+
+        // The children of a split neighbor may still be too large compared to this leaf
+        if (split_neighbor)
+          next_leaves.push_back(leaves[i]);
+      }
+
+      parallel_distribute_node_contents(split_nodes);
+      leaves.swap(next_leaves);
+    }
+  }
+#endif // CGAL_LINKED_WITH_TBB
+
   Node_index recursive_descendant(Node_index node, std::size_t i) { return child(node, i); }
 
   template <typename... Indices>
@@ -1298,6 +1777,12 @@ private: // functions :
     return output;
   }
 
+  // Element found by a neighbor search, paired with its squared distance to the query
+  struct Node_element_with_distance {
+    typename Traits::Node_data_element element;
+    FT distance;
+  };
+
   template <typename Result>
   auto nearest_k_neighbors_recursive(
     Sphere& search_bounds,
@@ -1306,6 +1791,30 @@ private: // functions :
     std::size_t k,
     FT epsilon = 0) const -> std::enable_if_t<supports_neighbor_search> {
 
+    Bbox b = bbox(node);
+    std::array<FT, dimension> node_min, node_max;
+    for (int i = 0; i < dimension; ++i) {
+      node_min[i] = (b.min)()[i];
+      node_max[i] = (b.max)()[i];
+    }
+
+    nearest_k_neighbors_recursive(search_bounds, node, node_min, node_max, results, k, epsilon);
+  }
+
+  // `node_min` and `node_max` are the corners of `bbox(node)`: the boxes of the children are deduced
+  // from them and from the barycenter of `node`, which gives the same coordinates as `bbox(child)`
+  template <typename Result>
+  auto nearest_k_neighbors_recursive(
+    Sphere& search_bounds,
+    Node_index node,
+    const std::array<FT, dimension>& node_min,
+    const std::array<FT, dimension>& node_max,
+    std::vector<Result>& results,
+    std::size_t k,
+    FT epsilon) const -> std::enable_if_t<supports_neighbor_search> {
+
+    const Point search_center = m_traits.construct_center_d_object()(search_bounds);
+
     // Check whether the node has children
     if (is_leaf(node)) {
 
@@ -1317,7 +1826,7 @@ private: // functions :
 
         // Pair that element with its distance from the search point
         Result current_element_with_distance =
-        { e, m_traits.squared_distance_of_element_object()(e, m_traits.construct_center_d_object()(search_bounds)) };
+        { e, m_traits.squared_distance_of_element_object()(e, search_center) };
 
         // Check if the new element is within the bounds
         if (current_element_with_distance.distance < m_traits.compute_squared_radius_d_object()(search_bounds)) {
@@ -1328,19 +1837,18 @@ private: // functions :
             results.pop_back();
           }
 
-          // Add the new element
-          results.push_back(current_element_with_distance);
-
-          // Sort the list
-          std::sort(results.begin(), results.end(), [=](auto& left, auto& right) {
-            return left.distance < right.distance;
-            });
+          // Insert the new element, keeping the list sorted by distance
+          auto position = std::upper_bound(results.begin(), results.end(), current_element_with_distance.distance,
+                                           [](const FT& distance, const Result& r) {
+                                             return distance < r.distance;
+                                           });
+          results.insert(position, current_element_with_distance);
 
           // Check if the results list is full
           if (results.size() == k) {
 
             // Set the search radius
-            search_bounds = m_traits.construct_sphere_d_object()(m_traits.construct_center_d_object()(search_bounds), results.back().distance + epsilon);
+            search_bounds = m_traits.construct_sphere_d_object()(search_center, results.back().distance + epsilon);
           }
         }
       }
@@ -1350,34 +1858,43 @@ private: // functions :
       struct Node_index_with_distance {
         Node_index index;
         FT distance;
-
-        Node_index_with_distance(const Node_index& index, FT distance) :
-          index(index), distance(distance) {}
       };
 
       // Recursive case: the node has children
 
-      // Create a list to map children to their distances
-      std::vector<Node_index_with_distance> children_with_distances;
-      children_with_distances.reserve(Self::degree);
+      // The children split the node at its barycenter; along each axis, compute the squared distance
+      // from the search point to the lower and to the upper half of the node (zero if the point is inside)
+      const Point split = barycenter(node);
+      std::array<FT, dimension> split_coordinates, lower_distance, upper_distance;
+      int ci = 0;
+      for (const auto r : cartesian_range(search_center, split)) {
+        const FT c = get<0>(r);
+        split_coordinates[ci] = get<1>(r);
+        FT d_lower = 0, d_upper = 0;
+        if (c < node_min[ci])
+          d_lower = node_min[ci] - c;
+        else if (split_coordinates[ci] < c)
+          d_lower = c - split_coordinates[ci];
+        if (c < split_coordinates[ci])
+          d_upper = split_coordinates[ci] - c;
+        else if (node_max[ci] < c)
+          d_upper = c - node_max[ci];
+        lower_distance[ci] = d_lower * d_lower;
+        upper_distance[ci] = d_upper * d_upper;
+        ++ci;
+      }
 
-      // Fill the list with child nodes
-      for (int i = 0; i < Self::degree; ++i) {
-        auto child_node = child(node, i);
+      // Map children to their distances (the number of children is fixed, no allocation needed)
+      std::array<Node_index_with_distance, Self::degree> children_with_distances;
 
+      // Fill the list with child nodes, along with the squared distance from the search point to their bounding box
+      for (int i = 0; i < Self::degree; ++i) {
         FT squared_distance = 0;
-        Point c = m_traits.construct_center_d_object()(search_bounds);
-        Point b = barycenter(child_node);
-        for (const auto r : cartesian_range(c, b)) {
-          FT d = (get<0>(r) - get<1>(r));
-          squared_distance += d * d;
-        }
+        for (int j = 0; j < dimension; ++j)
+          squared_distance += ((i >> j) & 1) ? upper_distance[j] : lower_distance[j];
 
         // Add a child to the list, with its distance
-        children_with_distances.emplace_back(
-          child_node,
-          squared_distance
-        );
+        children_with_distances[i] = { child(node, i), squared_distance };
       }
 
       // Sort the children by their distance from the search point
@@ -1386,16 +1903,89 @@ private: // functions :
         });
 
       // Loop over the children
-      for (auto child_with_distance : children_with_distances) {
+      for (const auto& child_with_distance : children_with_distances) {
+
+        // Check whether the bounding box of the child intersects with the search bounds;
+        // the children are sorted, so none of the following ones can intersect either
+        if (m_traits.compute_squared_radius_d_object()(search_bounds) < child_with_distance.distance)
+          break;
+
+        // Bounding box of the child
+        const int i = int(local_coordinates(child_with_distance.index).to_ulong());
+        std::array<FT, dimension> child_min, child_max;
+        for (int j = 0; j < dimension; ++j) {
+          child_min[j] = ((i >> j) & 1) ? split_coordinates[j] : node_min[j];
+          child_max[j] = ((i >> j) & 1) ? node_max[j] : split_coordinates[j];
+        }
 
-        // Check whether the bounding box of the child intersects with the search bounds
-        if (CGAL::do_intersect(bbox(child_with_distance.index), search_bounds)) {
+        // Recursively invoke this function
+        nearest_k_neighbors_recursive(search_bounds, child_with_distance.index, child_min, child_max,
+                                      results, k, epsilon);
+      }
+    }
+  }
 
-          // Recursively invoke this function
-          nearest_k_neighbors_recursive(search_bounds, child_with_distance.index, results, k);
-        }
+  // Runs one neighbor search per query and stores the results contiguously:
+  // the elements found for the `i`-th query are `neighbors[offsets[i]]`, ..., `neighbors[offsets[i+1]-1]`.
+  // `query_sphere(q)` gives the initial search sphere of the query `q`.
+  template <typename ConcurrencyTag, typename QueryRange, typename QuerySphere, typename NeighborVector>
+  void batch_neighbor_search(const QueryRange& queries,
+                             std::size_t k,
+                             const QuerySphere& query_sphere,
+                             NeighborVector& neighbors,
+                             std::vector<std::size_t>& offsets) const {
+    const std::size_t nb_queries = static_cast<std::size_t>(std::distance(std::begin(queries), std::end(queries)));
+
+    neighbors.clear();
+    offsets.assign(nb_queries + 1, 0);
+
+    // Searches the queries `first`, ..., `last-1`; `scratch` is reused from one query to the next
+    // so that a thread only allocates while its buffers grow
+    auto search_block = [&](std::size_t first, std::size_t last,
+                            std::vector<Node_element_with_distance>& scratch,
+                            NeighborVector& block_neighbors) {
+      auto query = std::next(std::begin(queries), first);
+      for (std::size_t q = first; q < last; ++q, ++query) {
+        scratch.clear();
+        Sphere search_bounds = query_sphere(*query);
+        nearest_k_neighbors_recursive(search_bounds, root(), scratch, k);
+        offsets[q + 1] = scratch.size();
+        for (const auto& item : scratch)
+          block_neighbors.push_back(item.element);
       }
+    };
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      // Queries are processed by blocks; each block writes in its own buffer,
+      // and the buffers are concatenated in query order once all searches are done
+      const std::size_t block_size = 256;
+      const std::size_t nb_blocks = (nb_queries + block_size - 1) / block_size;
+      std::vector<NeighborVector> block_neighbors(nb_blocks);
+      tbb::enumerable_thread_specific<std::vector<Node_element_with_distance>> scratches;
+
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_blocks),
+                        [&](const tbb::blocked_range<std::size_t>& r) {
+                          std::vector<Node_element_with_distance>& scratch = scratches.local();
+                          for (std::size_t b = r.begin(); b != r.end(); ++b)
+                            search_block(b * block_size, (std::min)(nb_queries, (b + 1) * block_size),
+                                         scratch, block_neighbors[b]);
+                        });
+
+      std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+      neighbors.reserve(offsets.back());
+      for (auto& block : block_neighbors)
+        neighbors.insert(neighbors.end(), block.begin(), block.end());
+      return;
     }
+#endif
+
+    std::vector<Node_element_with_distance> scratch;
+    search_block(0, nb_queries, scratch, neighbors);
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
   }
 
 public:
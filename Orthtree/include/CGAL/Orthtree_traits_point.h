@@ -18,10 +18,77 @@
 #include <CGAL/Orthtree/Cartesian_ranges.h>
 
 #include <CGAL/Orthtree_traits_base.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/task_group.h>
+#endif
+
+#include <algorithm>
+#include <vector>
 
 namespace CGAL {
 
-template <typename Tree, typename PointMap>
+namespace Orthtrees {
+namespace internal {
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+// below this number of elements, ranges are partitioned sequentially
+constexpr std::ptrdiff_t parallel_partition_cutoff = 1 << 16;
+
+// Partitions `[begin, end)` like `std::stable_partition()`, but in parallel using a buffer
+// of the size of the range.
+template <typename RandomAccessIterator, typename Predicate>
+RandomAccessIterator parallel_partition(RandomAccessIterator begin, RandomAccessIterator end,
+                                        const Predicate& predicate) {
+
+  using Value = typename std::iterator_traits<RandomAccessIterator>::value_type;
+
+  const std::size_t size = std::distance(begin, end);
+  const std::size_t block_size = parallel_partition_cutoff / 4;
+  const std::size_t nb_blocks = (size + block_size - 1) / block_size;
+
+  // Evaluate the predicate once per element and count the elements of each block going left
+  std::vector<Value> buffer(begin, end);
+  std::vector<unsigned char> goes_left(size);
+  std::vector<std::size_t> left_offsets(nb_blocks + 1, 0);
+  tbb::parallel_for(std::size_t(0), nb_blocks, [&](std::size_t b) {
+    std::size_t nb_left = 0;
+    for (std::size_t i = b * block_size; i < (std::min)(size, (b + 1) * block_size); ++i) {
+      goes_left[i] = predicate(buffer[i]);
+      nb_left += goes_left[i];
+    }
+    left_offsets[b + 1] = nb_left;
+  });
+
+  for (std::size_t b = 0; b < nb_blocks; ++b)
+    left_offsets[b + 1] += left_offsets[b];
+  const std::size_t nb_left = left_offsets[nb_blocks];
+
+  // Scatter the elements back to the input range
+  tbb::parallel_for(std::size_t(0), nb_blocks, [&](std::size_t b) {
+    std::size_t left = left_offsets[b];
+    std::size_t right = nb_left + b * block_size - left_offsets[b];
+    for (std::size_t i = b * block_size; i < (std::min)(size, (b + 1) * block_size); ++i) {
+      if (goes_left[i])
+        *(begin + left++) = std::move(buffer[i]);
+      else
+        *(begin + right++) = std::move(buffer[i]);
+    }
+  });
+
+  return begin + nb_left;
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+} // namespace internal
+} // namespace Orthtrees
+
+template <typename ConcurrencyTag = Sequential_tag, typename Tree, typename PointMap>
 void reassign_points(
   Tree& tree, PointMap& point_map,
   typename Tree::Node_index n, const typename Tree::Point& center, typename Tree::Node_data points,
@@ -34,23 +101,42 @@ void reassign_points(
     return;
   }
 
-  // Split the point collection around the center point on this dimension
-  auto split_point = std::partition(
-    points.begin(), points.end(),
-    [&](const auto& p) -> bool {
-      return (get(point_map, p)[int(dimension)] < center[int(dimension)]);
-    }
-  );
+  auto is_left = [&](const auto& p) -> bool {
+    return (get(point_map, p)[int(dimension)] < center[int(dimension)]);
+  };
 
-  // Further subdivide the first side of the split
   std::bitset<Tree::dimension> coord_left = coord;
   coord_left[dimension] = false;
-  reassign_points(tree, point_map, n, center, {points.begin(), split_point}, coord_left, dimension + 1);
-
-  // Further subdivide the second side of the split
   std::bitset<Tree::dimension> coord_right = coord;
   coord_right[dimension] = true;
-  reassign_points(tree, point_map, n, center, {split_point, points.end()}, coord_right, dimension + 1);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+    if (std::distance(points.begin(), points.end()) >= Orthtrees::internal::parallel_partition_cutoff) {
+
+      // Split the point collection around the center point on this dimension
+      auto split_point = Orthtrees::internal::parallel_partition(points.begin(), points.end(), is_left);
+
+      // Further subdivide both sides of the split concurrently
+      tbb::task_group g;
+      g.run([&] {
+        reassign_points<ConcurrencyTag>(tree, point_map, n, center, {points.begin(), split_point}, coord_left, dimension + 1);
+      });
+      reassign_points<ConcurrencyTag>(tree, point_map, n, center, {split_point, points.end()}, coord_right, dimension + 1);
+      g.wait();
+      return;
+    }
+  }
+#endif
+
+  // Split the point collection around the center point on this dimension
+  auto split_point = std::partition(points.begin(), points.end(), is_left);
+
+  // Further subdivide the first side of the split
+  reassign_points<ConcurrencyTag>(tree, point_map, n, center, {points.begin(), split_point}, coord_left, dimension + 1);
+
+  // Further subdivide the second side of the split
+  reassign_points<ConcurrencyTag>(tree, point_map, n, center, {split_point, points.end()}, coord_right, dimension + 1);
 }
 
 /*!
@@ -158,10 +244,11 @@ public:
     };
   }
 
+  template <typename ConcurrencyTag = Sequential_tag>
   auto distribute_node_contents_object() const {
     return [&](Node_index n, Tree& tree, const typename Self::Point_d& center) {
       CGAL_precondition(!tree.is_leaf(n));
-      reassign_points(tree, m_point_map, n, center, tree.data(n));
+      reassign_points<ConcurrencyTag>(tree, m_point_map, n, center, tree.data(n));
     };
   }
 
@@ -183,6 +270,12 @@ public:
       };
   }
 
+  auto get_geometric_object_for_element_object() const {
+    return [&](const Node_data_element& index) -> decltype(auto) {
+      return get(m_point_map, index);
+      };
+  }
+
   auto squared_distance_of_element_object() const {
     return [&](const Node_data_element& index, const typename Self::Point_d& point) -> typename Self::FT {
       return CGAL::squared_distance(get(m_point_map, index), point);
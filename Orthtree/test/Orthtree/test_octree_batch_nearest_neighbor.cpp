@@ -0,0 +1,97 @@
+#define CGAL_TRACE_STREAM std::cerr
+
+#include <CGAL/Octree.h>
+#include <CGAL/Point_set_3.h>
+#include <CGAL/point_generators_3.h>
+
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/use.h>
+#include <iostream>
+#include <iterator>
+#include <cassert>
+
+using Kernel = CGAL::Simple_cartesian<double>;
+using Point = Kernel::Point_3;
+using FT = Kernel::FT;
+using Sphere = Kernel::Sphere_3;
+using Point_set = CGAL::Point_set_3<Point>;
+using Octree = CGAL::Octree<Kernel, Point_set, typename Point_set::Point_map>;
+using Index = Point_set::Index;
+
+// Checks that the batched results of each query are the ones of the corresponding single query
+template <typename Single_query>
+void check_against_single_queries(std::size_t nb_queries,
+                                  const std::vector<Index>& neighbors,
+                                  const std::vector<std::size_t>& offsets,
+                                  const Point_set& points,
+                                  const Single_query& single_query) {
+  CGAL_USE(neighbors);
+  CGAL_USE(offsets);
+  CGAL_USE(points);
+  assert(offsets.size() == nb_queries + 1);
+  assert(offsets.front() == 0);
+  assert(offsets.back() == neighbors.size());
+
+  for (std::size_t q = 0; q < nb_queries; ++q) {
+    std::vector<Index> expected;
+    single_query(q, std::back_inserter(expected));
+
+    assert(offsets[q + 1] - offsets[q] == expected.size());
+    for (std::size_t j = 0; j < expected.size(); ++j)
+      assert(points.point(neighbors[offsets[q] + j]) == points.point(expected[j]));
+  }
+}
+
+template <typename ConcurrencyTag>
+void test_batch(std::size_t num_points, std::size_t nb_queries, std::size_t k) {
+
+  Point_set points;
+  CGAL::Random_points_in_cube_3<Point> generator;
+  for (std::size_t i = 0; i < num_points; ++i)
+    points.insert(*generator++);
+
+  Octree octree(points, points.point_map());
+  octree.refine(10, 20);
+
+  std::vector<Point> queries;
+  std::vector<Sphere> spheres;
+  for (std::size_t i = 0; i < nb_queries; ++i) {
+    queries.push_back(*generator++);
+    spheres.emplace_back(queries.back(), FT(0.01));
+  }
+
+  std::vector<Index> neighbors;
+  std::vector<std::size_t> offsets;
+
+  octree.nearest_k_neighbors<ConcurrencyTag>(queries, k, neighbors, offsets);
+  assert(neighbors.size() == nb_queries * (std::min)(k, num_points));
+  check_against_single_queries(nb_queries, neighbors, offsets, points, [&](std::size_t q, auto out) {
+    octree.nearest_k_neighbors(queries[q], k, out);
+  });
+
+  octree.neighbors_within_radius<ConcurrencyTag>(spheres, neighbors, offsets);
+  check_against_single_queries(nb_queries, neighbors, offsets, points, [&](std::size_t q, auto out) {
+    octree.neighbors_within_radius(spheres[q], out);
+  });
+
+  octree.nearest_k_neighbors_within_radius<ConcurrencyTag>(spheres, k, neighbors, offsets);
+  check_against_single_queries(nb_queries, neighbors, offsets, points, [&](std::size_t q, auto out) {
+    octree.nearest_k_neighbors_within_radius(spheres[q], k, out);
+  });
+
+  // An empty batch gives empty results
+  octree.nearest_k_neighbors<ConcurrencyTag>(std::vector<Point>(), k, neighbors, offsets);
+  assert(neighbors.empty() && offsets.size() == 1 && offsets[0] == 0);
+}
+
+int main(void) {
+
+  test_batch<CGAL::Sequential_tag>(10, 50, 16);
+  test_batch<CGAL::Sequential_tag>(10000, 1000, 16);
+  test_batch<CGAL::Parallel_if_available_tag>(10, 50, 16);
+  test_batch<CGAL::Parallel_if_available_tag>(10000, 1000, 16);
+  test_batch<CGAL::Parallel_if_available_tag>(100000, 3000, 1);
+
+  std::cout << "[Orthtree batched nearest neighbor test passed]" << std::endl;
+  return EXIT_SUCCESS;
+}
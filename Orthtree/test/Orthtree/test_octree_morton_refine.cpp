@@ -0,0 +1,95 @@
+#define CGAL_TRACE_STREAM std::cerr
+
+#include <CGAL/Octree.h>
+#include <CGAL/Quadtree.h>
+#include <CGAL/Orthtree/Traversals.h>
+#include <CGAL/Point_set_3.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+
+#include <CGAL/Simple_cartesian.h>
+#include <iostream>
+#include <cassert>
+#include <set>
+#include <vector>
+
+using Kernel = CGAL::Simple_cartesian<double>;
+using Point = Kernel::Point_3;
+using Point_2 = Kernel::Point_2;
+using Point_set = CGAL::Point_set_3<Point>;
+using Octree = CGAL::Octree<Kernel, Point_set, typename Point_set::Point_map>;
+using Quadtree = CGAL::Quadtree<Kernel, std::vector<Point_2> >;
+
+template <typename Tree>
+void assert_same_tree(const Tree& tree, const Tree& other) {
+
+  // Same nodes with the same indices, containing the same elements
+  assert(tree == other);
+  for (auto node : tree.traverse(CGAL::Orthtrees::Preorder_traversal<Tree>(tree))) {
+    assert(tree.global_coordinates(node) == other.global_coordinates(node));
+    std::multiset<typename Tree::Point> elements, other_elements;
+    for (const auto& e : tree.data(node))
+      elements.insert(tree.traits().get_geometric_object_for_element_object()(e));
+    for (const auto& e : other.data(node))
+      other_elements.insert(other.traits().get_geometric_object_for_element_object()(e));
+    assert(elements == other_elements);
+  }
+}
+
+template <typename ConcurrencyTag>
+void test_octree(std::size_t num_points, std::size_t max_depth, std::size_t bucket_size) {
+
+  Point_set points, other_points;
+  CGAL::Random_points_on_sphere_3<Point> generator;
+  for (std::size_t i = 0; i < num_points; ++i) {
+    Point p = *generator++;
+    points.insert(p);
+    other_points.insert(p);
+    // duplicated points cannot be separated
+    if (i % 10 == 0) {
+      points.insert(p);
+      other_points.insert(p);
+    }
+  }
+
+  Octree octree(points, points.point_map());
+  octree.refine(max_depth, bucket_size);
+
+  Octree other(other_points, other_points.point_map());
+  other.template refine_with_morton_codes<ConcurrencyTag>(max_depth, bucket_size);
+
+  assert(octree.depth() == other.depth());
+  assert_same_tree(octree, other);
+}
+
+void test_quadtree(std::size_t num_points, std::size_t max_depth, std::size_t bucket_size) {
+
+  std::vector<Point_2> points;
+  CGAL::Random_points_in_square_2<Point_2> generator;
+  for (std::size_t i = 0; i < num_points; ++i)
+    points.push_back(*generator++);
+  std::vector<Point_2> other_points = points;
+
+  Quadtree quadtree(points);
+  quadtree.refine(max_depth, bucket_size);
+
+  Quadtree other(other_points);
+  other.refine_with_morton_codes(max_depth, bucket_size);
+
+  assert(quadtree.depth() == other.depth());
+  assert_same_tree(quadtree, other);
+}
+
+int main(void) {
+
+  test_octree<CGAL::Sequential_tag>(1, 10, 1);
+  test_octree<CGAL::Sequential_tag>(100, 10, 1);
+  test_octree<CGAL::Sequential_tag>(10000, 10, 20);
+  test_octree<CGAL::Sequential_tag>(10000, 21, 1);
+  test_octree<CGAL::Parallel_if_available_tag>(100000, 8, 20);
+
+  test_quadtree(10000, 10, 5);
+  test_quadtree(10000, 32, 1);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,66 @@
+#define CGAL_TRACE_STREAM std::cerr
+
+#include <CGAL/Octree.h>
+#include <CGAL/Orthtree/Traversals.h>
+#include <CGAL/Point_set_3.h>
+#include <CGAL/point_generators_3.h>
+
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/use.h>
+#include <algorithm>
+#include <iostream>
+#include <cassert>
+#include <vector>
+
+using Kernel = CGAL::Simple_cartesian<double>;
+using Point = Kernel::Point_3;
+using Point_set = CGAL::Point_set_3<Point>;
+using Octree = CGAL::Octree<Kernel, Point_set, typename Point_set::Point_map>;
+
+void test_refine(std::size_t num_points, std::size_t max_depth, std::size_t bucket_size) {
+
+  Point_set points, other_points;
+  CGAL::Random_points_in_cube_3<Point> generator;
+  for (std::size_t i = 0; i < num_points; ++i) {
+    Point p = *generator++;
+    points.insert(p);
+    other_points.insert(p);
+  }
+
+  Octree octree(points, points.point_map());
+  octree.refine(max_depth, bucket_size);
+
+  Octree other(other_points, other_points.point_map());
+  other.refine<CGAL::Parallel_if_available_tag>(max_depth, bucket_size);
+
+  // Both trees must have the same nodes, with the same indices and contents
+  assert(octree == other);
+  for (auto node : octree.traverse(CGAL::Orthtrees::Preorder_traversal<Octree>(octree))) {
+    assert(octree.global_coordinates(node) == other.global_coordinates(node));
+    assert(octree.data(node).size() == other.data(node).size());
+    // the nodes contain the same points, possibly in a different order
+    std::vector<Point_set::Index> node_points(octree.data(node).begin(), octree.data(node).end());
+    std::vector<Point_set::Index> other_node_points(other.data(node).begin(), other.data(node).end());
+    std::sort(node_points.begin(), node_points.end());
+    std::sort(other_node_points.begin(), other_node_points.end());
+    assert(node_points == other_node_points);
+    for (auto p : other.data(node)) {
+      assert(CGAL::do_intersect(other_points.point(p), other.bbox(node)));
+      CGAL_USE(p);
+    }
+  }
+
+  octree.grade();
+  other.grade<CGAL::Parallel_if_available_tag>();
+  assert(Octree::is_topology_equal(octree, other));
+}
+
+int main(void) {
+
+  test_refine(1, 10, 1);
+  test_refine(100, 10, 1);
+  test_refine(10000, 10, 20);
+  test_refine(300000, 8, 20);
+
+  return EXIT_SUCCESS;
+}
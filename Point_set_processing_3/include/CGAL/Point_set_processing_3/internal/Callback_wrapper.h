@@ -13,6 +13,7 @@
 #define CGAL_PSP_INTERNAL_CALLBACK_WRAPPER_H
 
 #include <CGAL/license/Point_set_processing_3.h>
+#include <CGAL/for_each.h>
 #include <atomic>
 #include <thread>
 #include <functional>
@@ -86,7 +87,7 @@ public:
   void join() { }
 };
 
-#ifdef CGAL_LINKED_WITH_TBB
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
 template <>
 class Callback_wrapper<CGAL::Parallel_tag>
 {
@@ -177,7 +178,7 @@ public:
       m_callback (1.);
   }
 };
-#endif
+#endif // CGAL_HAS_PARALLEL_FOR_EACH
 
 } // namespace internal
 } // namespace Point_set_processing_3
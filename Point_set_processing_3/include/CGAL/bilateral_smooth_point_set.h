@@ -178,8 +178,9 @@ compute_max_spacing(
    For more details, please see section 4 in \cgalCite{ear-2013}.
 
    A parallel version of this function is provided and requires the executable to be
-   linked against the <a href="https://github.com/oneapi-src/oneTBB">Intel TBB library</a>.
-   To control the number of threads used, the user may use the tbb::task_scheduler_init class.
+   linked against the <a href="https://github.com/oneapi-src/oneTBB">Intel TBB library</a>,
+   or to be compiled with OpenMP.
+   With TBB, the number of threads used can be controlled with the tbb::global_control class.
    See the <a href="https://software.intel.com/content/www/us/en/develop/documentation/onetbb-documentation/top.html">TBB documentation</a>
    for more details.
 
@@ -32,6 +32,7 @@
 #include <CGAL/spatial_sort.h>
 #include <CGAL/Real_timer.h>
 #include <CGAL/iterator.h>
+#include <CGAL/for_each.h>
 
 #include <CGAL/boost/graph/Face_filtered_graph.h>
 #if defined(CGAL_METIS_ENABLED)
@@ -50,6 +51,7 @@
 #include <array>
 #include <cmath>
 #include <limits>
+#include <mutex>
 
 #ifdef CGAL_HAUSDORFF_DEBUG_PP
  #ifndef CGAL_HAUSDORFF_DEBUG
@@ -91,58 +93,6 @@ triangle_grid_sampling(const typename Kernel::Point_3& p0,
   return out;
 }
 
-#if defined(CGAL_LINKED_WITH_TBB)
-template <class Kernel, class AABB_tree, class PointRange>
-struct Distance_computation
-{
-  typedef typename Kernel::FT FT;
-  typedef typename PointRange::const_iterator::value_type Point_3;
-
-  const AABB_tree& tree;
-  const PointRange& sample_points;
-  Point_3 initial_hint;
-  FT sq_distance;
-
-  //constructor
-  Distance_computation(const AABB_tree& tree,
-                       const Point_3& p,
-                       const PointRange& sample_points)
-    : tree(tree),
-      sample_points(sample_points),
-      initial_hint(p),
-      sq_distance(-1)
-  {}
-
-  //split constructor
-  Distance_computation(Distance_computation& s, tbb::split)
-    : tree(s.tree),
-      sample_points(s.sample_points),
-      initial_hint(s.initial_hint),
-      sq_distance(-1)
-  {}
-
-  void operator()(const tbb::blocked_range<std::size_t>& range)
-  {
-    Point_3 hint = initial_hint;
-    FT sq_hdist = 0;
-    typename Kernel_traits<Point_3>::Kernel::Compute_squared_distance_3 squared_distance;
-
-    for(std::size_t i = range.begin(); i != range.end(); ++i)
-    {
-      hint = tree.closest_point(*(sample_points.begin() + i), hint);
-      FT sq_d = squared_distance(hint,*(sample_points.begin() + i));
-      if(sq_d > sq_hdist)
-        sq_hdist = sq_d;
-    }
-
-    if(sq_hdist > sq_distance)
-      sq_distance = sq_hdist;
-  }
-
-  void join(Distance_computation& rhs) { sq_distance = (std::max)(rhs.sq_distance, sq_distance); }
-};
-#endif
-
 template <class Concurrency_tag,
           class PointRange,
           class AABBTree,
@@ -154,32 +104,39 @@ double max_distance_to_mesh_impl(const PointRange& sample_points,
 {
   using FT = typename Kernel::FT;
 
-#if !defined(CGAL_LINKED_WITH_TBB)
+#if !defined(CGAL_HAS_PARALLEL_FOR_EACH)
   static_assert (!(std::is_convertible<Concurrency_tag, Parallel_tag>::value),
-                             "Parallel_tag is enabled but TBB is unavailable.");
-#else
-  if(std::is_convertible<Concurrency_tag,Parallel_tag>::value)
-  {
-    Distance_computation<Kernel, AABBTree, PointRange> f(tree, hint, sample_points);
-    tbb::parallel_reduce(tbb::blocked_range<std::size_t>(0, sample_points.size()), f);
-    return to_double(approximate_sqrt(f.sq_distance));
-  }
-  else
+                             "Parallel_tag is enabled but no parallel backend (TBB, OpenMP) is available.");
 #endif
-  {
-    FT sq_hdist = 0;
-    typename Kernel::Compute_squared_distance_3 squared_distance = k.compute_squared_distance_3_object();
 
-    for(const typename Kernel::Point_3& pt : sample_points)
-    {
-      hint = tree.closest_point(pt, hint);
-      FT sq_d = squared_distance(hint, pt);
-      if(sq_d > sq_hdist)
-        sq_hdist = sq_d;
-    }
+  // Each subrange of sample points is processed sequentially, so that the closest point
+  // of a sample point is the hint of the next one
+  FT sq_hdist = 0;
+  std::mutex mutex;
+  typename Kernel::Compute_squared_distance_3 squared_distance = k.compute_squared_distance_3_object();
+
+  CGAL::internal::for_each_subrange
+    (sample_points.size(),
+     [&](std::size_t begin, std::size_t end)
+     {
+       typename Kernel::Point_3 local_hint = hint;
+       FT local_sq_hdist = 0;
+       for(std::size_t i = begin; i != end; ++i)
+       {
+         const typename Kernel::Point_3& pt = *(sample_points.begin() + i);
+         local_hint = tree.closest_point(pt, local_hint);
+         FT sq_d = squared_distance(local_hint, pt);
+         if(sq_d > local_sq_hdist)
+           local_sq_hdist = sq_d;
+       }
+
+       std::lock_guard<std::mutex> lock(mutex);
+       if(local_sq_hdist > sq_hdist)
+         sq_hdist = local_sq_hdist;
+     },
+     CGAL::For_each_hints(), Concurrency_tag());
 
-    return to_double(approximate_sqrt(sq_hdist));
-  }
+  return to_double(approximate_sqrt(sq_hdist));
 }
 
 template<typename PointOutputIterator,
@@ -1137,8 +1094,9 @@ double max_distance_to_triangle_mesh(const PointRange& points,
  * `tm1` and `np1` as parameter.
  *
  * A parallel version is provided and requires the executable to be
- * linked against the <a href="https://github.com/oneapi-src/oneTBB">Intel TBB library</a>.
- * To control the number of threads used, the user may use the `tbb::task_scheduler_init` class.
+ * linked against the <a href="https://github.com/oneapi-src/oneTBB">Intel TBB library</a>,
+ * or to be compiled with OpenMP.
+ * With TBB, the number of threads used can be controlled with the `tbb::global_control` class.
  * See the <a href="https://software.intel.com/content/www/us/en/develop/documentation/onetbb-documentation/top.html">TBB documentation</a>
  * for more details.
  *
@@ -21,6 +21,7 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/Weights/cotangent_weights.h>
+#include <CGAL/tags.h>
 
 #if defined(CGAL_EIGEN3_ENABLED)
 #include <CGAL/Eigen_solver_traits.h>  // for sparse linear system solver
@@ -36,7 +37,9 @@ namespace internal {
   // use non-default weight calculator and non-default solver
   // WeightCalculator a model of `FairWeightCalculator`, can be omitted to use default Cotangent weights
   // weight_calculator a function object to calculate weights, defaults to Cotangent weights and can be omitted
-  template<typename SparseLinearSolver,
+  // ConcurrencyTag enables the parallel construction of the rows of the linear system
+  template<typename ConcurrencyTag = Sequential_tag,
+           typename SparseLinearSolver,
            typename WeightCalculator,
            typename TriangleMesh,
            typename VertexRange,
@@ -51,7 +54,7 @@ bool fair(TriangleMesh& tmesh,
   CGAL::Polygon_mesh_processing::internal::Fair_Polyhedron_3
      <TriangleMesh, SparseLinearSolver, WeightCalculator, VertexPointMap>
      fair_functor(tmesh, vpmap, weight_calculator);
-  return fair_functor.fair(vertices, solver, continuity);
+  return fair_functor.template fair<ConcurrencyTag>(vertices, solver, continuity);
 }
 
 } //end namespace internal
@@ -113,6 +116,19 @@ bool fair(TriangleMesh& tmesh,
                         `CGAL_EIGEN3_ENABLED` is defined, then the following overload of `Eigen_solver_traits`
                         is provided as default value:\n
                         `CGAL::Eigen_solver_traits<Eigen::SparseLU<CGAL::Eigen_sparse_matrix<double>::%EigenType, Eigen::COLAMDOrdering<int> > >`}
+      \cgalParamExtra{Copies of an `Eigen_solver_traits` share their solver: when the same solver is passed
+                      to several calls fairing the same region, the symbolic factorization is computed only once.
+                      For large regions, an iterative solver such as
+                      `CGAL::Eigen_solver_traits<Eigen::BiCGSTAB<CGAL::Eigen_sparse_matrix<double>::%EigenType, Eigen::IncompleteLUT<double> > >`
+                      avoids the memory cost of a direct factorization.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the rows of the linear system should be computed using one or several threads.}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{With `CGAL::Parallel_tag`, the vertex point map is read concurrently.
+                      The matrix is filled and the linear system is solved by the calling thread only.}
     \cgalParamNEnd
   \cgalNamedParamsEnd
 
@@ -172,7 +188,11 @@ bool fair(TriangleMesh& tmesh,
     // the issue #4706 - https://github.com/CGAL/cgal/issues/4706.
     typedef CGAL::Weights::Secure_cotangent_weight_with_voronoi_area<TriangleMesh, VPMap, GT> Default_weight_calculator;
 
-    return internal::fair(tmesh, vertices,
+    typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                         NamedParameters,
+                                                         Sequential_tag>::type Concurrency_tag;
+
+    return internal::fair<Concurrency_tag>(tmesh, vertices,
       choose_parameter<Default_solver>(get_parameter(np, internal_np::sparse_linear_solver)),
       choose_parameter(get_parameter(np, internal_np::weight_calculator), Default_weight_calculator(tmesh, vpmap, gt)),
       choose_parameter(get_parameter(np, internal_np::fairing_continuity), 1),
@@ -21,6 +21,9 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/Weights/cotangent_weights.h>
 #include <CGAL/Dynamic_property_map.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 #include <CGAL/utility.h>
 
 #if defined(CGAL_EIGEN3_ENABLED)
@@ -44,7 +47,8 @@ template<typename TriangleMesh,
          typename VertexPointMap,
          typename VertexConstraintMap,
          typename SparseLinearSolver,
-         typename GeomTraits>
+         typename GeomTraits,
+         typename ConcurrencyTag = Sequential_tag>
 class Shape_smoother
 {
   typedef typename GeomTraits::FT                                                 FT;
@@ -87,9 +91,9 @@ public:
   {
     set_face_range(face_range);
 
-    std::size_t id = 0;
-    for(vertex_descriptor v : vertices(mesh_))
-      put(vimap_, v, id++);
+    all_vertices_.assign(vertices(mesh_).begin(), vertices(mesh_).end());
+    for(std::size_t id = 0; id < all_vertices_.size(); ++id)
+      put(vimap_, all_vertices_[id], id);
 
     // vertices that are not in the range or are constrained still need value '1' in D because the RHS is D * X^n
     diagonal_.assign(vertices(mesh_).size(), 1.);
@@ -156,7 +160,7 @@ public:
     CGAL_assertion(stiffness_elements.empty());
     stiffness_elements.reserve(8 * vrange_.size());
 
-    std::unordered_map<std::size_t, double> diag_coeff;
+    std::vector<halfedge_descriptor> hedges;
     for(face_descriptor f : frange_)
     {
       for(halfedge_descriptor hi : halfedges_around_face(halfedge(f, mesh_), mesh_))
@@ -169,33 +173,47 @@ public:
         if(!is_border(hi_opp, mesh_) && hi < hi_opp)
           continue;
 
-        const vertex_descriptor v_source = source(hi, mesh_);
-        const vertex_descriptor v_target = target(hi, mesh_);
+        if(is_constrained(source(hi, mesh_)) && is_constrained(target(hi, mesh_)))
+          continue;
 
-        const bool is_source_constrained = is_constrained(v_source);
-        const bool is_target_constrained = is_constrained(v_target);
+        hedges.push_back(hi);
+      }
+    }
 
-        if(is_source_constrained && is_target_constrained)
-          continue;
+    // Cotangent_weight returns (cot(beta) + cot(gamma)) / 2
+    std::vector<FT> weights(hedges.size());
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, hedges.size()),
+      [&](const std::size_t i) -> bool
+    {
+      weights[i] = FT(2) * weight_calculator_(hedges[i]);
+      return true;
+    });
+
+    std::unordered_map<std::size_t, double> diag_coeff;
+    for(std::size_t hi = 0; hi < hedges.size(); ++hi)
+    {
+      const vertex_descriptor v_source = source(hedges[hi], mesh_);
+      const vertex_descriptor v_target = target(hedges[hi], mesh_);
 
-        // Cotangent_weight returns (cot(beta) + cot(gamma)) / 2
-        const FT Lij = FT(2) * weight_calculator_(hi);
+      const bool is_source_constrained = is_constrained(v_source);
+      const bool is_target_constrained = is_constrained(v_target);
 
-        const std::size_t i_source = get(vimap_, v_source);
-        const std::size_t i_target = get(vimap_, v_target);
+      const FT Lij = weights[hi];
 
-        // note that these constraints create asymmetry in the matrix
-        if(!is_source_constrained)
-        {
-          stiffness_elements.emplace_back(i_source, i_target, Lij);
-          diag_coeff.emplace(i_source, 0).first->second -= Lij;
-        }
+      const std::size_t i_source = get(vimap_, v_source);
+      const std::size_t i_target = get(vimap_, v_target);
 
-        if(!is_target_constrained)
-        {
-          stiffness_elements.emplace_back(i_target, i_source, Lij);
-          diag_coeff.emplace(i_target, 0).first->second -= Lij;
-        }
+      // note that these constraints create asymmetry in the matrix
+      if(!is_source_constrained)
+      {
+        stiffness_elements.emplace_back(i_source, i_target, Lij);
+        diag_coeff.emplace(i_source, 0).first->second -= Lij;
+      }
+
+      if(!is_target_constrained)
+      {
+        stiffness_elements.emplace_back(i_target, i_source, Lij);
+        diag_coeff.emplace(i_target, 0).first->second -= Lij;
       }
     }
 
@@ -267,7 +285,7 @@ public:
   }
 
 private:
-  bool is_constrained(const vertex_descriptor& v)
+  bool is_constrained(const vertex_descriptor& v) const
   {
     return get(vcmap_, v);
   }
@@ -326,31 +344,40 @@ private:
         diagonal_[index] = 0.;
     }
 
-    for(face_descriptor f : frange_)
+    // the areas are computed independently, and then accumulated by the calling thread
+    face_areas_.resize(frange_.size());
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, frange_.size()),
+      [&](const std::size_t i) -> bool
     {
-      const double area = face_area(f, mesh_, parameters::vertex_point_map(vpmap_).geom_traits(traits_));
+      face_areas_[i] = face_area(frange_[i], mesh_, parameters::vertex_point_map(vpmap_).geom_traits(traits_));
+      return true;
+    });
 
-      for(vertex_descriptor v : vertices_around_face(halfedge(f, mesh_), mesh_))
+    for(std::size_t i = 0; i < frange_.size(); ++i)
+    {
+      for(vertex_descriptor v : vertices_around_face(halfedge(frange_[i], mesh_), mesh_))
       {
         if(!is_constrained(v))
-          diagonal_[get(vimap_, v)] += area / 6.;
+          diagonal_[get(vimap_, v)] += face_areas_[i] / 6.;
       }
     }
   }
 
   void compute_rhs(Eigen_vector& bx, Eigen_vector& by, Eigen_vector& bz)
   {
-    for(vertex_descriptor vi : vertices(mesh_))
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, all_vertices_.size()),
+      [&](const std::size_t index) -> bool
     {
-      std::size_t index = get(vimap_, vi);
-      Point_ref p = get(vpmap_, vi);
+      Point_ref p = get(vpmap_, all_vertices_[index]);
       bx.set(index, diagonal_[index] * p.x());
       by.set(index, diagonal_[index] * p.y());
       bz.set(index, diagonal_[index] * p.z());
-    }
+      return true;
+    });
   }
 
 private:
+  std::vector<vertex_descriptor> all_vertices_; // index of vector -> index of vimap_
   std::vector<vertex_descriptor> vrange_;
   std::vector<face_descriptor> frange_;
   TriangleMesh& mesh_;
@@ -369,6 +396,7 @@ private:
   // linear system data
   std::vector<double> diagonal_; // index of vector -> index of vimap_
   std::vector<bool> constrained_flags_;
+  std::vector<double> face_areas_; // index of vector -> index of frange_
 
   GeomTraits traits_;
   const CGAL::Weights::Cotangent_weight<TriangleMesh, VertexPointMap, GeomTraits> weight_calculator_;
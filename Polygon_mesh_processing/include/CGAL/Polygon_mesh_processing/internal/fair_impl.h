@@ -19,11 +19,17 @@
 #include <map>
 #include <set>
 #include <CGAL/assertions.h>
+#include <CGAL/tags.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
 #include <CGAL/boost/graph/helpers.h>
 #ifdef CGAL_PMP_FAIR_DEBUG
 #include <CGAL/Timer.h>
 #endif
 #include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace CGAL {
 
@@ -72,10 +78,11 @@ private:
 
   // recursively computes a row (use depth parameter to compute L, L^2, L^3)
   // Equation 6 in [On Linear Variational Surface Deformation Methods]
+  // The coefficients of the free vertices are passed to `add_coef(col_id, value)`.
+  template <class AddCoef>
   void compute_row(
     vertex_descriptor v,
-    int row_id,                            // which row to insert in [ frees stay left-hand side ]
-    Solver_matrix& matrix,
+    const AddCoef& add_coef,               // [ frees stay left-hand side ]
     double& x, double& y, double& z,               // constants transferred to right-hand side
     double multiplier,
     const std::map<vertex_descriptor, std::size_t>& vertex_id_map,
@@ -85,7 +92,7 @@ private:
       typename std::map<vertex_descriptor, std::size_t>::const_iterator vertex_id_it = vertex_id_map.find(v);
       if(vertex_id_it != vertex_id_map.end()) {
         int col_id = static_cast<int>(vertex_id_it->second);
-        matrix.add_coef(row_id, col_id, multiplier);
+        add_coef(col_id, multiplier);
       }
       else {
         typename boost::property_traits<VertexPointMap>::reference p = get(ppmap, v);
@@ -102,16 +109,63 @@ private:
         double w_i_w_ij = w_i * CGAL::to_double(weight_calculator.w_ij(*circ)) ;
 
         vertex_descriptor nv = target(opposite(*circ,pmesh),pmesh);
-        compute_row(nv, row_id, matrix, x, y, z, -w_i_w_ij*multiplier, vertex_id_map, depth-1);
+        compute_row(nv, add_coef, x, y, z, -w_i_w_ij*multiplier, vertex_id_map, depth-1);
       } while(++circ != done);
 
       double w_i_w_ij_sum = w_i * sum_weight(v);
-      compute_row(v, row_id, matrix, x, y, z, w_i_w_ij_sum*multiplier, vertex_id_map, depth-1);
+      compute_row(v, add_coef, x, y, z, w_i_w_ij_sum*multiplier, vertex_id_map, depth-1);
+    }
+  }
+
+  // fills the rows of `A` and the right-hand sides, computing the rows concurrently
+  // if `ConcurrencyTag` is `Parallel_tag`
+  template<class ConcurrencyTag>
+  void compute_rows(const std::vector<vertex_descriptor>& interior_vertices,
+                    const std::map<vertex_descriptor, std::size_t>& vertex_id_map,
+                    unsigned int depth,
+                    Solver_matrix& A,
+                    Solver_vector& Bx, Solver_vector& By, Solver_vector& Bz)
+  {
+    if constexpr(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      // the rows are computed independently in local buffers, the matrix
+      // being filled afterwards by the calling thread only
+      const std::size_t nb_vertices = interior_vertices.size();
+      std::vector<std::vector<std::pair<int, double> > > rows(nb_vertices);
+      std::vector<double> bx(nb_vertices, 0.), by(nb_vertices, 0.), bz(nb_vertices, 0.);
+
+      CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, nb_vertices),
+                                     [&](std::size_t v_id) -> bool
+                                     {
+                                       std::vector<std::pair<int, double> >& row = rows[v_id];
+                                       compute_row(interior_vertices[v_id],
+                                                   [&row](int col_id, double value) { row.emplace_back(col_id, value); },
+                                                   bx[v_id], by[v_id], bz[v_id], 1, vertex_id_map, depth);
+                                       return true;
+                                     });
+
+      for(std::size_t v_id = 0; v_id < nb_vertices; ++v_id)
+      {
+        for(const std::pair<int, double>& coef : rows[v_id])
+          A.add_coef(static_cast<int>(v_id), coef.first, coef.second);
+        Bx[v_id] = bx[v_id];
+        By[v_id] = by[v_id];
+        Bz[v_id] = bz[v_id];
+      }
+      return;
+    }
+
+    for(std::size_t v_id = 0; v_id < interior_vertices.size(); ++v_id)
+    {
+      const int row_id = static_cast<int>(v_id);
+      compute_row(interior_vertices[v_id],
+                  [&A, row_id](int col_id, double value) { A.add_coef(row_id, col_id, value); },
+                  Bx[v_id], By[v_id], Bz[v_id], 1, vertex_id_map, depth);
     }
   }
 
 public:
-  template<class VertexRange>
+  template<class ConcurrencyTag = Sequential_tag, class VertexRange>
   bool fair(const VertexRange& vertices
     , SparseLinearSolver solver
     , unsigned int fc)
@@ -147,11 +201,8 @@ public:
 
     Solver_matrix A(nb_vertices);
 
-    for(vertex_descriptor vd : interior_vertices)
-    {
-      int v_id = static_cast<int>(vertex_id_map[vd]);
-      compute_row(vd, v_id, A, Bx[v_id], By[v_id], Bz[v_id], 1, vertex_id_map, depth);
-    }
+    compute_rows<ConcurrencyTag>(std::vector<vertex_descriptor>(interior_vertices.begin(), interior_vertices.end()),
+                                 vertex_id_map, depth, A, Bx, By, Bz);
     #ifdef CGAL_PMP_FAIR_DEBUG
     std::cerr << "**Timer** System construction: " << timer.time() << std::endl; timer.reset();
     #endif
@@ -17,16 +17,21 @@
 #include <CGAL/license/Polygon_mesh_processing/interpolated_corrected_curvatures.h>
 
 #include <CGAL/assertions.h>
+#include <CGAL/for_each.h>
 #include <CGAL/Polygon_mesh_processing/compute_normal.h>
 #include <CGAL/Polygon_mesh_processing/measure.h>
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/property_map.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/tags.h>
 #include <Eigen/Eigenvalues>
 
+#include <algorithm>
 #include <numeric>
 #include <queue>
+#include <type_traits>
 #include <unordered_set>
+#include <vector>
 
 namespace CGAL {
 
@@ -737,15 +742,32 @@ class Interpolated_corrected_curvatures_computer
     NamedParameters,
     Default_principal_map>::type Vertex_principal_curvatures_and_directions_map;
 
-  typedef typename boost::property_map<PolygonMesh,
-    CGAL::dynamic_face_property_t<FT>>::const_type Face_scalar_measure_map;
-  typedef typename boost::property_map<PolygonMesh,
-    CGAL::dynamic_face_property_t<std::array<FT, 3 * 3>>>::const_type Face_anisotropic_measure_map;
+  typedef typename GetInitializedFaceIndexMap<PolygonMesh, NamedParameters>::const_type Face_index_map;
+
+  typedef typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+    NamedParameters,
+    Sequential_tag>::type Concurrency_tag;
+
+  // the BFS data of one thread: faces are marked as visited with the stamp of the current vertex,
+  // so that the marks do not need to be cleared between vertices
+  struct Ball_workspace {
+    std::vector<face_descriptor> bfs_queue;
+    std::vector<std::size_t> bfs_visited;
+    std::vector<Vector_3> x;
+  };
+
+  // the curvatures of one vertex
+  struct Vertex_curvatures {
+    FT mean_curvature = 0;
+    FT gaussian_curvature = 0;
+    Principal_curvatures_and_directions<GT> principal_curvatures_and_directions;
+  };
 
 private:
   const PolygonMesh& pmesh;
   Vertex_position_map vpm;
   Vertex_normal_map vnm;
+  Face_index_map fim;
   FT ball_radius;
   FT avg_edge_length;
 
@@ -757,15 +779,9 @@ private:
   Vertex_Gaussian_curvature_map gaussian_curvature_map;
   Vertex_principal_curvatures_and_directions_map principal_curvatures_and_directions_map;
 
-  Face_scalar_measure_map mu0_map, mu1_map, mu2_map;
-  Face_anisotropic_measure_map muXY_map;
-
-  void set_property_maps() {
-    mu0_map = get(CGAL::dynamic_face_property_t<FT>(), pmesh);
-    mu1_map = get(CGAL::dynamic_face_property_t<FT>(), pmesh);
-    mu2_map = get(CGAL::dynamic_face_property_t<FT>(), pmesh);
-    muXY_map = get(CGAL::dynamic_face_property_t<std::array<FT, 3 * 3>>(), pmesh);
-  }
+  // face measures, indexed by `fim`
+  std::vector<FT> mu0, mu1, mu2;
+  std::vector<std::array<FT, 3 * 3>> muXY;
 
   void set_named_params(const NamedParameters& np)
   {
@@ -783,6 +799,8 @@ private:
     if (is_default_parameter<NamedParameters, internal_np::vertex_normal_map_t>::value)
       compute_vertex_normals(pmesh, vnm, np);
 
+    fim = get_initialized_face_index_map(pmesh, np);
+
     // if no radius is given, we pass -1 which will make the expansion be only on the incident faces instead of a ball
     const FT radius = choose_parameter(get_parameter(np, internal_np::ball_radius), -1);
     avg_edge_length = average_edge_length<PolygonMesh>(pmesh);
@@ -814,51 +832,95 @@ public:
     set_named_params(np);
 
     if (is_mean_curvature_selected || is_Gaussian_curvature_selected || is_principal_curvatures_and_directions_selected)
-    {
-      set_property_maps();
-
       compute_selected_curvatures();
-    }
   }
 
 private:
 
+  // calls `f(i, workspace)` for each `i` in `[0, n)`, concurrently if `Concurrency_tag` is `Parallel_tag`.
+  // `f` must only write data that is specific to `i`, or to its workspace.
+  // As a workspace may be as large as the mesh, the indices are split into a few large blocks,
+  // each with its own workspace.
+  template <class Functor>
+  void for_each_index(const std::size_t n, const Functor& f) const
+  {
+    const std::size_t nb_blocks = std::is_same_v<Concurrency_tag, Parallel_tag> ? (std::min)(n, std::size_t(64))
+                                                                                : std::size_t(1);
+    CGAL::for_each<Concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, nb_blocks),
+                                    [&](const std::size_t b) -> bool
+                                    {
+                                      Ball_workspace workspace;
+                                      for (std::size_t i = b * n / nb_blocks; i < (b + 1) * n / nb_blocks; ++i)
+                                        f(i, workspace);
+                                      return true;
+                                    });
+  }
+
   // Computes the (selected) interpolated corrected measures for all faces
-  // and stores them in the property maps
+  // and stores them in the face measure vectors
   void interpolated_corrected_selected_measures_all_faces()
   {
-    std::vector<Vector_3> x;
-    std::vector<Vector_3> u;
-    // minimal number of vertices per face is 3
-    x.reserve(3);
-    u.reserve(3);
+    const std::vector<face_descriptor> fs(faces(pmesh).begin(), faces(pmesh).end());
 
-    for (face_descriptor f : faces(pmesh))
+    mu0.assign(fs.size(), FT(0));
+    if (is_mean_curvature_selected)
+      mu1.assign(fs.size(), FT(0));
+    if (is_Gaussian_curvature_selected)
+      mu2.assign(fs.size(), FT(0));
+    if (is_principal_curvatures_and_directions_selected)
+      muXY.assign(fs.size(), std::array<FT, 3 * 3>());
+
+    for_each_index(fs.size(), [&](const std::size_t i, Ball_workspace& workspace)
     {
+      const face_descriptor f = fs[i];
+      const std::size_t fi = get(fim, f);
+
+      // minimal number of vertices per face is 3
+      std::vector<Vector_3>& x = workspace.x;
+      std::vector<Vector_3> u;
+      u.reserve(3);
+      x.clear();
       for (vertex_descriptor v : vertices_around_face(halfedge(f, pmesh), pmesh))
       {
         const Point_3& p = get(vpm, v);
         x.push_back(Vector_3(p.x(), p.y(), p.z()));
         u.push_back(get(vnm, v));
       }
-      put(mu0_map, f, interpolated_corrected_area_measure_face<GT>(u, x));
+      mu0[fi] = interpolated_corrected_area_measure_face<GT>(u, x);
 
       if (is_mean_curvature_selected)
-        put(mu1_map, f, interpolated_corrected_mean_curvature_measure_face<GT>(u, x));
+        mu1[fi] = interpolated_corrected_mean_curvature_measure_face<GT>(u, x);
 
       if (is_Gaussian_curvature_selected)
-        put(mu2_map, f, interpolated_corrected_Gaussian_curvature_measure_face<GT>(u));
+        mu2[fi] = interpolated_corrected_Gaussian_curvature_measure_face<GT>(u);
 
       if (is_principal_curvatures_and_directions_selected)
-        put(muXY_map, f, interpolated_corrected_anisotropic_measure_face<GT>(u, x));
+        muXY[fi] = interpolated_corrected_anisotropic_measure_face<GT>(u, x);
+    });
+  }
 
-      x.clear();
-      u.clear();
+  // adds the measures of the face of index `fi`, weighted by `ratio`
+  void add_face_measures(const std::size_t fi, const FT ratio, Vertex_measures<GT>& vertex_measures) const
+  {
+    // only add the measures for the selected curvatures (area measure is always added)
+    vertex_measures.area_measure += ratio * mu0[fi];
+
+    if (is_mean_curvature_selected)
+      vertex_measures.mean_curvature_measure += ratio * mu1[fi];
+
+    if (is_Gaussian_curvature_selected)
+      vertex_measures.gaussian_curvature_measure += ratio * mu2[fi];
+
+    if (is_principal_curvatures_and_directions_selected)
+    {
+      const std::array<FT, 3 * 3>& face_anisotropic_measure = muXY[fi];
+      for (std::size_t i = 0; i < 3 * 3; i++)
+        vertex_measures.anisotropic_measure[i] += ratio * face_anisotropic_measure[i];
     }
   }
 
   // expand the measures of the faces incident to v
-  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex_no_radius(vertex_descriptor v)
+  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex_no_radius(vertex_descriptor v) const
   {
     Vertex_measures<GT> vertex_measures;
 
@@ -867,35 +929,28 @@ private:
       if (f == boost::graph_traits<PolygonMesh>::null_face())
         continue;
 
-      // only add the measures for the selected curvatures (area measure is always added)
-      vertex_measures.area_measure += get(mu0_map, f);
-
-      if (is_mean_curvature_selected)
-        vertex_measures.mean_curvature_measure += get(mu1_map, f);
-
-      if (is_Gaussian_curvature_selected)
-        vertex_measures.gaussian_curvature_measure += get(mu2_map, f);
-
-      if (is_principal_curvatures_and_directions_selected)
-      {
-        const std::array<FT, 3 * 3> face_anisotropic_measure = get(muXY_map, f);
-        for (std::size_t i = 0; i < 3 * 3; i++)
-          vertex_measures.anisotropic_measure[i] += face_anisotropic_measure[i];
-      }
+      add_face_measures(get(fim, f), FT(1), vertex_measures);
     }
 
     return vertex_measures;
   }
 
-  // expand the measures of the faces inside the ball of radius r around v
-  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex(vertex_descriptor v)
+  // expand the measures of the faces inside the ball of radius r around v,
+  // `stamp` is a non-zero value specific to v
+  Vertex_measures<GT> expand_interpolated_corrected_measure_vertex(vertex_descriptor v,
+                                                                   const std::size_t stamp,
+                                                                   Ball_workspace& workspace) const
   {
     // the ball expansion is done using a BFS traversal from the vertex
-    std::queue<face_descriptor> bfs_queue;
-    std::unordered_set<face_descriptor> bfs_visited;
+    std::vector<face_descriptor>& bfs_queue = workspace.bfs_queue;
+    std::vector<std::size_t>& bfs_visited = workspace.bfs_visited;
+    std::vector<Vector_3>& x = workspace.x;
+    bfs_queue.clear();
+    if (bfs_visited.empty())
+      bfs_visited.assign(num_faces(pmesh), 0);
 
     const Point_3& vp = get(vpm, v);
-    const Vector_3& c = Vector_3(vp.x(), vp.y(), vp.z());
+    const Vector_3 c(vp.x(), vp.y(), vp.z());
 
     Vertex_measures<GT> vertex_measures;
 
@@ -903,17 +958,16 @@ private:
     for (face_descriptor f : faces_around_target(halfedge(v, pmesh), pmesh)) {
       if (f != boost::graph_traits<PolygonMesh>::null_face())
       {
-        bfs_queue.push(f);
-        bfs_visited.insert(f);
+        bfs_queue.push_back(f);
+        bfs_visited[get(fim, f)] = stamp;
       }
     }
-    while (!bfs_queue.empty()) {
-      face_descriptor fi = bfs_queue.front();
-      bfs_queue.pop();
+    for (std::size_t qi = 0; qi < bfs_queue.size(); ++qi) {
+      const face_descriptor f = bfs_queue[qi];
 
       // looping over vertices in face to get point coordinates
-      std::vector<Vector_3> x;
-      for (vertex_descriptor vi : vertices_around_face(halfedge(fi, pmesh), pmesh))
+      x.clear();
+      for (vertex_descriptor vi : vertices_around_face(halfedge(f, pmesh), pmesh))
       {
         const Point_3& pi = get(vpm, vi);
         x.push_back(Vector_3(pi.x(), pi.y(), pi.z()));
@@ -923,30 +977,16 @@ private:
       const FT f_ratio = face_in_ball_ratio<GT>(x, ball_radius, c);
 
       // if the face is inside the ball, add the measures
-      // only add the measures for the selected curvatures (area measure is always added)
       if (!is_zero(f_ratio))
       {
-        vertex_measures.area_measure += f_ratio * get(mu0_map, fi);
-
-        if (is_mean_curvature_selected)
-          vertex_measures.mean_curvature_measure += f_ratio * get(mu1_map, fi);
-
-        if (is_Gaussian_curvature_selected)
-          vertex_measures.gaussian_curvature_measure += f_ratio * get(mu2_map, fi);
-
-        if (is_principal_curvatures_and_directions_selected)
-        {
-          const std::array<FT, 3 * 3> face_anisotropic_measure = get(muXY_map, fi);
-          for (std::size_t i = 0; i < 3 * 3; i++)
-            vertex_measures.anisotropic_measure[i] += f_ratio * face_anisotropic_measure[i];
-        }
+        add_face_measures(get(fim, f), f_ratio, vertex_measures);
 
-        for (face_descriptor fj : faces_around_face(halfedge(fi, pmesh), pmesh))
+        for (face_descriptor fj : faces_around_face(halfedge(f, pmesh), pmesh))
         {
-          if (bfs_visited.find(fj) == bfs_visited.end() && fj != boost::graph_traits<PolygonMesh>::null_face())
+          if (fj != boost::graph_traits<PolygonMesh>::null_face() && bfs_visited[get(fim, fj)] != stamp)
           {
-            bfs_queue.push(fj);
-            bfs_visited.insert(fj);
+            bfs_queue.push_back(fj);
+            bfs_visited[get(fim, fj)] = stamp;
           }
         }
       }
@@ -954,41 +994,72 @@ private:
     return vertex_measures;
   }
 
+  // computes the selected curvatures of v from the expanded measures
+  // if the area measure is zero, the curvature is set to zero
+  Vertex_curvatures curvatures_from_measures(vertex_descriptor v, const Vertex_measures<GT>& vertex_measures) const
+  {
+    Vertex_curvatures curvatures;
+
+    if (is_mean_curvature_selected && !is_zero(vertex_measures.area_measure))
+      curvatures.mean_curvature = 0.5 * vertex_measures.mean_curvature_measure / vertex_measures.area_measure;
+
+    if (is_Gaussian_curvature_selected && !is_zero(vertex_measures.area_measure))
+      curvatures.gaussian_curvature = vertex_measures.gaussian_curvature_measure / vertex_measures.area_measure;
+
+    if (is_principal_curvatures_and_directions_selected) {
+      // compute the principal curvatures and directions from the anisotropic measure
+      const Vector_3& v_normal = get(vnm, v);
+      curvatures.principal_curvatures_and_directions = principal_curvatures_and_directions_from_anisotropic_measures<GT>(
+        vertex_measures.anisotropic_measure,
+        vertex_measures.area_measure,
+        v_normal,
+        avg_edge_length
+        );
+    }
+
+    return curvatures;
+  }
+
+  void put_curvatures(vertex_descriptor v, const Vertex_curvatures& curvatures)
+  {
+    if (is_mean_curvature_selected)
+      put(mean_curvature_map, v, curvatures.mean_curvature);
+
+    if (is_Gaussian_curvature_selected)
+      put(gaussian_curvature_map, v, curvatures.gaussian_curvature);
+
+    if (is_principal_curvatures_and_directions_selected)
+      put(principal_curvatures_and_directions_map, v, curvatures.principal_curvatures_and_directions);
+  }
+
   void compute_selected_curvatures() {
     interpolated_corrected_selected_measures_all_faces();
 
-    for (vertex_descriptor v : vertices(pmesh))
-    {
-      // expand the computed measures (on faces) to the vertices
-      Vertex_measures<GT> vertex_measures = (is_negative(ball_radius)) ?
-        expand_interpolated_corrected_measure_vertex_no_radius(v) :
-        expand_interpolated_corrected_measure_vertex(v);
-
-      // compute the selected curvatures from the expanded measures and store them in the property maps
-      // if the area measure is zero, the curvature is set to zero
-      if (is_mean_curvature_selected) {
-        !is_zero(vertex_measures.area_measure) ?
-          put(mean_curvature_map, v, 0.5 * vertex_measures.mean_curvature_measure / vertex_measures.area_measure) :
-          put(mean_curvature_map, v, 0);
-      }
+    const std::vector<vertex_descriptor> vs(vertices(pmesh).begin(), vertices(pmesh).end());
 
-      if (is_Gaussian_curvature_selected) {
-        !is_zero(vertex_measures.area_measure) ?
-          put(gaussian_curvature_map, v, vertex_measures.gaussian_curvature_measure / vertex_measures.area_measure) :
-          put(gaussian_curvature_map, v, 0);
-      }
+    // expand the computed measures (on faces) to the vertices
+    const auto vertex_curvatures = [&](const std::size_t i, Ball_workspace& workspace) {
+      const Vertex_measures<GT> vertex_measures = (is_negative(ball_radius)) ?
+        expand_interpolated_corrected_measure_vertex_no_radius(vs[i]) :
+        expand_interpolated_corrected_measure_vertex(vs[i], i + 1, workspace);
+      return curvatures_from_measures(vs[i], vertex_measures);
+    };
 
-      if (is_principal_curvatures_and_directions_selected) {
-        // compute the principal curvatures and directions from the anisotropic measure
-        const Vector_3& v_normal = get(vnm, v);
-        const Principal_curvatures_and_directions<GT> principal_curvatures_and_directions = principal_curvatures_and_directions_from_anisotropic_measures<GT>(
-          vertex_measures.anisotropic_measure,
-          vertex_measures.area_measure,
-          v_normal,
-          avg_edge_length
-          );
-        put(principal_curvatures_and_directions_map, v, principal_curvatures_and_directions);
-      }
+    if constexpr (std::is_same_v<Concurrency_tag, Parallel_tag>)
+    {
+      // the output property maps are filled sequentially, as they might not support concurrent writes
+      std::vector<Vertex_curvatures> curvatures(vs.size());
+      for_each_index(vs.size(), [&](const std::size_t i, Ball_workspace& workspace) {
+        curvatures[i] = vertex_curvatures(i, workspace);
+      });
+      for (std::size_t i = 0; i < vs.size(); ++i)
+        put_curvatures(vs[i], curvatures[i]);
+    }
+    else
+    {
+      for_each_index(vs.size(), [&](const std::size_t i, Ball_workspace& workspace) {
+        put_curvatures(vs[i], vertex_curvatures(i, workspace));
+      });
     }
   }
 };
@@ -1075,6 +1146,22 @@ private:
 *     \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
 *   \cgalParamNEnd
 *
+*   \cgalParamNBegin{face_index_map}
+*     \cgalParamDescription{a property map associating to each face of `pmesh` a unique index between `0` and `num_faces(pmesh) - 1`}
+*     \cgalParamType{a class model of `ReadablePropertyMap` with `boost::graph_traits<PolygonMesh>::%face_descriptor`
+*                    as key type and `std::size_t` as value type}
+*     \cgalParamDefault{an automatically indexed internal map}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the face measures and the vertex curvatures should be computed
+*                           using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{The vertex point and normal maps are read concurrently. The curvature maps are written
+*                     by the calling thread only.}
+*   \cgalParamNEnd
+*
 * \cgalNamedParamsEnd
 *
 */
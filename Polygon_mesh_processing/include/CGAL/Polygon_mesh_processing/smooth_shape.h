@@ -103,6 +103,18 @@ namespace Polygon_mesh_processing {
 *                       `CGAL_EIGEN3_ENABLED` is defined, then the following overload of `Eigen_solver_traits`
 *                       is provided as default value:
 *                       `CGAL::Eigen_solver_traits<Eigen::BiCGSTAB<CGAL::Eigen_sparse_matrix<double>::%EigenType, Eigen::IncompleteLUT<double> > >`}
+*     \cgalParamExtra{The sparsity pattern of the system does not change between iterations: with `Eigen_solver_traits`,
+*                     the symbolic analysis of the solver (e.g. the fill-reducing ordering of the preconditioner)
+*                     is computed at the first iteration only.}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the weights, the mass matrix, and the right-hand sides
+*                           should be computed using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{The vertex point map is read concurrently. The linear system is filled and solved
+*                     by the calling thread only.}
 *   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
@@ -127,6 +139,10 @@ void smooth_shape(const FaceRange& faces,
                      internal_np::vertex_is_constrained_t,
                      NamedParameters,
                      Static_boolean_property_map<vertex_descriptor, false> >::type  VCMap;
+  typedef typename internal_np::Lookup_named_param_def<
+                     internal_np::concurrency_tag_t,
+                     NamedParameters,
+                     Sequential_tag>::type                                           Concurrency_tag;
 
   using parameters::choose_parameter;
   using parameters::get_parameter;
@@ -174,7 +190,7 @@ void smooth_shape(const FaceRange& faces,
   Eigen_vector bx(n), by(n), bz(n), Xx(n), Xy(n), Xz(n);
   std::vector<CGAL::Triple<std::size_t, std::size_t, double> > stiffness;
 
-  internal::Shape_smoother<TriangleMesh, VertexPointMap, VCMap, Sparse_solver, GeomTraits> smoother(tmesh, vpmap, vcmap, scale_after_smoothing, gt);
+  internal::Shape_smoother<TriangleMesh, VertexPointMap, VCMap, Sparse_solver, GeomTraits, Concurrency_tag> smoother(tmesh, vpmap, vcmap, scale_after_smoothing, gt);
 
   smoother.init_smoothing(faces);
 
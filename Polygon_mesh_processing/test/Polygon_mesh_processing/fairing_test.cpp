@@ -6,10 +6,13 @@
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 
 #include <CGAL/Timer.h>
+#include <CGAL/use.h>
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <iterator>
+#include <vector>
 
 typedef CGAL::Exact_predicates_exact_constructions_kernel Epec;
 typedef CGAL::Exact_predicates_inexact_constructions_kernel Epic;
@@ -61,11 +64,68 @@ void test_polyhedron(const std::string filename, const K&, const bool save_outpu
   faired_off.close();
 }
 
+void test_solver_reuse_and_parallel(const std::string filename)
+{
+  typedef CGAL::Surface_mesh<Epic::Point_3> Mesh;
+  typedef Mesh::Vertex_index Vertex_index;
+  typedef CGAL::Eigen_solver_traits<Eigen::SparseLU<
+    CGAL::Eigen_sparse_matrix<double>::EigenType, Eigen::COLAMDOrdering<int> > > Solver;
+
+  Mesh mesh;
+  std::ifstream input(filename);
+  input >> mesh;
+  assert(!mesh.is_empty());
+
+  // fair the one-ring neighborhoods of a few vertices
+  std::vector<Vertex_index> sel_vert;
+  for(Vertex_index v : { Vertex_index(142), Vertex_index(1499), Vertex_index(2053) })
+  {
+    sel_vert.push_back(v);
+    for(Vertex_index w : vertices_around_target(halfedge(v, mesh), mesh))
+      if(!is_border(w, mesh))
+        sel_vert.push_back(w);
+  }
+  std::sort(sel_vert.begin(), sel_vert.end());
+  sel_vert.erase(std::unique(sel_vert.begin(), sel_vert.end()), sel_vert.end());
+
+  Mesh reference(mesh);
+  bool ok = CGAL::Polygon_mesh_processing::fair(reference, sel_vert);
+  assert(ok);
+
+  // a solver reused for a system with the same sparsity only recomputes the numerical factorization
+  Solver solver;
+  for(int i=0; i<2; ++i)
+  {
+    Mesh faired(mesh);
+    ok = CGAL::Polygon_mesh_processing::fair(faired, sel_vert,
+                                             CGAL::parameters::sparse_linear_solver(solver));
+    assert(ok);
+    for(Vertex_index v : vertices(mesh))
+    {
+      assert(faired.point(v) == reference.point(v));
+      CGAL_USE(v);
+    }
+  }
+
+  // the parallel construction of the rows gives the same system
+  Mesh faired(mesh);
+  ok = CGAL::Polygon_mesh_processing::fair(faired, sel_vert,
+                                           CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(ok);
+  for(Vertex_index v : vertices(mesh))
+  {
+    assert(faired.point(v) == reference.point(v));
+    CGAL_USE(v);
+  }
+  CGAL_USE(ok);
+}
+
 int main()
 {
   const std::string filename = CGAL::data_file_path("meshes/elephant.off");
     test_polyhedron(filename, Epic(), false);
     test_polyhedron(filename, Epec(), false);
+  test_solver_reuse_and_parallel(filename);
 
   std::cerr << "All done." << std::endl;
 
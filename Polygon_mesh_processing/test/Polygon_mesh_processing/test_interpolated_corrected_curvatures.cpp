@@ -178,6 +178,58 @@ void test_average_curvatures(std::string mesh_path,
 
 }
 
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
+// the parallel computation gives the same curvatures as the sequential one
+template <typename PolygonMesh>
+void test_parallel_curvatures(std::string mesh_path, Epic_kernel::FT expansion_radius)
+{
+  typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor vertex_descriptor;
+  typedef PMP::Principal_curvatures_and_directions<Epic_kernel> PCD;
+
+  PolygonMesh pmesh;
+  const std::string filename = CGAL::data_file_path(mesh_path);
+  if (!CGAL::IO::read_polygon_mesh(filename, pmesh) || faces(pmesh).size() == 0)
+  {
+    std::cerr << "Invalid input file." << std::endl;
+  }
+
+  typedef typename boost::property_map<PolygonMesh, CGAL::dynamic_vertex_property_t<Epic_kernel::FT>>::type Scalar_map;
+  typedef typename boost::property_map<PolygonMesh, CGAL::dynamic_vertex_property_t<PCD>>::type Principal_map;
+
+  Scalar_map seq_mean_map = get(CGAL::dynamic_vertex_property_t<Epic_kernel::FT>(), pmesh),
+    seq_gaussian_map = get(CGAL::dynamic_vertex_property_t<Epic_kernel::FT>(), pmesh),
+    par_mean_map = get(CGAL::dynamic_vertex_property_t<Epic_kernel::FT>(), pmesh),
+    par_gaussian_map = get(CGAL::dynamic_vertex_property_t<Epic_kernel::FT>(), pmesh);
+  Principal_map seq_principal_map = get(CGAL::dynamic_vertex_property_t<PCD>(), pmesh),
+    par_principal_map = get(CGAL::dynamic_vertex_property_t<PCD>(), pmesh);
+
+  PMP::interpolated_corrected_curvatures(
+    pmesh,
+    CGAL::parameters::ball_radius(expansion_radius)
+    .vertex_mean_curvature_map(seq_mean_map)
+    .vertex_Gaussian_curvature_map(seq_gaussian_map)
+    .vertex_principal_curvatures_and_directions_map(seq_principal_map)
+  );
+
+  PMP::interpolated_corrected_curvatures(
+    pmesh,
+    CGAL::parameters::ball_radius(expansion_radius)
+    .vertex_mean_curvature_map(par_mean_map)
+    .vertex_Gaussian_curvature_map(par_gaussian_map)
+    .vertex_principal_curvatures_and_directions_map(par_principal_map)
+    .concurrency_tag(CGAL::Parallel_tag())
+  );
+
+  for (vertex_descriptor v : vertices(pmesh)) {
+    assert(get(seq_mean_map, v) == get(par_mean_map, v));
+    assert(get(seq_gaussian_map, v) == get(par_gaussian_map, v));
+    assert(get(seq_principal_map, v).min_curvature == get(par_principal_map, v).min_curvature);
+    assert(get(seq_principal_map, v).max_curvature == get(par_principal_map, v).max_curvature);
+    assert(get(seq_principal_map, v).min_direction == get(par_principal_map, v).min_direction);
+  }
+}
+#endif
+
 int main()
 {
   // testing on a simple sphere(r = 0.5), on both Polyhedron & SurfaceMesh:
@@ -227,4 +279,10 @@ int main()
 
   test_average_curvatures<SMesh>("meshes/cylinder.off", Average_test_info(0.5, 0, 0.5, 0), false, 6);
   test_average_curvatures<SMesh>("meshes/cylinder.off", Average_test_info(0.5, 0, 0.5, 0.5), false, 6);
+
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
+  test_parallel_curvatures<SMesh>("meshes/sphere966.off", -1);
+  test_parallel_curvatures<SMesh>("meshes/sphere966.off", 5);
+  test_parallel_curvatures<Polyhedron>("meshes/cylinder.off", 0.5);
+#endif
 }
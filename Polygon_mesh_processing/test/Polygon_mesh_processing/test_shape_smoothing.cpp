@@ -185,6 +185,32 @@ void test_curvature_flow(Mesh mesh)
 #endif
 }
 
+template <typename Mesh>
+void test_parallel_curvature_flow(const Mesh& mesh)
+{
+#ifdef CGAL_PMP_SMOOTHING_DEBUG
+  std::cout << "-- test_parallel_curvature_flow --" << std::endl;
+#endif
+
+  typedef typename boost::graph_traits<Mesh>::vertex_descriptor vertex_descriptor;
+
+  const double time_step = 0.001;
+  Mesh mesh_seq(mesh);
+  PMP::smooth_shape(mesh_seq, time_step, CGAL::parameters::number_of_iterations(3));
+
+  // the linear systems are the same, whatever the concurrency tag
+  Mesh mesh_par(mesh);
+  PMP::smooth_shape(mesh_par, time_step, CGAL::parameters::number_of_iterations(3)
+                                                          .concurrency_tag(CGAL::Parallel_if_available_tag()));
+
+  std::vector<Point> points_seq, points_par;
+  for(vertex_descriptor v : vertices(mesh_seq))
+    points_seq.push_back(get(CGAL::vertex_point, mesh_seq, v));
+  for(vertex_descriptor v : vertices(mesh_par))
+    points_par.push_back(get(CGAL::vertex_point, mesh_par, v));
+  assert(points_seq == points_par);
+}
+
 int main(int, char**)
 {
   const std::string filename_devil = CGAL::data_file_path("meshes/mannequin-devil.off");
@@ -213,6 +239,7 @@ int main(int, char**)
   test_implicit_constrained_elephant<SurfaceMesh>(mesh_elephant);
   test_implicit_constrained_devil<SurfaceMesh>(mesh_devil);
   test_implicit_unscaled_elephant<SurfaceMesh>(mesh_elephant);
+  test_parallel_curvature_flow<SurfaceMesh>(mesh_elephant);
 
   input1.open(filename_devil);
   Mesh_with_id pl_mesh_devil;
@@ -241,6 +268,7 @@ int main(int, char**)
   test_implicit_constrained_elephant<Mesh_with_id>(pl_mesh_elephant);
   test_implicit_constrained_devil<Mesh_with_id>(pl_mesh_devil);
   test_implicit_unscaled_elephant<Mesh_with_id>(pl_mesh_elephant);
+  test_parallel_curvature_flow<Mesh_with_id>(pl_mesh_elephant);
 
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,93 @@
+// Measures the insertion/erasure throughput of Concurrent_compact_container,
+// and the growth of its capacity, when elements are erased by other threads
+// than the ones which inserted them (as in a parallel mesh refinement).
+
+#include <CGAL/Concurrent_compact_container.h>
+#include <CGAL/Real_timer.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/global_control.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+struct Truc
+{
+  Truc(int v = 0) : value(v), p(nullptr) {}
+  void *   for_compact_container() const { return p; }
+  void for_compact_container(void *ptr) { p = ptr; }
+
+  int value;
+  void * p;
+};
+
+typedef CGAL::Concurrent_compact_container<Truc> CCC;
+
+int main(int argc, char** argv)
+{
+  const std::size_t num_elements = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+  const int num_rounds = (argc > 2) ? std::atoi(argv[2]) : 10;
+  const int num_threads = (argc > 3) ? std::atoi(argv[3]) : -1;
+
+  std::unique_ptr<tbb::global_control> control;
+  if(num_threads > 0)
+    control = std::make_unique<tbb::global_control>(
+                tbb::global_control::max_allowed_parallelism, num_threads);
+
+  CCC ccc;
+  std::vector<CCC::iterator> iterators(num_elements);
+
+  CGAL::Real_timer timer;
+  timer.start();
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_elements),
+                    [&](const tbb::blocked_range<std::size_t>& r)
+  {
+    for(std::size_t i = r.begin(); i != r.end(); ++i)
+      iterators[i] = ccc.emplace(int(i));
+  });
+  timer.stop();
+  std::cout << "Parallel insertion of " << num_elements << " elements: "
+            << timer.time() << " s" << std::endl;
+
+  // Each round erases half of the elements, in an order unrelated to the threads
+  // which inserted them, then inserts as many new elements.
+  std::mt19937 gen(0);
+  std::vector<std::size_t> indices(num_elements);
+  for(std::size_t i = 0; i < num_elements; ++i)
+    indices[i] = i;
+
+  timer.reset();
+  for(int round = 0; round < num_rounds; ++round)
+  {
+    std::shuffle(indices.begin(), indices.end(), gen);
+    const std::size_t half = num_elements / 2;
+
+    timer.start();
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, half),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      for(std::size_t i = r.begin(); i != r.end(); ++i)
+        ccc.erase(iterators[indices[i]]);
+    });
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(half, num_elements),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      for(std::size_t i = r.begin(); i != r.end(); ++i)
+        iterators[indices[i - half]] = ccc.emplace(int(i));
+    });
+    timer.stop();
+
+    std::cout << "  round " << round << ": size = " << ccc.size()
+              << ", capacity = " << ccc.capacity() << std::endl;
+  }
+  std::cout << "Erasure/insertion rounds: " << timer.time() << " s" << std::endl;
+  std::cout << "Capacity/size ratio: "
+            << double(ccc.capacity()) / double(ccc.size()) << std::endl;
+
+  return EXIT_SUCCESS;
+}
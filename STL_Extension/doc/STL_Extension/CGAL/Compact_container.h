@@ -227,6 +227,25 @@ typedef unspecified_type const_reverse_iterator;
 /// @}
 
 
+/// \name Types
+/// @{
+/*!
+a range over the elements of the container, which is a model of the
+`Range` concept of \ref thirdpartyTBB: it can be split along the blocks
+of the container (and within a block), for example to iterate over the
+elements with `tbb::parallel_for()` without copying their handles.
+Its iterators skip the free elements and are convertible to `iterator`.
+*/
+typedef unspecified_type Splittable_range;
+
+/*!
+the constant version of `Splittable_range`, whose iterators are convertible
+to `const_iterator`.
+*/
+typedef unspecified_type Const_splittable_range;
+/// @}
+
+
 /// \name Types
 /// @{
 /*!
@@ -307,9 +326,9 @@ void swap(Compact_container<T, Allocator> &cc2);
 /// @{
 /*!
 if `value` is less than or equal to `capacity()`, this call
-has no effect. Otherwise, it is a request for allocation of
-additional memory so that then `capacity()` is greater than or
-equal to value. `size()` is unchanged.
+has no effect. Otherwise, a single block of `value - capacity()`
+elements is allocated, so that then `capacity()` is equal to `value`.
+`size()` is unchanged.
 */
 void reserve(size_type value);
 
@@ -366,6 +385,21 @@ const_iterator end() const;
 /// @}
 
 
+/// \name Access Member Functions
+/// @{
+/*!
+returns a splittable range over the elements of `cc`, whose subranges
+are not split further when they have at most `grainsize` slots.
+*/
+Splittable_range splittable_range(size_type grainsize = 1);
+
+/*!
+returns a constant splittable range over the elements of `cc`.
+*/
+Const_splittable_range splittable_range(size_type grainsize = 1) const;
+/// @}
+
+
 /// \name Access Member Functions
 /// @{
 /*!
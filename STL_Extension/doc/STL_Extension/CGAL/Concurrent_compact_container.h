@@ -152,6 +152,12 @@ public:
   typedef unspecified_type const_iterator;
   typedef unspecified_type reverse_iterator;
   typedef unspecified_type const_reverse_iterator;
+  /// a range over the elements, splittable along the blocks of the container,
+  /// which is a model of the `Range` concept of \ref thirdpartyTBB.
+  /// Its iterators skip the free elements and are convertible to `iterator`.
+  typedef unspecified_type Splittable_range;
+  /// the constant version of `Splittable_range`.
+  typedef unspecified_type Const_splittable_range;
 /// @}
 
 
@@ -209,6 +215,13 @@ complexity. No exception is thrown.
   /// returns a constant iterator which is the past-end-value of `ccc`.
   const_iterator end();
 
+  /// returns a splittable range over the elements of `ccc`, e.g.\ for `tbb::parallel_for()`,
+  /// whose subranges are not split further when they have at most `grainsize` slots.
+  /// It must not be used while elements are inserted or erased.
+  Splittable_range splittable_range(size_type grainsize = 1);
+  /// returns a constant splittable range over the elements of `ccc`.
+  Const_splittable_range splittable_range(size_type grainsize = 1) const;
+
   /// returns a mutable reverse iterator referring to the reverse beginning in `ccc`.
   reverse_iterator rbegin();
   /// returns a constant reverse iterator referring to the reverse beginning in `ccc`.
@@ -85,6 +85,11 @@ struct Parallel_tag {};
 \ingroup PkgSTLExtensionUtilities
 This tag is a convenience typedef to `Parallel_tag` if the third party library \ref thirdpartyTBB
 has been found and linked, and to `Sequential_tag` otherwise.
+
+\attention Only TBB is taken into account: this tag is `Sequential_tag` when CGAL is not linked with TBB,
+even if `CGAL::for_each()` has another parallel backend (`CGAL_HAS_PARALLEL_FOR_EACH` is defined),
+because many parallel algorithms of \cgal still require TBB. `Parallel_tag` must be used explicitly
+to run the algorithms based on `CGAL::for_each()` in parallel with OpenMP.
 */
 struct Parallel_if_available_tag {};
 
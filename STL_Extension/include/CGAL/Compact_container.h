@@ -26,6 +26,7 @@
 #include <cstring>
 #include <functional>
 #include <atomic>
+#include <type_traits>
 
 #include <CGAL/use.h>
 #include <CGAL/memory.h>
@@ -63,7 +64,6 @@
 //   time amortized (it's not true here, maybe it could be with some work...)
 // - all this is expected especially when there are not so many free objects
 //   compared to the allocated elements.
-// - Should block_size be selectable/hintable by .reserve() ?
 // - would be nice to have a temporary_free_list (still active elements, but
 //   which are going to be freed soon).  Probably it prevents compactness.
 // - eventually something to copy this data structure, providing a way to
@@ -165,6 +165,9 @@ namespace internal {
   template < class DSC, bool Const >
   class CC_iterator;
 
+  template < class DSC, bool Const >
+  class CC_splittable_range;
+
   CGAL_GENERATE_MEMBER_DETECTOR(increment_erase_counter);
 
   // A basic "no erase counter" strategy
@@ -244,8 +247,13 @@ public:
   typedef std::reverse_iterator<iterator>           reverse_iterator;
   typedef std::reverse_iterator<const_iterator>     const_reverse_iterator;
 
+  typedef internal::CC_splittable_range<Self, false> Splittable_range;
+  typedef internal::CC_splittable_range<Self, true>  Const_splittable_range;
+
   friend class internal::CC_iterator<Self, false>;
   friend class internal::CC_iterator<Self, true>;
+  friend class internal::CC_splittable_range<Self, false>;
+  friend class internal::CC_splittable_range<Self, true>;
 
   template<unsigned int first_block_size_, unsigned int block_size_increment>
     friend struct Addition_size_policy;
@@ -271,6 +279,7 @@ public:
   : alloc(c.get_allocator())
   {
     init();
+    reserve(c.size());
     block_size = c.block_size;
     time_stamp = 0;
     std::copy(c.begin(), c.end(), CGAL::inserter(*this));
@@ -325,9 +334,7 @@ public:
   bool is_used(size_type i) const
   {
     typename Self::size_type block_number, index_in_block;
-    Increment_policy::template get_index_and_block<Self>(i,
-                                                         index_in_block,
-                                                         block_number);
+    get_index_and_block(i, index_in_block, block_number);
     return (type(&all_items[block_number].first[index_in_block])
                  == USED);
   }
@@ -337,9 +344,7 @@ public:
     CGAL_assertion( is_used(i) );
 
     typename Self::size_type block_number, index_in_block;
-    Increment_policy::template get_index_and_block<Self>(i,
-                                                         index_in_block,
-                                                         block_number);
+    get_index_and_block(i, index_in_block, block_number);
     return all_items[block_number].first[index_in_block];
   }
 
@@ -348,9 +353,7 @@ public:
     CGAL_assertion( is_used(i) );
 
     typename Self::size_type block_number, index_in_block;
-    Increment_policy::template get_index_and_block<Self>(i,
-                                                         index_in_block,
-                                                         block_number);
+    get_index_and_block(i, index_in_block, block_number);
     return all_items[block_number].first[index_in_block];
   }
 
@@ -364,6 +367,17 @@ public:
   const_iterator begin() const { return empty()?end():const_iterator(first_item, 0, 0); }
   const_iterator end()   const { return const_iterator(last_item, 0); }
 
+  // A range over the elements which can be split along the blocks of the container,
+  // e.g. to iterate over them with `tbb::parallel_for()` without copying their handles.
+  Splittable_range splittable_range(size_type grainsize = 1)
+  {
+    return Splittable_range(all_items, grainsize);
+  }
+  Const_splittable_range splittable_range(size_type grainsize = 1) const
+  {
+    return Const_splittable_range(all_items, grainsize);
+  }
+
   reverse_iterator rbegin() { return reverse_iterator(end()); }
   reverse_iterator rend()   { return reverse_iterator(begin()); }
 
@@ -588,56 +602,42 @@ public:
 
   /** Reserve method to ensure that the capacity of the Compact_container be
    * greater or equal than a given value n.
+   * The missing capacity is allocated as a single block of exactly
+   * n - capacity() elements.
    */
   void reserve(size_type n)
   {
     if ( capacity_>=n ) return;
 
-    size_type lastblock = all_items.size();
-
-    while ( capacity_<n )
-    { // Pb because the order of free list is no more the order of
-      // allocate_new_block();
-      pointer new_block = alloc.allocate(block_size + 2);
-      all_items.push_back(std::make_pair(new_block, block_size + 2));
-      capacity_ += block_size;
-      // We insert this new block at the end.
-      if (last_item == nullptr) // First time
-      {
-        first_item = new_block;
-        last_item  = new_block + block_size + 1;
-        set_type(first_item, nullptr, START_END);
-      }
-      else
-      {
-        set_type(last_item, new_block, BLOCK_BOUNDARY);
-        set_type(new_block, last_item, BLOCK_BOUNDARY);
-        last_item = new_block + block_size + 1;
-      }
-      set_type(last_item, nullptr, START_END);
-      // Increase the block_size for the next time.
-      Increment_policy::increase_size(*this);
-    }
-
-    // Now we put all the new elements on freelist, starting from the last block
-    // inserted and mark them free in reverse order, so that the insertion order
-    // will correspond to the iterator order...
-    // We don't touch the first and the last one.
-    size_type curblock=all_items.size();
-    do
-    {
-      --curblock; // We are sure we have at least create a new block
-      pointer new_block = all_items[curblock].first;
-      for (size_type i = all_items[curblock].second-2; i >= 1; --i)
-        put_on_free_list(new_block + i);
-    }
-    while ( curblock>lastblock );
+    allocate_block(n - capacity_);
+    blocks_follow_policy = false;
   }
 
 private:
 
   void allocate_new_block();
 
+  // Allocates a block of n elements at the end of the container,
+  // and puts its elements on the free list.
+  void allocate_block(size_type n);
+
+  // Returns the block of the element of index i and its position in this block.
+  // The blocks follow the increment policy, unless the capacity was reserved
+  // or two containers were merged.
+  void get_index_and_block(size_type i, size_type& index, size_type& block) const
+  {
+    if ( blocks_follow_policy )
+    {
+      Increment_policy::template get_index_and_block<Self>(i, index, block);
+      return;
+    }
+
+    block = static_cast<size_type>(std::upper_bound(block_offsets.begin(),
+                                                    block_offsets.end(), i)
+                                   - block_offsets.begin()) - 1;
+    index = i - block_offsets[block] + 1;
+  }
+
   void put_on_free_list(pointer x)
   {
     set_type(x, free_list, FREE);
@@ -707,6 +707,8 @@ public:
     std::swap(last_item, c.last_item);
     std::swap(free_list, c.free_list);
     all_items.swap(c.all_items);
+    block_offsets.swap(c.block_offsets);
+    std::swap(blocks_follow_policy, c.blocks_follow_policy);
 
     // non-atomic swap of time_stamp:
     c.time_stamp = time_stamp.exchange(c.time_stamp.load());
@@ -720,6 +722,8 @@ private:
   // This opens up the possibility for the compiler to optimize the clear()
   // function considerably when has_trivial_destructor<T>.
   using All_items = std::vector<std::pair<pointer, size_type> >;
+  // The index of the first element of each block, i.e. the capacity before its allocation.
+  using Block_offsets = std::vector<size_type>;
 
   using time_stamp_t = std::atomic<std::size_t>;
 
@@ -732,6 +736,8 @@ private:
     first_item = nullptr;
     last_item  = nullptr;
     all_items  = All_items();
+    block_offsets = Block_offsets();
+    blocks_follow_policy = true;
     time_stamp = 0;
   }
 
@@ -743,6 +749,8 @@ private:
   pointer          first_item  = nullptr;
   pointer          last_item   = nullptr;
   All_items        all_items   = {};
+  Block_offsets    block_offsets = {};
+  bool             blocks_follow_policy = true;
   time_stamp_t     time_stamp  = {};
 };
 
@@ -773,6 +781,11 @@ void Compact_container<T, Allocator, Increment_policy, TimeStamper>::merge(Self
     last_item = d.last_item;
   }
   all_items.insert(all_items.end(), d.all_items.begin(), d.all_items.end());
+  for (size_type offset : d.block_offsets)
+    block_offsets.push_back(capacity_ + offset);
+  // The blocks of d do not continue the increment policy of *this.
+  blocks_follow_policy = (capacity_ == 0) ? d.blocks_follow_policy
+                                          : (blocks_follow_policy && d.capacity_ == 0);
   // Add the sizes.
   size_ += d.size_;
   // Add the capacities.
@@ -790,11 +803,15 @@ void Compact_container<T, Allocator, Increment_policy, TimeStamper>::clear()
        it != itend; ++it) {
     pointer p = it->first;
     size_type s = it->second;
-    for (pointer pp = p + 1; pp != p + s - 1; ++pp) {
-      if (type(pp) == USED)
-      {
-        std::allocator_traits<allocator_type>::destroy(alloc, pp);
-        set_type(pp, nullptr, FREE);
+    // The blocks are deallocated right after, so there is nothing to do
+    // for the elements if their destructor is trivial.
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+      for (pointer pp = p + 1; pp != p + s - 1; ++pp) {
+        if (type(pp) == USED)
+        {
+          std::allocator_traits<allocator_type>::destroy(alloc, pp);
+          set_type(pp, nullptr, FREE);
+        }
       }
     }
     alloc.deallocate(p, s);
@@ -804,17 +821,29 @@ void Compact_container<T, Allocator, Increment_policy, TimeStamper>::clear()
 
 template < class T, class Allocator, class Increment_policy, class TimeStamper >
 void Compact_container<T, Allocator, Increment_policy, TimeStamper>::allocate_new_block()
+{
+  allocate_block(block_size);
+  // Increase the block_size for the next time.
+  Increment_policy::increase_size(*this);
+}
+
+template < class T, class Allocator, class Increment_policy, class TimeStamper >
+void Compact_container<T, Allocator, Increment_policy, TimeStamper>::allocate_block(size_type n)
 {
   typedef internal::Erase_counter_strategy<
     internal::has_increment_erase_counter<T>::value> EraseCounterStrategy;
 
-  pointer new_block = alloc.allocate(block_size + 2);
-  all_items.push_back(std::make_pair(new_block, block_size + 2));
-  capacity_ += block_size;
+  CGAL_precondition(n > 0);
+
+  pointer new_block = alloc.allocate(n + 2);
+  all_items.push_back(std::make_pair(new_block, n + 2));
+  block_offsets.push_back(capacity_);
+  capacity_ += n;
   // We don't touch the first and the last one.
   // We mark them free in reverse order, so that the insertion order
   // will correspond to the iterator order...
-  for (size_type i = block_size; i >= 1; --i)
+  // The new elements are put in front of the existing free list.
+  for (size_type i = n; i >= 1; --i)
   {
     EraseCounterStrategy::set_erase_counter(*(new_block + i), 0);
     Time_stamper::initialize_time_stamp(new_block + i);
@@ -824,18 +853,16 @@ void Compact_container<T, Allocator, Increment_policy, TimeStamper>::allocate_ne
   if (last_item == nullptr) // First time
   {
       first_item = new_block;
-      last_item  = new_block + block_size + 1;
+      last_item  = new_block + n + 1;
       set_type(first_item, nullptr, START_END);
   }
   else
   {
       set_type(last_item, new_block, BLOCK_BOUNDARY);
       set_type(new_block, last_item, BLOCK_BOUNDARY);
-      last_item = new_block + block_size + 1;
+      last_item = new_block + n + 1;
   }
   set_type(last_item, nullptr, START_END);
-  // Increase the block_size for the next time.
-  Increment_policy::increase_size(*this);
 }
 
 template < class T, class Allocator, class Increment_policy, class TimeStamper >
@@ -1173,6 +1200,150 @@ namespace internal {
     return Stamper::hash_value(i.operator->());
   }
 
+  // A range over the elements of a Compact_container or of a
+  // Concurrent_compact_container, which is a model of the Range concept of TBB:
+  // it is split along the blocks of the container, then within a block.
+  // Its iterators skip the free elements, and convert to the iterators
+  // (handles) of the container.
+  template < class DSC, bool Const >
+  class CC_splittable_range
+  {
+    typedef CC_splittable_range<DSC, Const>           Self;
+    typedef typename DSC::All_items                   All_items;
+    typedef typename DSC::pointer                     Slot;
+
+  public:
+    typedef typename DSC::value_type                  value_type;
+    typedef typename DSC::size_type                   size_type;
+    typedef std::conditional_t< Const, typename DSC::const_iterator,
+                                       typename DSC::iterator> Handle;
+
+    class iterator
+    {
+    public:
+      typedef typename Self::value_type               value_type;
+      typedef typename DSC::difference_type           difference_type;
+      typedef std::conditional_t< Const, const value_type*,
+                                         value_type*> pointer;
+      typedef std::conditional_t< Const, const value_type&,
+                                         value_type&> reference;
+      typedef std::forward_iterator_tag               iterator_category;
+
+      iterator() : m_ptr(nullptr), m_end(nullptr) {}
+      iterator(Slot ptr, Slot end) : m_ptr(ptr), m_end(end) { skip_free_slots(); }
+
+      reference operator*() const { return *m_ptr; }
+      pointer operator->() const { return m_ptr; }
+      operator Handle() const { return Handle(m_ptr); }
+
+      iterator& operator++()
+      {
+        CGAL_assertion(m_ptr != m_end);
+        ++m_ptr;
+        skip_free_slots();
+        return *this;
+      }
+      iterator operator++(int) { iterator tmp(*this); ++(*this); return tmp; }
+
+      bool operator==(const iterator& other) const { return m_ptr == other.m_ptr; }
+      bool operator!=(const iterator& other) const { return m_ptr != other.m_ptr; }
+
+    private:
+      void skip_free_slots()
+      {
+        while(m_ptr != m_end && DSC::type(m_ptr) != DSC::USED)
+        {
+          // jump to the first slot of the next block
+          if(DSC::type(m_ptr) == DSC::BLOCK_BOUNDARY)
+            m_ptr = DSC::clean_pointee(m_ptr);
+          ++m_ptr;
+        }
+      }
+
+      Slot m_ptr;
+      Slot m_end;
+    };
+    typedef iterator                                  const_iterator;
+
+    CC_splittable_range()
+      : m_blocks(nullptr), m_first_block(0), m_last_block(0),
+        m_begin(0), m_end(0), m_grainsize(1)
+    {}
+
+    CC_splittable_range(const All_items& blocks, size_type grainsize)
+      : m_blocks(&blocks), m_first_block(0), m_last_block(0),
+        m_begin(0), m_end(0), m_grainsize((std::max)(grainsize, size_type(1)))
+    {
+      if(!blocks.empty())
+      {
+        // the first and last slots of a block are not elements
+        m_last_block = blocks.size() - 1;
+        m_begin = 1;
+        m_end = blocks.back().second - 1;
+      }
+    }
+
+    // Splitting constructor: `r` keeps the first half of the slots
+    // and the new range gets the second half.
+    template <typename Split>
+    CC_splittable_range(Self& r, Split)
+      : Self(r)
+    {
+      CGAL_precondition(r.is_divisible());
+      if(r.m_first_block < r.m_last_block)
+      {
+        const size_type mid = r.m_first_block + (r.m_last_block - r.m_first_block + 1) / 2;
+        r.m_last_block = mid - 1;
+        r.m_end = (*m_blocks)[mid - 1].second - 1;
+        m_first_block = mid;
+        m_begin = 1;
+      }
+      else
+      {
+        const size_type mid = r.m_begin + (r.m_end - r.m_begin) / 2;
+        r.m_end = mid;
+        m_begin = mid;
+      }
+    }
+
+    bool empty() const
+    {
+      return m_first_block == m_last_block && m_begin >= m_end;
+    }
+
+    bool is_divisible() const
+    {
+      return m_first_block < m_last_block || m_end - m_begin > m_grainsize;
+    }
+
+    size_type grainsize() const { return m_grainsize; }
+
+    iterator begin() const
+    {
+      if(empty())
+        return end();
+      return iterator((*m_blocks)[m_first_block].first + m_begin, end_slot());
+    }
+
+    iterator end() const
+    {
+      return iterator(end_slot(), end_slot());
+    }
+
+  private:
+    Slot end_slot() const
+    {
+      return (m_blocks == nullptr || m_blocks->empty())
+               ? nullptr : (*m_blocks)[m_last_block].first + m_end;
+    }
+
+    const All_items* m_blocks;
+    // blocks of the range, and slots in the first and last blocks
+    size_type m_first_block, m_last_block;
+    size_type m_begin, m_end;
+    size_type m_grainsize;
+  };
+
 namespace handle {
   // supply a specialization for Hash_functor
 
@@ -24,6 +24,8 @@
 #include <vector>
 #include <cstring>
 #include <cstddef>
+#include <atomic>
+#include <memory>
 
 #include <CGAL/Compact_container.h>
 
@@ -33,6 +35,7 @@
 #include <CGAL/CC_safe_handle.h>
 #include <CGAL/Time_stamper.h>
 
+#include <tbb/concurrent_queue.h>
 #include <tbb/enumerable_thread_specific.h>
 #include <tbb/queuing_mutex.h>
 
@@ -59,6 +62,12 @@ template<typename T> class has_##X {                                          \
 #define CGAL_INIT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE 14
 #define CGAL_INCREMENT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE 16
 
+// Number of free elements that a thread gives back to the other threads at once,
+// when this many elements erased by the thread are in its own free list.
+#ifndef CGAL_CONCURRENT_COMPACT_CONTAINER_FREE_LIST_BATCH_SIZE
+#define CGAL_CONCURRENT_COMPACT_CONTAINER_FREE_LIST_BATCH_SIZE 256
+#endif
+
 // The traits class describes the way to access the pointer.
 // It can be specialized.
 template < class T >
@@ -115,7 +124,7 @@ class Free_list {
   // Not that the implicitly-defined member functions copy the
   // pointer, and not the pointed data.
 public:
-  Free_list() : m_head(nullptr), m_size(0) {
+  Free_list() : m_head(nullptr), m_size(0), m_nb_erased(0) {
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
     // Note that the performance penalty with
     // CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE=1 is
@@ -125,7 +134,7 @@ public:
 #endif // CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
   }
 
-  void init()                { m_head = nullptr; m_size = 0; }
+  void init()                { m_head = nullptr; m_size = 0; m_nb_erased = 0; }
   pointer head() const       { return m_head; }
   void set_head(pointer p)   { m_head = p; }
   size_type size() const     { return m_size; }
@@ -151,6 +160,28 @@ public:
   }
   bool empty()               { return size() == 0; }
 
+  // Erased elements are put at the head of the free list, and inserted elements
+  // are taken from it, so the erased elements still free are the first ones.
+  size_type nb_erased() const { return m_nb_erased; }
+  void inc_nb_erased()        { ++m_nb_erased; }
+  void dec_nb_erased()        { if (m_nb_erased > 0) --m_nb_erased; }
+
+  // Detaches the `n` first elements of the free list, and returns their head.
+  // The detached elements are still linked together.
+  pointer split(size_type n)
+  {
+    CGAL_precondition(0 < n && n <= m_size);
+    pointer head = m_head;
+    pointer last = head;
+    for (size_type i = 1; i < n; ++i)
+      last = CCC::clean_pointee(last);
+    m_head = CCC::clean_pointee(last);
+    CCC::set_type(last, nullptr, CCC::FREE);
+    set_size(m_size - n);
+    m_nb_erased = (n < m_nb_erased) ? m_nb_erased - n : 0;
+    return head;
+  }
+
   void merge(Free_list &other)
   {
     if (m_head == nullptr) {
@@ -176,6 +207,7 @@ public:
 protected:
   pointer   m_head;  // the free list head pointer
   size_type m_size;  // the free list size
+  size_type m_nb_erased; // the number of erased elements at the head of the free list
 
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
   // `m_size` plus or minus `precision_of_approximate_size - 1`
@@ -222,14 +254,24 @@ public:
   typedef std::reverse_iterator<iterator>           reverse_iterator;
   typedef std::reverse_iterator<const_iterator>     const_reverse_iterator;
 
+  typedef internal::CC_splittable_range<Self, false> Splittable_range;
+  typedef internal::CC_splittable_range<Self, true>  Const_splittable_range;
+
 private:
   typedef Free_list<pointer, size_type, Self>       FreeList;
   typedef tbb::enumerable_thread_specific<FreeList> Free_lists;
 
+  // Linked free elements given back by a thread, and taken by any thread
+  // whose free list is empty before it allocates a new block.
+  typedef std::pair<pointer, size_type>             Free_batch;
+  typedef tbb::concurrent_queue<Free_batch>         Free_batches;
+
   // FreeList can access our private function (clean_pointee...)
   friend class Free_list<pointer, size_type, Self>;
 
 public:
+  friend class internal::CC_splittable_range<Self, false>;
+  friend class internal::CC_splittable_range<Self, true>;
   friend class internal::CC_iterator<Self, false>;
   friend class internal::CC_iterator<Self, true>;
 
@@ -253,7 +295,7 @@ public:
   : m_alloc(c.get_allocator())
   {
     init();
-    m_block_size = c.m_block_size;
+    m_block_size = c.m_block_size.load();
     std::copy(c.begin(), c.end(), CGAL::inserter(*this));
   }
 
@@ -282,6 +324,7 @@ public:
   ~Concurrent_compact_container()
   {
     clear();
+    delete m_free_batches.load();
   }
 
   bool is_used(const_iterator ptr) const
@@ -299,10 +342,15 @@ public:
     std::swap(m_capacity, c.m_capacity);
 #endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
 
-    std::swap(m_block_size, c.m_block_size);
+    // non-atomic swap of m_block_size
+    c.m_block_size = m_block_size.exchange(c.m_block_size.load());
     std::swap(m_first_item, c.m_first_item);
     std::swap(m_last_item, c.m_last_item);
     std::swap(m_free_lists, c.m_free_lists);
+    // non-atomic swap of m_free_batches
+    c.m_free_batches = m_free_batches.exchange(c.m_free_batches.load());
+    // non-atomic swap of m_batched_size
+    c.m_batched_size = m_batched_size.exchange(c.m_batched_size.load());
     m_all_items.swap(c.m_all_items);
     // non-atomic swap of m_time_stamp
     c.m_time_stamp = m_time_stamp.exchange(c.m_time_stamp.load());
@@ -318,6 +366,18 @@ public:
   const_iterator begin() const { return empty()?end():const_iterator(m_first_item, 0, 0); }
   const_iterator end()   const { return const_iterator(m_last_item, 0); }
 
+  // A range over the elements which can be split along the blocks of the container,
+  // e.g. to iterate over them with `tbb::parallel_for()` without copying their handles.
+  // It must not be used while elements are inserted or erased.
+  Splittable_range splittable_range(size_type grainsize = 1)
+  {
+    return Splittable_range(m_all_items, grainsize);
+  }
+  Const_splittable_range splittable_range(size_type grainsize = 1) const
+  {
+    return Const_splittable_range(m_all_items, grainsize);
+  }
+
   reverse_iterator rbegin() { return reverse_iterator(end()); }
   reverse_iterator rend()   { return reverse_iterator(begin()); }
 
@@ -394,6 +454,11 @@ private:
     std::allocator_traits<allocator_type>::destroy(m_alloc, &*x);
 
     put_on_free_list(&*x, fl);
+    fl->inc_nb_erased();
+
+    // Erased elements would otherwise stay in the free list of the erasing thread
+    if (fl->nb_erased() >= free_list_batch_size)
+      release_free_batch(fl);
   }
 public:
 
@@ -427,7 +492,7 @@ public:
     {
       size -= it_free_list->size();
     }
-    return size;
+    return size - m_batched_size.load(std::memory_order_relaxed);
   }
 
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
@@ -440,7 +505,7 @@ public:
     {
       size -= it_free_list->approximate_size();
     }
-    return size;
+    return size - m_batched_size.load(std::memory_order_relaxed);
   }
 #endif // CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
 
@@ -574,13 +639,14 @@ private:
 
   // Two helper functions for the emplace() methods
 
-  // allocate new space if needed get the pointer from
-  // the free list and then clean it
+  // take free elements released by other threads, or allocate new space if needed,
+  // get the pointer from the free list and then clean it
   pointer init_insert(FreeList * fl)
   {
     pointer fl2 = fl->head();
     if (fl2 == nullptr) {
-      allocate_new_block(fl);
+      if (!acquire_free_batch(fl))
+        allocate_new_block(fl);
       fl2 = fl->head();
     }
     pointer ret = fl2;
@@ -594,12 +660,52 @@ private:
   {
     CGAL_assertion(type(ret) == USED);
     fl->dec_size();
+    fl->dec_nb_erased();
     Time_stamper::set_time_stamp(ret, m_time_stamp);
     return iterator(ret, 0);
   }
 
   void allocate_new_block(FreeList *fl);
 
+  static constexpr size_type free_list_batch_size =
+    CGAL_CONCURRENT_COMPACT_CONTAINER_FREE_LIST_BATCH_SIZE;
+
+  // Returns the shared free batches, which are allocated by the first thread giving back a batch.
+  Free_batches& free_batches()
+  {
+    Free_batches* batches = m_free_batches.load(std::memory_order_acquire);
+    if (batches == nullptr) {
+      Free_batches* new_batches = new Free_batches();
+      if (m_free_batches.compare_exchange_strong(batches, new_batches, std::memory_order_acq_rel))
+        batches = new_batches;
+      else
+        delete new_batches;
+    }
+    return *batches;
+  }
+
+  // Moves `free_list_batch_size` elements of `fl` to the shared free batches.
+  void release_free_batch(FreeList * fl)
+  {
+    pointer head = fl->split(free_list_batch_size);
+    m_batched_size.fetch_add(free_list_batch_size, std::memory_order_relaxed);
+    free_batches().push(Free_batch(head, free_list_batch_size));
+  }
+
+  // Moves a shared free batch, if any, to the empty free list `fl`.
+  bool acquire_free_batch(FreeList * fl)
+  {
+    CGAL_precondition(fl->head() == nullptr);
+    Free_batches* batches = m_free_batches.load(std::memory_order_acquire);
+    Free_batch batch;
+    if (batches == nullptr || !batches->try_pop(batch))
+      return false;
+    m_batched_size.fetch_sub(batch.second, std::memory_order_relaxed);
+    fl->set_head(batch.first);
+    fl->set_size(batch.second);
+    return true;
+  }
+
   void put_on_free_list(pointer x, FreeList * fl)
   {
     set_type(x, fl->head(), FREE);
@@ -677,6 +783,9 @@ private:
   {
     m_block_size = CGAL_INIT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;
     m_capacity  = 0;
+    if (Free_batches* batches = m_free_batches.load())
+      batches->clear();
+    m_batched_size = 0;
     for( typename Free_lists::iterator it_free_list = m_free_lists.begin() ;
          it_free_list != m_free_lists.end() ;
          ++it_free_list )
@@ -696,8 +805,12 @@ private:
 #else // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
   size_type         m_capacity      = {};
 #endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-  size_type         m_block_size    = CGAL_INIT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;
+  std::atomic<size_type> m_block_size = CGAL_INIT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;
   Free_lists        m_free_lists;
+  // the queue is held by pointer so that swap() does not need to swap queues,
+  // and allocated on first use so that constructing a container does not allocate it
+  std::atomic<Free_batches*> m_free_batches = {nullptr};
+  std::atomic<size_type> m_batched_size = {};
   pointer           m_first_item    = nullptr;
   pointer           m_last_item     = nullptr;
   All_items         m_all_items     = {};
@@ -736,6 +849,12 @@ void Concurrent_compact_container<T, Allocator>::merge(Self &d)
 
     it_free_list->merge(*it_free_list_d);
   }
+  if (Free_batches* d_batches = d.m_free_batches.load()) {
+    Free_batch batch;
+    while (d_batches->try_pop(batch))
+      free_batches().push(batch);
+  }
+  m_batched_size.fetch_add(d.m_batched_size.load(), std::memory_order_relaxed);
   // Concatenate the blocks.
   if (m_last_item == nullptr) { // empty...
     m_first_item = d.m_first_item;
@@ -753,7 +872,7 @@ void Concurrent_compact_container<T, Allocator>::merge(Self &d)
   m_capacity += d.m_capacity;
 #endif // not  CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
   // It seems reasonable to take the max of the block sizes.
-  m_block_size = (std::max)(m_block_size, d.m_block_size);
+  m_block_size = (std::max)(m_block_size.load(), d.m_block_size.load());
   // Clear d.
   d.init();
 }
@@ -781,46 +900,45 @@ void Concurrent_compact_container<T, Allocator>::
   typedef CCC_internal::Erase_counter_strategy<
     CCC_internal::has_increment_erase_counter<T>::value> EraseCounterStrategy;
 
-  size_type old_block_size;
-  pointer new_block;
+  // The size of the block is reserved, and the block is allocated and initialized,
+  // without locking: the lock only protects the linking of the blocks.
+  const size_type block_size =
+    m_block_size.fetch_add(CGAL_INCREMENT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE,
+                           std::memory_order_relaxed);
+  pointer new_block = m_alloc.allocate(block_size + 2);
+
+  // We don't touch the first and the last one.
+  // We mark them free in reverse order, so that the insertion order
+  // will correspond to the iterator order...
+  for (size_type i = block_size; i >= 1; --i)
+  {
+    EraseCounterStrategy::set_erase_counter(*(new_block + i), 0);
+    Time_stamper::initialize_time_stamp(new_block + i);
+    put_on_free_list(new_block + i, fl);
+  }
+  set_type(new_block + block_size + 1, nullptr, START_END);
 
   {
     Mutex::scoped_lock lock(m_mutex);
-    old_block_size = m_block_size;
-    new_block = m_alloc.allocate(old_block_size + 2);
-    m_all_items.push_back(std::make_pair(new_block, old_block_size + 2));
+    m_all_items.push_back(std::make_pair(new_block, block_size + 2));
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-    m_capacity.fetch_add(old_block_size, std::memory_order_relaxed);
+    m_capacity.fetch_add(block_size, std::memory_order_relaxed);
 #else // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
-    m_capacity += old_block_size;
+    m_capacity += block_size;
 #endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
 
     // We insert this new block at the end.
     if (m_last_item == nullptr) // First time
     {
         m_first_item = new_block;
-        m_last_item  = new_block + old_block_size + 1;
         set_type(m_first_item, nullptr, START_END);
     }
     else
     {
         set_type(m_last_item, new_block, BLOCK_BOUNDARY);
         set_type(new_block, m_last_item, BLOCK_BOUNDARY);
-        m_last_item = new_block + old_block_size + 1;
     }
-    set_type(m_last_item, nullptr, START_END);
-    // Increase the m_block_size for the next time.
-    m_block_size += CGAL_INCREMENT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;
-  }
-
-  // We don't touch the first and the last one.
-  // We mark them free in reverse order, so that the insertion order
-  // will correspond to the iterator order...
-  for (size_type i = old_block_size; i >= 1; --i)
-  {
-    EraseCounterStrategy::set_erase_counter(*(new_block + i), 0);
-    Time_stamper::initialize_time_stamp(new_block + i);
-    put_on_free_list(new_block + i, fl);
+    m_last_item = new_block + block_size + 1;
   }
 }
 
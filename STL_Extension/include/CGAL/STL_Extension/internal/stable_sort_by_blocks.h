@@ -0,0 +1,73 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_STL_EXTENSION_INTERNAL_STABLE_SORT_BY_BLOCKS_H
+#define CGAL_STL_EXTENSION_INTERNAL_STABLE_SORT_BY_BLOCKS_H
+
+#include <CGAL/tags.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace CGAL {
+
+namespace internal {
+
+// Stable sort of `values`, in which an element is never compared by two threads
+// at the same time. This is needed when comparisons modify the elements, as do
+// lazy number types that compute and store their exact value on demand.
+//
+// With `Parallel_tag`, disjoint blocks are sorted concurrently, and then merged pairwise.
+template <class ConcurrencyTag, class T, class Compare>
+void stable_sort_by_blocks(std::vector<T>& values, const Compare& less,
+                           std::size_t block_size = std::size_t(1) << 14)
+{
+  const std::size_t size = values.size();
+  if (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value || size <= 2 * block_size) {
+    std::stable_sort(values.begin(), values.end(), less);
+    return;
+  }
+
+  const std::size_t nb_blocks = (size + block_size - 1) / block_size;
+  CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, nb_blocks),
+    [&](std::size_t b) -> bool {
+      std::stable_sort(values.begin() + b * block_size,
+                       values.begin() + (std::min)(size, (b + 1) * block_size), less);
+      return true;
+    });
+
+  std::vector<T> buffer(size);
+  for (std::size_t width = block_size; width < size; width *= 2) {
+    const std::size_t nb_merges = (size + 2 * width - 1) / (2 * width);
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, nb_merges),
+      [&](std::size_t m) -> bool {
+        const std::size_t first = 2 * m * width;
+        const std::size_t middle = (std::min)(size, first + width);
+        const std::size_t last = (std::min)(size, first + 2 * width);
+        std::merge(std::make_move_iterator(values.begin() + first),
+                   std::make_move_iterator(values.begin() + middle),
+                   std::make_move_iterator(values.begin() + middle),
+                   std::make_move_iterator(values.begin() + last),
+                   buffer.begin() + first, less);
+        return true;
+      });
+    values.swap(buffer);
+  }
+}
+
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_STL_EXTENSION_INTERNAL_STABLE_SORT_BY_BLOCKS_H
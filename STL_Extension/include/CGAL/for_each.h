@@ -14,10 +14,25 @@
 
 #include <CGAL/iterator.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #ifdef CGAL_LINKED_WITH_TBB
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
 #include <tbb/scalable_allocator.h>
+#elif defined(_OPENMP)
+#include <omp.h>
+#elif defined(CGAL_FOR_EACH_USE_STD_EXECUTION)
+#include <execution>
+#include <numeric>
+#include <thread>
 #endif // CGAL_LINKED_WITH_TBB
 
 /*
@@ -25,25 +40,138 @@
 
   - if Sequential_tag is used, apply Function to all elements of Range
   - if Parallel_tag is used:
-    * static assert that TBB is available
-    * if Range has random access iterators, use a TBB parallel_for
+    * static assert that a parallel backend is available
+    * if Range provides a `splittable_range()` (like `Compact_container`
+    and `Concurrent_compact_container`) and the backend is TBB, use a
+    TBB parallel_for loop over that range
+    * otherwise, if Range has random access iterators, use a parallel
     loop to apply Function to all elements of Range
-    * if Range doesn't have random access iterators, first copy the
-    iterators in a vector and then use a TBB parallel_for loop to
-    apply Function to all elements of Range
+    * otherwise, first copy the iterators in a vector and then use a
+    parallel loop to apply Function to all elements of Range
 
   The loop is interrupted if `functor` returns false (it carries on
-  until the end otherwise).
+  until the end otherwise). In parallel, only the subrange being
+  processed by the thread is interrupted.
+
+  The parallel backend is, by order of preference:
+  - TBB, if CGAL is linked with it (CGAL_LINKED_WITH_TBB);
+  - OpenMP, if the code is compiled with OpenMP support (_OPENMP);
+  - the parallel algorithms of the standard library (std::execution::par),
+    if CGAL_FOR_EACH_USE_STD_EXECUTION is defined and they are available.
+  CGAL_HAS_PARALLEL_FOR_EACH is defined if one of them is used.
+
+  An optional `For_each_hints` object gives the minimal number of elements
+  processed by a task, and an affinity object that makes loops replay the
+  assignment of the elements to the threads of a previous loop (TBB only).
 */
 
+#if defined(CGAL_LINKED_WITH_TBB)
+#  define CGAL_FOR_EACH_TBB_BACKEND 1
+#elif defined(_OPENMP)
+#  define CGAL_FOR_EACH_OPENMP_BACKEND 1
+#elif defined(CGAL_FOR_EACH_USE_STD_EXECUTION) && defined(__cpp_lib_parallel_algorithm)
+#  define CGAL_FOR_EACH_STD_EXECUTION_BACKEND 1
+#endif
+
+#if defined(CGAL_FOR_EACH_TBB_BACKEND) || defined(CGAL_FOR_EACH_OPENMP_BACKEND) || \
+    defined(CGAL_FOR_EACH_STD_EXECUTION_BACKEND)
+#  define CGAL_HAS_PARALLEL_FOR_EACH 1
+#endif
+
 namespace CGAL {
 
+// Records the assignment of the elements to the threads by a parallel loop,
+// so that the next loops using the same object (on a range of the same size)
+// replay it and find the elements in the caches of the threads.
+// Only the TBB backend uses it.
+class For_each_affinity
+{
+#ifdef CGAL_FOR_EACH_TBB_BACKEND
+  tbb::affinity_partitioner m_partitioner;
+
+public:
+  tbb::affinity_partitioner& partitioner() { return m_partitioner; }
+#endif
+};
+
+struct For_each_hints
+{
+  // minimal number of elements processed by a task
+  std::size_t grainsize = 1;
+  // if not null, used by the successive loops over the same data
+  For_each_affinity* affinity = nullptr;
+};
+
 namespace internal {
 
+template <typename Range, typename = void>
+struct Has_splittable_range : std::false_type { };
+
+template <typename Range>
+struct Has_splittable_range<Range,
+                            std::void_t<decltype(std::declval<Range&>().splittable_range())> >
+  : std::true_type { };
+
+// Calls `body(begin, end)` on subranges of [0, size).
+template <typename Body>
+void for_each_subrange (std::size_t size,
+                        const Body& body,
+                        const For_each_hints&,
+                        const Sequential_tag&)
+{
+  if (size != 0)
+    body (std::size_t(0), size);
+}
+
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
+template <typename Body>
+void for_each_subrange (std::size_t size,
+                        const Body& body,
+                        const For_each_hints& hints,
+                        const Parallel_tag&)
+{
+  const std::size_t grainsize = (std::max) (hints.grainsize, std::size_t(1));
+
+#if defined(CGAL_FOR_EACH_TBB_BACKEND)
+  tbb::blocked_range<std::size_t> range (0, size, grainsize);
+  auto tbb_body = [&](const tbb::blocked_range<std::size_t>& r) { body (r.begin(), r.end()); };
+  if (hints.affinity != nullptr)
+    tbb::parallel_for (range, tbb_body, hints.affinity->partitioner());
+  else
+    tbb::parallel_for (range, tbb_body);
+#else
+  // Several chunks per thread to balance the load, but at least `grainsize` elements per chunk
+# if defined(CGAL_FOR_EACH_OPENMP_BACKEND)
+  const std::size_t nb_threads = std::size_t ((std::max) (omp_get_max_threads(), 1));
+# else
+  const std::size_t nb_threads = (std::max) (std::size_t (std::thread::hardware_concurrency()),
+                                             std::size_t(1));
+# endif
+  const std::size_t chunk_size = (std::max) (grainsize, size / (8 * nb_threads));
+  const std::size_t nb_chunks = (size + chunk_size - 1) / chunk_size;
+  auto chunk_body = [&](std::size_t c)
+                    {
+                      body (c * chunk_size, (std::min) (size, (c + 1) * chunk_size));
+                    };
+
+# if defined(CGAL_FOR_EACH_OPENMP_BACKEND)
+#   pragma omp parallel for schedule(dynamic)
+  for (std::ptrdiff_t c = 0; c < std::ptrdiff_t(nb_chunks); ++ c)
+    chunk_body (std::size_t(c));
+# else
+  std::vector<std::size_t> chunks (nb_chunks);
+  std::iota (chunks.begin(), chunks.end(), std::size_t(0));
+  std::for_each (std::execution::par, chunks.begin(), chunks.end(), chunk_body);
+# endif
+#endif
+}
+#endif // CGAL_HAS_PARALLEL_FOR_EACH
+
 template <typename RangeRef, typename IteratorCategory>
 void for_each (RangeRef range,
                const std::function<bool(typename std::iterator_traits
                                         <typename Range_iterator_type<RangeRef>::type>::reference)>& functor,
+               const For_each_hints&,
                const Sequential_tag&,
                IteratorCategory)
 {
@@ -53,13 +181,33 @@ void for_each (RangeRef range,
       break;
 }
 
-#ifdef CGAL_LINKED_WITH_TBB
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
 template <typename RangeRef, typename Fct, typename IteratorCategory>
 void for_each (RangeRef range,
                const Fct& functor,
-               const Parallel_tag&,
+               const For_each_hints& hints,
+               const Parallel_tag& tag,
                IteratorCategory)
 {
+#ifdef CGAL_FOR_EACH_TBB_BACKEND
+  if constexpr (Has_splittable_range<std::remove_reference_t<RangeRef> >::value)
+  {
+    typedef decltype(range.splittable_range()) Splittable_range;
+    auto body = [&](const Splittable_range& r)
+                {
+                  for (auto it = r.begin(); it != r.end(); ++ it)
+                    if (!functor (*it))
+                      break;
+                };
+    if (hints.affinity != nullptr)
+      tbb::parallel_for (range.splittable_range(hints.grainsize), body,
+                         hints.affinity->partitioner());
+    else
+      tbb::parallel_for (range.splittable_range(hints.grainsize), body);
+    return;
+  }
+#endif
+
   std::size_t range_size = std::distance (range.begin(), range.end());
 
   std::vector<typename Range_iterator_type<RangeRef>::type> iterators;
@@ -67,47 +215,51 @@ void for_each (RangeRef range,
   for (typename Range_iterator_type<RangeRef>::type it = range.begin(); it != range.end(); ++ it)
     iterators.push_back (it);
 
-  tbb::parallel_for (tbb::blocked_range<std::size_t>(0, range_size),
-                     [&](const tbb::blocked_range<std::size_t>& r)
+  for_each_subrange (range_size,
+                     [&](std::size_t begin, std::size_t end)
                      {
-                       for (std::size_t i = r.begin(); i != r.end(); ++ i)
+                       for (std::size_t i = begin; i != end; ++ i)
                          if (!functor (*(iterators[i])))
                            break;
-                     });
+                     },
+                     hints, tag);
 }
 
 template <typename RangeRef, typename Fct>
 void for_each (RangeRef range,
                const Fct& functor,
-               const Parallel_tag&,
+               const For_each_hints& hints,
+               const Parallel_tag& tag,
                std::random_access_iterator_tag)
 {
   std::size_t range_size = std::distance (range.begin(), range.end());
 
-  tbb::parallel_for (tbb::blocked_range<std::size_t>(0, range_size),
-                     [&](const tbb::blocked_range<std::size_t>& r)
+  for_each_subrange (range_size,
+                     [&](std::size_t begin, std::size_t end)
                      {
-                       for (std::size_t i = r.begin(); i != r.end(); ++ i)
+                       for (std::size_t i = begin; i != end; ++ i)
                          if (!functor (*(range.begin() + i)))
                            break;
-                     });
+                     },
+                     hints, tag);
 }
-#endif
+#endif // CGAL_HAS_PARALLEL_FOR_EACH
 
 } // namespace internal
 
 template <typename ConcurrencyTag, typename Range>
 void for_each (const Range& range,
                const std::function<bool(typename std::iterator_traits
-                                        <typename Range::const_iterator>::reference)>& functor)
+                                        <typename Range::const_iterator>::reference)>& functor,
+               const For_each_hints& hints = For_each_hints())
 {
-#ifndef CGAL_LINKED_WITH_TBB
+#ifndef CGAL_HAS_PARALLEL_FOR_EACH
   static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
-                 "Parallel_tag is enabled but TBB is unavailable.");
+                 "Parallel_tag is enabled but no parallel backend (TBB, OpenMP) is available.");
 #endif
 
   internal::for_each<const Range&>
-    (range, functor,
+    (range, functor, hints,
      ConcurrencyTag(),
      typename std::iterator_traits<typename Range::const_iterator>::iterator_category());
 }
@@ -115,15 +267,16 @@ void for_each (const Range& range,
 template <typename ConcurrencyTag, typename Range>
 void for_each (Range& range,
                const std::function<bool(typename std::iterator_traits
-                                        <typename Range::iterator>::reference)>& functor)
+                                        <typename Range::iterator>::reference)>& functor,
+               const For_each_hints& hints = For_each_hints())
 {
-#ifndef CGAL_LINKED_WITH_TBB
+#ifndef CGAL_HAS_PARALLEL_FOR_EACH
   static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
-                 "Parallel_tag is enabled but TBB is unavailable.");
+                 "Parallel_tag is enabled but no parallel backend (TBB, OpenMP) is available.");
 #endif
 
   internal::for_each<Range&>
-    (range, functor,
+    (range, functor, hints,
      ConcurrencyTag(),
      typename std::iterator_traits<typename Range::iterator>::iterator_category());
 }
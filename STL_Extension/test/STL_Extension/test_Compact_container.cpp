@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <iterator>
 #include <list>
 #include <vector>
 #include <type_traits>
@@ -278,6 +279,96 @@ void test_index(const Cont &C)
   }
 }
 
+template < class Cont >
+void test_exact_reserve()
+{
+  // reserve() allocates exactly the missing capacity,
+  // and the indices remain valid whatever the sizes of the blocks
+  Cont c1;
+  c1.reserve(1000);
+  assert(c1.capacity() == 1000);
+  c1.reserve(10);
+  assert(c1.capacity() == 1000);
+  for (int i = 0 ; i < 1500 ; ++i)
+    c1.emplace();
+  c1.reserve(5000);
+  assert(c1.capacity() == 5000);
+  for (int i = 0 ; i < 5000 ; ++i)
+    c1.emplace();
+
+  Cont c2;
+  for (int i = 0 ; i < 777 ; ++i)
+    c2.emplace();
+  c1.merge(c2);
+
+  typename Cont::iterator it = c1.begin();
+  typename Cont::size_type nb = 0;
+  for (typename Cont::size_type i = 0 ; i < c1.capacity() ; ++i)
+  {
+    if ( !c1.is_used(i) )
+      continue;
+    assert( &c1[i] == &*it );
+    assert( c1.index(it) == i );
+    ++it; ++nb;
+  }
+  assert( it == c1.end() );
+  assert( nb == c1.size() );
+
+  // a copy is allocated in a single block
+  Cont c3(c1);
+  assert( c3.capacity() == c1.size() );
+  assert( c3 == c1 );
+}
+
+struct Split {};
+
+template < class Range, class OutputIterator >
+void split_and_visit(Range& r, OutputIterator out)
+{
+  if (r.is_divisible()) {
+    Range r2(r, Split());
+    split_and_visit(r, out);
+    split_and_visit(r2, out);
+    return;
+  }
+  for (typename Range::iterator it = r.begin() ; it != r.end() ; ++it)
+    *out++ = &*it;
+}
+
+template < class Cont >
+void test_splittable_range()
+{
+  typedef typename Cont::value_type T;
+  Cont c1;
+  assert( c1.splittable_range().empty() );
+  std::vector<typename Cont::iterator> its;
+  for (int i = 0 ; i < 5000 ; ++i)
+    its.push_back(c1.emplace());
+  // erase every third element and a long run of elements
+  for (int i = 0 ; i < 5000 ; ++i)
+    if (i % 3 == 0 || (1000 <= i && i < 3000))
+      c1.erase(its[i]);
+
+  for (std::size_t grainsize : { 1, 100, 10000 })
+  {
+    std::vector<T*> visited;
+    typename Cont::Splittable_range r = c1.splittable_range(grainsize);
+    split_and_visit(r, std::back_inserter(visited));
+    assert( visited.size() == c1.size() );
+    std::size_t i = 0;
+    for (typename Cont::iterator it = c1.begin() ; it != c1.end() ; ++it, ++i)
+      assert( visited[i] == &*it );
+  }
+
+  // the iterators of the range convert to handles
+  const Cont& cc1 = c1;
+  typename Cont::const_iterator first = cc1.splittable_range().begin();  CGAL_USE(first);
+  assert( first == cc1.begin() );
+
+  c1.clear();
+  assert( c1.splittable_range().begin() == c1.splittable_range().end() );
+}
+
 template < class Cont >
 void test_time_stamps() {
   Cont c1;
@@ -352,6 +443,10 @@ int main()
 
   test_index(C5);
   test_index(C6);
+  test_exact_reserve<C3>();
+  test_exact_reserve<CGAL::Compact_container<Node_2, CGAL::Default, CGAL::Constant_size_policy<1024> > >();
+  test_splittable_range<C3>();
+  test_splittable_range<CGAL::Compact_container<Node_2, CGAL::Default, CGAL::Constant_size_policy<1024> > >();
   return 0;
 }
 // EOF //
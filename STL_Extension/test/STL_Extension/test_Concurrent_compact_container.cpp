@@ -17,6 +17,7 @@ int main()
 #include <cassert>
 #include <cstddef>
 #include <list>
+#include <type_traits>
 #include <vector>
 #include <CGAL/Compact_container.h>
 #include <CGAL/Concurrent_compact_container.h>
@@ -348,6 +349,23 @@ void test(const Cont &)
   );
   assert(c11.size() == v11.size());
 
+  std::cout << "Testing parallel iteration" << std::endl;
+  std::atomic<std::size_t> num_visited(0);
+  tbb::parallel_for(
+    c11.splittable_range(1000),
+    [&](const typename Cont::Splittable_range& r)
+    {
+      std::size_t n = 0;
+      for(typename Cont::Splittable_range::iterator it = r.begin(); it != r.end(); ++it)
+      {
+        typename Cont::iterator h = it;  CGAL_USE(h);
+        assert(&*h == &*it);
+        ++n;
+      }
+      num_visited += n;
+    });
+  assert(num_visited == c11.size());
+
   std::cout << "Testing parallel erasure" << std::endl;
   tbb::parallel_for(
     tbb::blocked_range<size_t>( 0, v11.size() ),
@@ -377,6 +395,52 @@ void test(const Cont &)
   );
   assert(c12.size() == v12.size() - num_erasures);
   }
+
+  std::cout << "Testing parallel insertion after sequential erasure" << std::endl;
+  {
+  Cont c13;
+  Vect v13(100000);
+  std::vector<typename Cont::iterator> iterators(v13.size());
+  for(std::size_t i = 0; i < v13.size(); ++i)
+    iterators[i] = c13.insert(v13[i]);
+  const typename Cont::size_type capacity = c13.capacity();  CGAL_USE(capacity);
+  // all the free elements are owned by this thread...
+  for(std::size_t i = 0; i < v13.size(); ++i)
+    c13.erase(iterators[i]);
+  assert(c13.empty());
+  // ...but they are given back to the other threads
+  tbb::parallel_for(
+    tbb::blocked_range<size_t>( 0, v13.size() ),
+    Insert_in_CCC_functor<Vect, Cont>(v13, c13, iterators)
+  );
+  assert(c13.size() == v13.size());
+  assert(c13.capacity() < 2 * capacity);
+  c13.erase(c13.begin(), c13.end());
+  assert(check_empty(c13));
+  }
+
+  std::cout << "Testing moved-from containers" << std::endl;
+  {
+  static_assert(std::is_nothrow_move_constructible<Cont>::value);
+  Cont c14;
+  Vect v14(10000);
+  std::vector<typename Cont::iterator> iterators(v14.size());
+  for(std::size_t i = 0; i < v14.size(); ++i)
+    iterators[i] = c14.insert(v14[i]);
+  for(std::size_t i = 0; i < v14.size(); i += 2)
+    c14.erase(iterators[i]);
+  Cont c15(std::move(c14));
+  assert(c15.size() == v14.size() / 2);
+  // the moved-from container can still be used
+  assert(c14.empty());
+  for(std::size_t i = 0; i < v14.size(); ++i)
+    iterators[i] = c14.insert(v14[i]);
+  for(std::size_t i = 0; i < v14.size(); ++i)
+    c14.erase(iterators[i]);
+  assert(check_empty(c14));
+  c15.erase(c15.begin(), c15.end());
+  assert(check_empty(c15));
+  }
 }
 
 
@@ -1,8 +1,18 @@
 #include <CGAL/for_each.h>
+#include <CGAL/Compact_container.h>
+#include <CGAL/use.h>
 
+#include <cassert>
 #include <vector>
 #include <list>
 
+struct Node
+  : public CGAL::Compact_container_base
+{
+  Node(int i = 0) : i(i) {}
+  int i;
+};
+
 int main()
 {
   std::vector<int> vec { 0, 1, 2, 3, 4, 5 };
@@ -16,7 +26,7 @@ int main()
     std::cerr << i << " ";
   std::cerr << std::endl;
 
-#ifdef CGAL_LINKED_WITH_TBB
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
   std::cerr << "Testing parallel random access" << std::endl;
   CGAL::for_each<CGAL::Parallel_tag>
     (vec, [](int& i) -> bool { i *= 2; return true; });
@@ -24,6 +34,21 @@ int main()
   for (const int& i : vec)
     std::cerr << i << " ";
   std::cerr << std::endl;
+
+  std::cerr << "Testing parallel random access with hints" << std::endl;
+  std::vector<int> large (100000, 1);
+  CGAL::For_each_affinity affinity;
+  CGAL::For_each_hints hints;
+  hints.grainsize = 1000;
+  hints.affinity = &affinity;
+  for (int k = 0; k < 3; ++ k)
+    CGAL::for_each<CGAL::Parallel_tag>
+      (large, [](int& i) -> bool { i *= 2; return true; }, hints);
+  for (const int& i : large)
+  {
+    assert (i == 8);
+    CGAL_USE(i);
+  }
 #endif
 
   std::cerr << "Testing sequential non-random access" << std::endl;
@@ -34,7 +59,7 @@ int main()
     std::cerr << i << " ";
   std::cerr << std::endl;
 
-#ifdef CGAL_LINKED_WITH_TBB
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
   std::cerr << "Testing parallel non-random access" << std::endl;
   CGAL::for_each<CGAL::Parallel_tag>
     (list, [](int& i) -> bool { i *= 2; return true; });
@@ -44,5 +69,35 @@ int main()
   std::cerr << std::endl;
 #endif
 
+  CGAL::Compact_container<Node> cc;
+  std::vector<CGAL::Compact_container<Node>::iterator> nodes;
+  for (int i = 0; i < 10000; ++ i)
+    nodes.push_back (cc.emplace(i));
+  for (int i = 0; i < 10000; i += 2)
+    cc.erase (nodes[i]);
+
+  std::cerr << "Testing sequential compact container" << std::endl;
+  CGAL::for_each<CGAL::Sequential_tag>
+    (cc, [](Node& n) -> bool { n.i *= 2; return true; });
+
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
+  std::cerr << "Testing parallel compact container" << std::endl;
+  CGAL::for_each<CGAL::Parallel_tag>
+    (cc, [](Node& n) -> bool { n.i *= 2; return true; }, CGAL::For_each_hints{100});
+#endif
+
+  int expected = 1;
+  for (const Node& n : cc)
+  {
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
+    assert (n.i == 4 * expected);
+#else
+    assert (n.i == 2 * expected);
+#endif
+    CGAL_USE(n);
+    expected += 2;
+  }
+  assert (expected == 10001);
+
   return 0;
 }
@@ -29,7 +29,11 @@
 
 #include <CGAL/Eigen_matrix.h>
 #include <CGAL/Eigen_vector.h>
+#include <algorithm>
 #include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace CGAL {
 namespace internal {
@@ -60,6 +64,16 @@ struct Get_eigen_matrix< ::Eigen::SparseLU<EigenMatrix, EigenOrdering >, FT>
   typedef Eigen_sparse_matrix<FT>             type;
 };
 #endif
+
+// whether the solver splits `compute()` into `analyzePattern()` and `factorize()`
+template <class EigenSolver, class EigenMatrix, class = void>
+struct Has_symbolic_factorization : std::false_type { };
+
+template <class EigenSolver, class EigenMatrix>
+struct Has_symbolic_factorization<EigenSolver, EigenMatrix,
+  std::void_t<decltype(std::declval<EigenSolver&>().analyzePattern(std::declval<const EigenMatrix&>())),
+              decltype(std::declval<EigenSolver&>().factorize(std::declval<const EigenMatrix&>()))> >
+  : std::true_type { };
 } //internal
 
 /*!
@@ -126,15 +140,23 @@ public:
   // Public operations
 public:
   /// Constructor
-  Eigen_solver_traits() : m_mat(nullptr), m_solver_sptr(new EigenSolverT) { }
+  Eigen_solver_traits()
+    : m_mat(nullptr), m_solver_sptr(new EigenSolverT), m_pattern_sptr(new Sparsity_pattern)
+  { }
 
   /// \name Operations
   /// @{
 
   /// Returns a reference to the internal \ref thirdpartyEigen "Eigen" solver.
   /// This function can be used for example to set specific parameters of the solver.
+  /// If the solver is directly given another matrix, `reset_symbolic_factorization()`
+  /// must be called before the next call to `factor()`.
   EigenSolverT& solver() { return *m_solver_sptr; }
 
+  /// Forgets the sparsity pattern of the last factorized matrix, so that the next factorization
+  /// recomputes the symbolic analysis of the solver.
+  void reset_symbolic_factorization() { m_pattern_sptr->clear(); }
+
   /// @}
 
   /// Solve the sparse linear system \f$ A \times X = B \f$.
@@ -146,9 +168,7 @@ public:
   {
     D = 1; // Eigen does not support homogeneous coordinates
 
-    m_solver_sptr->compute(A.eigen_object());
-
-    if(m_solver_sptr->info() != Eigen::Success)
+    if(!compute(A.eigen_object()))
       return false;
 
     X = m_solver_sptr->solve(B);
@@ -160,14 +180,15 @@ public:
   /// This factorization is used in `linear_solver()`
   /// to solve the system for different right-hand side vectors.
   /// See `linear_solver()` for the description of \f$ D \f$.
+  /// If \f$ A \f$ has the same sparsity pattern as the matrix of the previous successful
+  /// factorization, the symbolic analysis is reused and only the numerical factorization is computed.
   /// \return `true` if the factorization is successful and `false` otherwise.
   bool factor(const Matrix& A, NT& D)
   {
     D = 1;
 
     m_mat = &A.eigen_object();
-    solver().compute(*m_mat);
-    return solver().info() == Eigen::Success;
+    return compute(*m_mat);
   }
 
   /// Solve the sparse linear system \f$ A \times X = B\f$, with \f$ A \f$ being the matrix
@@ -199,6 +220,7 @@ public:
   {
     typename Matrix::EigenType At = A.eigen_object().transpose();
     m_mat = &A.eigen_object();
+    m_pattern_sptr->clear();
     solver().compute(At * A.eigen_object());
     return solver().info() == Eigen::Success;
   }
@@ -224,9 +246,64 @@ public:
     return normal_equation_solver(B, X);
   }
 
+protected:
+  typedef typename Matrix::EigenType::StorageIndex                    Storage_index;
+
+  // the nonzero structure of the last matrix that was successfully analyzed by the solver
+  struct Sparsity_pattern
+  {
+    Index rows = -1, cols = -1;
+    std::vector<Storage_index> outer, inner;
+
+    template <class EigenMatrix>
+    bool is_equal(const EigenMatrix& M) const
+    {
+      return M.isCompressed() && rows == M.rows() && cols == M.cols() &&
+             Index(inner.size()) == M.nonZeros() &&
+             std::equal(outer.begin(), outer.end(), M.outerIndexPtr()) &&
+             std::equal(inner.begin(), inner.end(), M.innerIndexPtr());
+    }
+
+    template <class EigenMatrix>
+    void assign(const EigenMatrix& M)
+    {
+      rows = M.rows();
+      cols = M.cols();
+      outer.assign(M.outerIndexPtr(), M.outerIndexPtr() + M.outerSize() + 1);
+      inner.assign(M.innerIndexPtr(), M.innerIndexPtr() + M.nonZeros());
+    }
+
+    void clear() { rows = cols = -1; outer.clear(); inner.clear(); }
+  };
+
+  // Eigen solvers split `compute()` into a symbolic `analyzePattern()` (e.g. the fill-reducing
+  // ordering of direct solvers) and a numerical `factorize()`: the former only depends on
+  // the nonzero structure, and is skipped when that structure has not changed.
+  template <class EigenMatrix>
+  bool compute(const EigenMatrix& M)
+  {
+    if constexpr(!internal::Has_symbolic_factorization<EigenSolverT, EigenMatrix>::value)
+      solver().compute(M);
+    else if(m_pattern_sptr->is_equal(M))
+    {
+      solver().factorize(M);
+    }
+    else
+    {
+      m_pattern_sptr->clear();
+      solver().analyzePattern(M);
+      solver().factorize(M);
+      if(solver().info() == Eigen::Success && M.isCompressed())
+        m_pattern_sptr->assign(M);
+    }
+
+    return solver().info() == Eigen::Success;
+  }
+
 protected:
   const typename Matrix::EigenType* m_mat;
   std::shared_ptr<EigenSolverT> m_solver_sptr;
+  std::shared_ptr<Sparsity_pattern> m_pattern_sptr;
 };
 
 // Specialization of the solver for BiCGSTAB as for surface parameterization,
@@ -12,9 +12,11 @@ as parameter to `hilbert_sort()` to choose the sorting policy.
 \cgalModels{DefaultConstructible,CopyConstructible}
 
 \sa `Middle`
+\sa `Radix`
 \sa `Hilbert_policy`
 \sa `Hilbert_sort_median_policy`
 \sa `Hilbert_sort_middle_policy`
+\sa `Hilbert_sort_radix_policy`
 */
 struct Median { };
 
@@ -29,28 +31,57 @@ as parameter to `hilbert_sort()` to choose the sorting policy.
 \cgalModels{DefaultConstructible,CopyConstructible}
 
 \sa `Median`
+\sa `Radix`
 \sa `Hilbert_policy`
 \sa `Hilbert_sort_median_policy`
 \sa `Hilbert_sort_middle_policy`
+\sa `Hilbert_sort_radix_policy`
 */
 struct Middle { };
 
 /*!
 \ingroup PkgSpatialSortingUtils
 
+`Radix` is a tag class. It can be used to parameterize a strategy policy
+in order to specify the strategy for spatial sorting.
+`Hilbert_policy<Radix>` can be passed to
+as parameter to `hilbert_sort()` to choose the sorting policy.
+
+With this policy, the points are quantized on a regular grid of the bounding box of the input
+(with \f$ 2^{32} \f$ cells per axis in 2D and \f$ 2^{21} \f$ cells per axis in 3D), and sorted
+by a radix sort of their Hilbert indices in this grid.
+The resulting order is the one of the middle policy, up to the resolution of the grid.
+This policy is available in 2D and 3D; in higher dimensions, the middle policy is used instead.
+
+\cgalModels{DefaultConstructible,CopyConstructible}
+
+\sa `Median`
+\sa `Middle`
+\sa `Hilbert_policy`
+\sa `Hilbert_sort_median_policy`
+\sa `Hilbert_sort_middle_policy`
+\sa `Hilbert_sort_radix_policy`
+*/
+struct Radix { };
+
+/*!
+\ingroup PkgSpatialSortingUtils
+
 `Hilbert_policy` is a policy class which can be used to parameterize a strategy policy
 in order to specify the strategy for spatial sorting.
-`Hilbert_policy<Median>` or `Hilbert_policy<Middle>`
+`Hilbert_policy<Median>`, `Hilbert_policy<Middle>`, or `Hilbert_policy<Radix>`
 can be passed  as parameter to `hilbert_sort()` to choose the sorting policy.
 
-\tparam Tag must be either `Median` or `Middle`.
+\tparam Tag must be `Median`, `Middle`, or `Radix`.
 
 \cgalModels{DefaultConstructible,CopyConstructible}
 
 \sa `Median`
 \sa `Middle`
+\sa `Radix`
 \sa `Hilbert_sort_median_policy`
 \sa `Hilbert_sort_middle_policy`
+\sa `Hilbert_sort_radix_policy`
 */
 template< typename Tag >
 struct Hilbert_policy { };
@@ -69,4 +100,11 @@ A typedef to `Hilbert_policy<Middle>`.
 */
 typedef Hilbert_policy<Middle>  Hilbert_sort_middle_policy;
 
+/*!
+\ingroup PkgSpatialSortingUtils
+
+A typedef to `Hilbert_policy<Radix>`.
+*/
+typedef Hilbert_policy<Radix>  Hilbert_sort_radix_policy;
+
 } /* end namespace CGAL */
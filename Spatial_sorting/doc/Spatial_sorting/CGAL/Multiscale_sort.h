@@ -11,8 +11,14 @@ Given a range of `n` points:
 stopping when there are fewer than `threshold` points.
 </OL>
 
+\tparam ConcurrencyTag enables sequential versus parallel sorting:
+with `Parallel_tag`, the recursion on the first points and the sort of the last points
+are performed concurrently.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+The default is `Sequential_tag`.
+
 */
-template< typename Sort >
+template< typename Sort, typename ConcurrencyTag = Sequential_tag >
 class Multiscale_sort {
 public:
 
@@ -0,0 +1,86 @@
+namespace CGAL {
+
+/*!
+\ingroup PkgSpatialSortingUtils
+
+The class `Spatial_sort_permutation_cache` stores the permutations computed by
+`spatial_sort_permutation()` for several point ranges, so that algorithms working
+on the same points can share a single spatial sort.
+
+Each range is identified by a user-given identifier and a version number.
+The user is responsible for increasing the version of a range when its points are modified;
+a permutation is also recomputed when the size of the range changes.
+Only the permutation of the most recent version of each range is stored.
+The permutations are returned as shared pointers and stay valid after they have been replaced
+in the cache.
+
+The member functions of this class can be called concurrently.
+
+\tparam PolicyTag is the strategy policy passed to `spatial_sort_permutation()`.
+The default is `Hilbert_sort_median_policy`.
+
+\sa `spatial_sort_permutation()`
+\sa `apply_spatial_sort_permutation()`
+*/
+template <typename PolicyTag = Hilbert_sort_median_policy>
+class Spatial_sort_permutation_cache {
+public:
+
+/// \name Types
+/// @{
+
+/*!
+the type of a permutation.
+*/
+typedef std::vector<std::size_t> Permutation;
+
+/*!
+a shared pointer to a stored permutation.
+*/
+typedef std::shared_ptr<const Permutation> Permutation_ptr;
+
+/// @}
+
+/// \name Operations
+/// @{
+
+/*!
+returns the stored permutation of the range `range_id`, or a null pointer
+if there is none for the version `version`.
+*/
+Permutation_ptr find(std::size_t range_id, std::size_t version) const;
+
+/*!
+returns the permutation of the range `range_id` in its version `version`,
+whose points are in `[begin, end)`.
+The permutation is computed with `spatial_sort_permutation<ConcurrencyTag>(begin, end, traits, PolicyTag())`
+and stored if the cache does not contain it, unless the cache stores a more recent version of the range.
+
+\tparam ConcurrencyTag enables sequential versus parallel sorting.
+\tparam InputPointIterator and `Traits` are as in `spatial_sort_permutation()`.
+*/
+template <class ConcurrencyTag = Sequential_tag, class InputPointIterator, class Traits>
+Permutation_ptr permutation(std::size_t range_id, std::size_t version,
+                            InputPointIterator begin, InputPointIterator end,
+                            const Traits& traits = Default_traits);
+
+/*!
+removes the permutation of the range `range_id`.
+*/
+void invalidate(std::size_t range_id);
+
+/*!
+removes all permutations.
+*/
+void clear();
+
+/*!
+returns the number of stored permutations.
+*/
+std::size_t size() const;
+
+/// @}
+
+}; /* end Spatial_sort_permutation_cache */
+
+} /* end namespace CGAL */
@@ -12,9 +12,8 @@ It sorts the range `[begin, end)` in place.
 
 \tparam ConcurrencyTag enables sequential versus parallel algorithm.
 Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
-With parallelism enabled, sorting will be performed using up to four threads in 2D,
-and up to eight threads in 3D.
-Parallel sorting is available only when the median strategy policy (the default policy) is used.
+With parallelism enabled, the recursive subdivisions (or the computation and the radix sort
+of the Hilbert indices with the radix policy) are performed concurrently, for all strategy policies.
 
 \tparam InputPointIterator must be a model of `RandomAccessIterator` and
 `std::iterator_traits<InputPointIterator>::%value_type` must be convertible to
@@ -27,7 +26,9 @@ The default traits class `Default_traits` is the kernel in which the type
 
 \tparam PolicyTag is used to specify the strategy policy.
 Possible values are \link CGAL::Hilbert_sort_median_policy `Hilbert_sort_median_policy` \endlink
-(the default policy) or \link CGAL::Hilbert_sort_middle_policy `Hilbert_sort_middle_policy` \endlink.
+(the default policy), \link CGAL::Hilbert_sort_middle_policy `Hilbert_sort_middle_policy` \endlink,
+or \link CGAL::Hilbert_sort_radix_policy `Hilbert_sort_radix_policy` \endlink
+(the latter falls back to the middle policy in dimension greater than 3).
 
 The default values for the thresholds and the ratio depend on the dimension.
 
@@ -0,0 +1,70 @@
+namespace CGAL {
+
+/*!
+\ingroup PkgSpatialSortingFunctions
+
+The function `spatial_sort_permutation()` computes the order in which `spatial_sort()`
+would put the points of the range `[begin, end)`, without moving them.
+
+It returns a vector `permutation` such that `begin[permutation[0]]`, `begin[permutation[1]]`, ...
+is the sequence of points sorted by `spatial_sort()` with the same parameters.
+The permutation can be computed once and then applied to the points and to any range
+of values associated with them, using `apply_spatial_sort_permutation()`.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+The permutation does not depend on this parameter.
+
+\tparam InputPointIterator must be a model of `RandomAccessIterator` and
+`std::iterator_traits<InputPointIterator>::%value_type` must be convertible to
+`Traits::Point_2`, `Traits::Point_3`, or `Traits::Point_d`.
+
+\tparam Traits must be a model for concept `SpatialSortingTraits_2`,
+`SpatialSortingTraits_3`, or `SpatialSortingTraits_d`.
+The default traits class `Default_traits` is the kernel in which the type
+`std::iterator_traits<InputPointIterator>::%value_type` is defined.
+
+\tparam PolicyTag is used to specify the strategy policy, as in `spatial_sort()`.
+
+The parameters `threshold_hilbert`, `threshold_multiscale`, and `ratio` are the ones of `spatial_sort()`.
+
+\cgalHeading{Implementation}
+
+Sorts the indices of the points with `spatial_sort()` and `Spatial_sort_traits_adapter_2`,
+`Spatial_sort_traits_adapter_3`, or `Spatial_sort_traits_adapter_d`.
+
+\sa `Spatial_sort_permutation_cache`
+*/
+template <class ConcurrencyTag = Sequential_tag, class InputPointIterator, class Traits, class PolicyTag>
+std::vector<std::size_t>
+spatial_sort_permutation( InputPointIterator begin,
+                          InputPointIterator end,
+                          const Traits& traits = Default_traits,
+                          PolicyTag policy = Default_policy,
+                          std::ptrdiff_t threshold_hilbert=default,
+                          std::ptrdiff_t threshold_multiscale=default,
+                          double ratio=default);
+
+/*!
+\ingroup PkgSpatialSortingFunctions
+
+The function `apply_spatial_sort_permutation()` reorders in place the range starting at `begin`,
+of size `permutation.size()`, so that its `i`-th element becomes the `permutation[i]`-th element
+of the original range.
+
+This can be used for example on the iterator range of a property map of `Surface_mesh`
+or on the range of indices of `Point_set_3`.
+
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
+\tparam RandomAccessIterator must be a model of `RandomAccessIterator`
+whose value type is `CopyConstructible` and `MoveAssignable`.
+
+\sa `spatial_sort_permutation()`
+*/
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator>
+void apply_spatial_sort_permutation(const std::vector<std::size_t>& permutation,
+                                    RandomAccessIterator begin);
+
+} /* namespace CGAL */
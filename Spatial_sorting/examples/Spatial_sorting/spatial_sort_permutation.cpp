@@ -0,0 +1,40 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/spatial_sort_permutation.h>
+#include <CGAL/Spatial_sort_permutation_cache.h>
+
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3                                          Point_3;
+
+int main()
+{
+  std::vector<Point_3> points;
+  std::vector<int> ids;
+  CGAL::Random_points_in_cube_3<Point_3> gen(1.0);
+  for (int i = 0; i < 1000; ++i) {
+    points.push_back(*gen++);
+    ids.push_back(i);
+  }
+
+  // the cache is shared by the algorithms working on the same points;
+  // the range is identified by 0 and its points have not been modified (version 0)
+  CGAL::Spatial_sort_permutation_cache<> cache;
+  CGAL::Spatial_sort_permutation_cache<>::Permutation_ptr permutation =
+    cache.permutation(0, 0, points.begin(), points.end());
+
+  // a second request does not sort the points again
+  std::cout << "Same permutation: " << std::boolalpha
+            << (cache.permutation(0, 0, points.begin(), points.end()) == permutation) << std::endl;
+
+  // reorder the points and their associated values
+  CGAL::apply_spatial_sort_permutation(*permutation, points.begin());
+  CGAL::apply_spatial_sort_permutation(*permutation, ids.begin());
+
+  for (int i = 0; i < 5; ++i)
+    std::cout << ids[i] << ": " << points[i] << std::endl;
+
+  return 0;
+}
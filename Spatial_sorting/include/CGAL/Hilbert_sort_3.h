@@ -15,6 +15,7 @@
 #include <CGAL/Hilbert_policy_tags.h>
 #include <CGAL/Hilbert_sort_median_3.h>
 #include <CGAL/Hilbert_sort_middle_3.h>
+#include <CGAL/Hilbert_sort_radix_3.h>
 
 namespace CGAL {
 
@@ -33,11 +34,21 @@ public:
 
 template <class K, class ConcurrencyTag >
 class Hilbert_sort_3<K, Hilbert_sort_middle_policy, ConcurrencyTag >
-  : public Hilbert_sort_middle_3<K>
+  : public Hilbert_sort_middle_3<K, ConcurrencyTag>
 {
 public:
   Hilbert_sort_3 (const K &k=K(), std::ptrdiff_t limit=1 )
-    : Hilbert_sort_middle_3<K> (k,limit)
+    : Hilbert_sort_middle_3<K, ConcurrencyTag> (k,limit)
+  {}
+};
+
+template <class K, class ConcurrencyTag>
+class Hilbert_sort_3<K, Hilbert_sort_radix_policy, ConcurrencyTag >
+  : public Hilbert_sort_radix_3<K, ConcurrencyTag>
+{
+public:
+  Hilbert_sort_3 (const K &k=K(), std::ptrdiff_t limit=1 )
+    : Hilbert_sort_radix_3<K, ConcurrencyTag> (k,limit)
   {}
 };
 
@@ -18,26 +18,37 @@
 
 namespace CGAL {
 
-template <class K,  class Hilbert_policy >
+template <class K,  class Hilbert_policy, class ConcurrencyTag = Sequential_tag >
 class Hilbert_sort_d;
 
-template <class K>
-class Hilbert_sort_d<K, Hilbert_sort_median_policy >
-    : public Hilbert_sort_median_d<K>
+template <class K, class ConcurrencyTag>
+class Hilbert_sort_d<K, Hilbert_sort_median_policy, ConcurrencyTag >
+    : public Hilbert_sort_median_d<K, ConcurrencyTag>
 {
 public:
   Hilbert_sort_d (const K &k=K() , std::ptrdiff_t limit=1 )
-    : Hilbert_sort_median_d<K> (k,limit)
+    : Hilbert_sort_median_d<K, ConcurrencyTag> (k,limit)
   {}
 };
 
-template <class K>
-class Hilbert_sort_d<K, Hilbert_sort_middle_policy >
-    : public Hilbert_sort_middle_d<K>
+template <class K, class ConcurrencyTag>
+class Hilbert_sort_d<K, Hilbert_sort_middle_policy, ConcurrencyTag >
+    : public Hilbert_sort_middle_d<K, ConcurrencyTag>
 {
 public:
   Hilbert_sort_d (const K &k=K() , std::ptrdiff_t limit=1 )
-    : Hilbert_sort_middle_d<K> (k,limit)
+    : Hilbert_sort_middle_d<K, ConcurrencyTag> (k,limit)
+  {}
+};
+
+// Hilbert keys are only implemented in 2D and 3D, the middle policy gives the same curve
+template <class K, class ConcurrencyTag>
+class Hilbert_sort_d<K, Hilbert_sort_radix_policy, ConcurrencyTag >
+    : public Hilbert_sort_middle_d<K, ConcurrencyTag>
+{
+public:
+  Hilbert_sort_d (const K &k=K() , std::ptrdiff_t limit=1 )
+    : Hilbert_sort_middle_d<K, ConcurrencyTag> (k,limit)
   {}
 };
 
@@ -126,7 +126,7 @@ public:
 
     void operator()() const
     {
-      hs.recursive_sort<x,upx,upy>(begin,end);
+      hs.template sort<x,upx,upy>(begin,end,Parallel_tag());
     }
   };
 
@@ -176,7 +176,7 @@ public:
                            Recursive_sort<x, upx, upy, RandomAccessIterator> (*this, m2, m3),
                            Recursive_sort<y,!upy,!upx, RandomAccessIterator> (*this, m3, m4));
     } else {
-      recursive_sort<0, false, false>(begin, end);
+      recursive_sort<x, upx, upy>(begin, end);
     }
 #endif
   }
@@ -184,7 +184,7 @@ public:
   template <int x, bool upx, bool upy, class RandomAccessIterator>
   void sort (RandomAccessIterator begin, RandomAccessIterator end, Sequential_tag) const
   {
-    recursive_sort<0, false, false>(begin, end);
+    recursive_sort<x, upx, upy>(begin, end);
   }
 
   template <class RandomAccessIterator>
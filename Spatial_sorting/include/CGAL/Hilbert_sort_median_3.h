@@ -149,7 +149,7 @@ public:
 
     void operator()() const
     {
-      hs.recursive_sort<x,upx,upy,upz>(begin,end);
+      hs.template sort<x,upx,upy,upz>(begin,end,Parallel_tag());
     }
   };
 
@@ -206,7 +206,7 @@ public:
                            Recursive_sort<y, !upy,  upz, !upx, RandomAccessIterator>(*this, m6, m7),
                            Recursive_sort<z, !upz, !upx,  upy, RandomAccessIterator>(*this, m7, m8));
     } else {
-      recursive_sort<0, false, false, false>(begin, end);
+      recursive_sort<x, upx, upy, upz>(begin, end);
     }
 #endif
   }
@@ -214,7 +214,7 @@ public:
   template <int x, bool upx, bool upy, bool upz, class RandomAccessIterator>
   void sort (RandomAccessIterator begin, RandomAccessIterator end, Sequential_tag) const
   {
-    recursive_sort<0, false, false, false>(begin, end);
+    recursive_sort<x, upx, upy, upz>(begin, end);
   }
 
   template <class RandomAccessIterator>
@@ -13,11 +13,14 @@
 #define CGAL_HILBERT_SORT_MEDIAN_d_H
 
 #include <CGAL/config.h>
+#include <CGAL/tags.h>
 #include <functional>
 #include <cstddef>
 #include <iterator>
+#include <type_traits>
 #include <vector>
 #include <CGAL/Hilbert_sort_base.h>
+#include <CGAL/Spatial_sorting/internal/Hilbert_sort_tasks.h>
 
 namespace CGAL {
 
@@ -43,7 +46,7 @@ struct Hilbert_cmp_d
 
 } // namespace internal
 
-template <class K>
+template <class K, class ConcurrencyTag = Sequential_tag>
 class Hilbert_sort_median_d
 {
 public:
@@ -75,6 +78,11 @@ public:
     if (end - begin <= _limit)
       return;
 
+    // splits of a same level and recursive calls work on disjoint ranges:
+    // they run concurrently on large ranges with `Parallel_tag`
+    internal::Hilbert_sort_tasks tasks (std::is_convertible<ConcurrencyTag, Parallel_tag>::value
+                                        && (end - begin) > 2048);
+
     int nb_directions = _dimension;
     int nb_splits     = two_to_dim;
 
@@ -103,13 +111,16 @@ public:
       bool orient = start[current_dir];
       do{
         dir[middle]    = current_dir;
-        places[middle] = internal::hilbert_split
-                         (places[left], places[right], Cmp (current_dir,orient,_k));
+        tasks.run([&places, left, middle, right, current_dir, orient, this] {
+          places[middle] = internal::hilbert_split
+                           (places[left], places[right], Cmp (current_dir,orient,_k));
+        });
         left =right;
         right+=current_level_step;
         middle+=current_level_step;
         orient = ! orient;
       }while( left< nb_splits);
+      tasks.wait();
       current_level_step = half_step;
       current_dir = (current_dir +1) % _dimension;
     }while (current_dir != last_dir);
@@ -118,23 +129,34 @@ public:
 
     /////////////start recursive calls
     last_dir = (direction + _dimension -1) % _dimension;
+    // `start` is modified between the calls, each call keeps its own copy
+    auto recursive_sort = [&tasks, this] (RandomAccessIterator b, RandomAccessIterator e,
+                                          const Starting_position& s, int d) {
+      tasks.run([this, b, e, s, d] { sort(b, e, s, d); });
+    };
+
     // first step is special
-    sort( places[0], places[1], start, last_dir);
+    recursive_sort( places[0], places[1], start, last_dir);
 
     for(int i=1; i<two_to_dim-1; i +=2){
-      sort( places[i  ], places[i+1], start, dir[i+1]);
-      sort( places[i+1], places[i+2], start, dir[i+1]);
+      recursive_sort( places[i  ], places[i+1], start, dir[i+1]);
+      recursive_sort( places[i+1], places[i+2], start, dir[i+1]);
       start[dir[i+1]] = !  start[dir[i+1]];
       start[last_dir] = !  start[last_dir];
     }
 
     //last step is special
-    sort( places[two_to_dim-1], places[two_to_dim], start, last_dir);
+    recursive_sort( places[two_to_dim-1], places[two_to_dim], start, last_dir);
+    tasks.wait();
   }
 
   template <class RandomAccessIterator>
   void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
   {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
     _dimension = _k.point_dimension_d_object()(*begin);
     two_to_dim = 1;
     Starting_position start(_dimension);
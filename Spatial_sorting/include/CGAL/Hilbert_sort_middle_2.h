@@ -13,11 +13,18 @@
 #define CGAL_HILBERT_SORT_MIDDLE_2_H
 
 #include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/use.h>
 #include <functional>
 #include <cstddef>
+#include <type_traits>
 #include <CGAL/Hilbert_sort_middle_base.h>
 #include <CGAL/number_utils.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_invoke.h>
+#endif
+
 namespace CGAL {
 
 namespace internal {
@@ -70,7 +77,7 @@ struct Fixed_hilbert_cmp_2<K,1,false>
 
 } // namespace internal
 
-template <class K>
+template <class K, class ConcurrencyTag = Sequential_tag>
 class Hilbert_sort_middle_2
 {
 public:
@@ -119,6 +126,54 @@ public:
       sort<y,!upy,!upx> (m3, m4, ymed, xmax, ymin, xmed);
   }
 
+  template <int x, bool upx, bool upy, class RandomAccessIterator>
+  void sort (RandomAccessIterator begin, RandomAccessIterator end,
+             double xmin, double ymin, double xmax, double ymax, Parallel_tag) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    CGAL_USE(begin);
+    CGAL_USE(end);
+    CGAL_USE(xmin);
+    CGAL_USE(ymin);
+    CGAL_USE(xmax);
+    CGAL_USE(ymax);
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    const int y = (x + 1) % 2;
+    if (end - begin <= 8192) { // 2^13, same cutoff as Hilbert_sort_median_2
+      sort<x, upx, upy> (begin, end, xmin, ymin, xmax, ymax);
+      return;
+    }
+
+    double xmed= (xmin+xmax)/2;
+    double ymed= (ymin+ymax)/2;
+
+    RandomAccessIterator m0 = begin, m4 = end, m1, m3;
+
+    RandomAccessIterator m2 = internal::fixed_hilbert_split (m0, m4, Cmp< x,  upx> (xmed,_k));
+    tbb::parallel_invoke([&] { m1 = internal::fixed_hilbert_split (m0, m2, Cmp< y,  upy> (ymed,_k)); },
+                         [&] { m3 = internal::fixed_hilbert_split (m2, m4, Cmp< y, !upy> (ymed,_k)); });
+
+    tbb::parallel_invoke(
+      [&] { if (m1!=m4)
+              sort<y, upy, upx> (m0, m1, ymin, xmin, ymed, xmed, Parallel_tag()); },
+      [&] { if (m1!=m0 || m2!=m4)
+              sort<x, upx, upy> (m1, m2, xmin, ymed, xmed, ymax, Parallel_tag()); },
+      [&] { if (m2!=m0 || m3!=m4)
+              sort<x, upx, upy> (m2, m3, xmed, ymed, xmax, ymax, Parallel_tag()); },
+      [&] { if (m3!=m0)
+              sort<y,!upy,!upx> (m3, m4, ymed, xmax, ymin, xmed, Parallel_tag()); });
+#endif
+  }
+
+  template <int x, bool upx, bool upy, class RandomAccessIterator>
+  void sort (RandomAccessIterator begin, RandomAccessIterator end,
+             double xmin, double ymin, double xmax, double ymax, Sequential_tag) const
+  {
+    sort<x, upx, upy> (begin, end, xmin, ymin, xmax, ymax);
+  }
+
   template <class RandomAccessIterator>
   void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
   {
@@ -139,7 +194,7 @@ public:
         ymax = to_double(_k.compute_y_2_object()(*it));
     }
 
-    sort <0, false, false> (begin, end, xmin, ymin, xmax, ymax);
+    sort <0, false, false> (begin, end, xmin, ymin, xmax, ymax, ConcurrencyTag());
   }
 };
 
@@ -13,10 +13,17 @@
 #define CGAL_HILBERT_SORT_MIDDLE_3_H
 
 #include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/use.h>
 #include <functional>
 #include <cstddef>
+#include <type_traits>
 #include <CGAL/Hilbert_sort_middle_base.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_invoke.h>
+#endif
+
 namespace CGAL {
 
 namespace internal {
@@ -83,7 +90,7 @@ namespace internal {
     };
 }
 
-template <class K>
+template <class K, class ConcurrencyTag = Sequential_tag>
 class Hilbert_sort_middle_3
 {
 public:
@@ -151,6 +158,70 @@ public:
           sort<z,!upz,!upx, upy> (m7, m8, zmed, xmax, ymin, zmin, xmed, ymed);
     }
 
+    template <int x, bool upx, bool upy, bool upz, class RandomAccessIterator>
+      void sort (RandomAccessIterator begin, RandomAccessIterator end,
+                 double xmin, double ymin, double zmin,
+                 double xmax, double ymax, double zmax, Parallel_tag) const
+    {
+#ifndef CGAL_LINKED_WITH_TBB
+        CGAL_USE(begin);
+        CGAL_USE(end);
+        CGAL_USE(xmin); CGAL_USE(ymin); CGAL_USE(zmin);
+        CGAL_USE(xmax); CGAL_USE(ymax); CGAL_USE(zmax);
+        static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                       "Parallel_tag is enabled but TBB is unavailable.");
+#else
+        const int y = (x + 1) % 3, z = (x + 2) % 3;
+        if (end - begin <= 2048) { // 2^11, same cutoff as Hilbert_sort_median_3
+          sort<x, upx, upy, upz> (begin, end, xmin, ymin, zmin, xmax, ymax, zmax);
+          return;
+        }
+
+        double xmed= (xmin+xmax)/2;
+        double ymed= (ymin+ymax)/2;
+        double zmed= (zmin+zmax)/2;
+
+        RandomAccessIterator m0 = begin, m8 = end, m1, m2, m3, m5, m6, m7;
+
+        RandomAccessIterator m4 =
+          internal::fixed_hilbert_split (m0, m8, Cmp< x,  upx> (xmed,_k));
+        tbb::parallel_invoke(
+          [&] { m2 = internal::fixed_hilbert_split (m0, m4, Cmp< y,  upy> (ymed,_k)); },
+          [&] { m6 = internal::fixed_hilbert_split (m4, m8, Cmp< y, !upy> (ymed,_k)); });
+        tbb::parallel_invoke(
+          [&] { m1 = internal::fixed_hilbert_split (m0, m2, Cmp< z,  upz> (zmed,_k)); },
+          [&] { m3 = internal::fixed_hilbert_split (m2, m4, Cmp< z, !upz> (zmed,_k)); },
+          [&] { m5 = internal::fixed_hilbert_split (m4, m6, Cmp< z,  upz> (zmed,_k)); },
+          [&] { m7 = internal::fixed_hilbert_split (m6, m8, Cmp< z, !upz> (zmed,_k)); });
+
+        tbb::parallel_invoke(
+          [&] { if (m1!=m8)
+                  sort<z, upz, upx, upy> (m0, m1, zmin, xmin, ymin, zmed, xmed, ymed, Parallel_tag()); },
+          [&] { if (m1!=m0 || m2!=m8)
+                  sort<y, upy, upz, upx> (m1, m2, ymin, zmed, xmin, ymed, zmax, xmed, Parallel_tag()); },
+          [&] { if (m2!=m0 || m3!=m8)
+                  sort<y, upy, upz, upx> (m2, m3, ymed, zmed, xmin, ymax, zmax, xmed, Parallel_tag()); },
+          [&] { if (m3!=m0 || m4!=m8)
+                  sort<x, upx,!upy,!upz> (m3, m4, xmin, ymax, zmed, xmed, ymed, zmin, Parallel_tag()); },
+          [&] { if (m4!=m0 || m5!=m8)
+                  sort<x, upx,!upy,!upz> (m4, m5, xmed, ymax, zmed, xmax, ymed, zmin, Parallel_tag()); },
+          [&] { if (m5!=m0 || m6!=m8)
+                  sort<y,!upy, upz,!upx> (m5, m6, ymax, zmed, xmax, ymed, zmax, xmed, Parallel_tag()); },
+          [&] { if (m6!=m0 || m7!=m8)
+                  sort<y,!upy, upz,!upx> (m6, m7, ymed, zmed, xmax, ymin, zmax, xmed, Parallel_tag()); },
+          [&] { if (m7!=m0)
+                  sort<z,!upz,!upx, upy> (m7, m8, zmed, xmax, ymin, zmin, xmed, ymed, Parallel_tag()); });
+#endif
+    }
+
+    template <int x, bool upx, bool upy, bool upz, class RandomAccessIterator>
+      void sort (RandomAccessIterator begin, RandomAccessIterator end,
+                 double xmin, double ymin, double zmin,
+                 double xmax, double ymax, double zmax, Sequential_tag) const
+    {
+        sort<x, upx, upy, upz> (begin, end, xmin, ymin, zmin, xmax, ymax, zmax);
+    }
+
     template <class RandomAccessIterator>
     void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
     {
@@ -175,7 +246,7 @@ public:
           zmax = to_double(_k.compute_z_3_object()(*it));
       }
 
-      sort <0, false, false, false> (begin, end, xmin,ymin,zmin,xmax,ymax,zmax);
+      sort <0, false, false, false> (begin, end, xmin,ymin,zmin,xmax,ymax,zmax, ConcurrencyTag());
     }
 };
 
@@ -13,10 +13,13 @@
 #define CGAL_HILBERT_SORT_MIDDLE_d_H
 
 #include <CGAL/config.h>
+#include <CGAL/tags.h>
 #include <functional>
 #include <cstddef>
+#include <type_traits>
 #include <vector>
 #include <CGAL/Hilbert_sort_middle_base.h>
+#include <CGAL/Spatial_sorting/internal/Hilbert_sort_tasks.h>
 
 namespace CGAL {
 
@@ -44,7 +47,7 @@ namespace internal {
 
 }
 
-template <class K>
+template <class K, class ConcurrencyTag = Sequential_tag>
 class Hilbert_sort_middle_d
 {
 public:
@@ -75,6 +78,11 @@ public:
    {
      if (end - begin <= _limit) return;
 
+     // splits of a same level and recursive calls work on disjoint ranges:
+     // they run concurrently on large ranges with `Parallel_tag`
+     internal::Hilbert_sort_tasks tasks (std::is_convertible<ConcurrencyTag, Parallel_tag>::value
+                                         && (end - begin) > 2048);
+
      Corner med(_dimension);
      for( int i=0; i<_dimension; ++i) med[i]=(mini[i]+maxi[i])/2;
      Corner cmin=mini,cmax=med;
@@ -95,23 +103,33 @@ public:
        bool orient = start[current_dir];
        do{
          dir[middle]    = current_dir;
-         places[middle] = internal::fixed_hilbert_split
-                             (places[left], places[right],
-                              Cmp (current_dir,orient,med[current_dir],_k));
+         tasks.run([&places, &med, left, middle, right, current_dir, orient, this] {
+           places[middle] = internal::fixed_hilbert_split
+                               (places[left], places[right],
+                                Cmp (current_dir,orient,med[current_dir],_k));
+         });
          left =right;
          right+=current_level_step;
          middle+=current_level_step;
          orient = ! orient;
        }while( left< two_to_dim);
+       tasks.wait();
        current_level_step = half_step;
        current_dir = (current_dir +1) % _dimension;
      }while (current_dir != last_dir);
 
      /////////////start recursive calls
      last_dir = (direction + _dimension -1) % _dimension;
+     // `start`, `cmin` and `cmax` are modified between the calls, each call keeps its own copy
+     auto recursive_sort = [&tasks, this] (RandomAccessIterator b, RandomAccessIterator e,
+                                           const Starting_position& s, int d,
+                                           const Corner& lo, const Corner& hi) {
+       tasks.run([this, b, e, s, d, lo, hi] { sort(b, e, s, d, lo, hi); });
+     };
+
      // first step is special
      if (places[1]!=end)
-       sort( places[0], places[1], start, last_dir,cmin,cmax);
+       recursive_sort( places[0], places[1], start, last_dir,cmin,cmax);
      cmin[last_dir] = med[last_dir];
      cmax[last_dir] = maxi[last_dir];
 
@@ -119,13 +137,13 @@ public:
      for(int i=1; i<two_to_dim-1; i +=2){
        //std::cout<<i<<";"<<start[0]<<start[1]<<start[2]<<start[3]<<"/"<<dir[i+1]<<std::endl;
        if (places[i]!=begin || places[i+1]!=end)
-         sort( places[i  ], places[i+1], start, dir[i+1],cmin,cmax);
+         recursive_sort( places[i  ], places[i+1], start, dir[i+1],cmin,cmax);
        cmax[ dir[i+1] ] =  (cmin[ dir[i+1]]==mini[ dir[i+1]])
                             ? maxi[ dir[i+1] ] : mini[ dir[i+1] ];
        cmin[ dir[i+1] ] =  med[ dir[i+1] ];
 
        if (places[i+1]!=begin || places[i+2]!=end)
-         sort( places[i+1], places[i+2], start, dir[i+1],cmin,cmax);
+         recursive_sort( places[i+1], places[i+2], start, dir[i+1],cmin,cmax);
        cmin[ dir[i+1] ] =  cmax[ dir[i+1] ];
        cmax[ dir[i+1] ] =  med[ dir[i+1] ];
        cmax[ last_dir ] = (cmax[last_dir]==maxi[last_dir])
@@ -136,13 +154,18 @@ public:
 
      //last step is special
      if (places[two_to_dim-1]!=begin)
-       sort( places[two_to_dim-1], places[two_to_dim], start, last_dir,cmin,cmax);
+       recursive_sort( places[two_to_dim-1], places[two_to_dim], start, last_dir,cmin,cmax);
+     tasks.wait();
     }
 
 
     template <class RandomAccessIterator>
     void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
     {
+#ifndef CGAL_LINKED_WITH_TBB
+      static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                     "Parallel_tag is enabled but TBB is unavailable.");
+#endif
       _dimension = _k.point_dimension_d_object()(*begin);
       two_to_dim = 1;
       Starting_position start(_dimension);
@@ -0,0 +1,146 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_HILBERT_SORT_RADIX_2_H
+#define CGAL_HILBERT_SORT_RADIX_2_H
+
+#include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/number_utils.h>
+#include <CGAL/Hilbert_sort_radix_base.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CGAL {
+
+// Sorts the points along the same Hilbert curve as `Hilbert_sort_middle_2`, but instead of
+// partitioning the range recursively, the coordinates are quantized on a grid of `2^32 x 2^32`
+// cells subdividing the bounding box of the points, the Hilbert index of the cell of each point
+// is computed, and the indices are radix-sorted.
+// Points lying in the same cell keep an arbitrary order.
+template <class K, class ConcurrencyTag = Sequential_tag>
+class Hilbert_sort_radix_2
+{
+public:
+  typedef K Kernel;
+  typedef typename Kernel::Point_2 Point;
+
+  static constexpr int nb_bits = 32; // per coordinate
+
+private:
+  Kernel _k;
+  std::ptrdiff_t _limit;
+
+public:
+  Hilbert_sort_radix_2 (const Kernel &k, std::ptrdiff_t limit = 1)
+    : _k(k), _limit (limit)
+  {}
+
+  // Hilbert index of the cell `(qx, qy)`. At each level, the state of the curve is given,
+  // as in `Hilbert_sort_middle_2::sort()`, by the first axis that is split and by the halves
+  // (`up`) that come first along each axis: the transitions are tabulated by `hilbert_table()`.
+  static std::uint64_t hilbert_key (std::uint64_t qx, std::uint64_t qy)
+  {
+    const Hilbert_table& table = hilbert_table();
+    unsigned int state = 0;
+    std::uint64_t key = 0;
+    for (int level = nb_bits - 1; level >= 0; --level) {
+      const unsigned int quadrant = unsigned((qx >> level) & 1)
+                                  | unsigned((qy >> level) & 1) << 1;
+      const unsigned char t = table[state * 4 + quadrant];
+      key = (key << 2) | std::uint64_t(t & 3);
+      state = t >> 2;
+    }
+    return key;
+  }
+
+private:
+  // `table[4 * state + quadrant]` is `4 * next_state + rank`, where `rank` is the position along
+  // the curve of the child `quadrant` (one bit per axis) and `next_state` the state of this child;
+  // `state` is `4 * x + up[0] + 2 * up[1]`.
+  typedef std::array<unsigned char, 8 * 4> Hilbert_table;
+
+  static const Hilbert_table& hilbert_table ()
+  {
+    static const Hilbert_table table = [] {
+      Hilbert_table t;
+      for (int x = 0; x < 2; ++x) {
+        for (int ups = 0; ups < 4; ++ups) {
+          for (int quadrant = 0; quadrant < 4; ++quadrant) {
+            const int y = 1 - x;
+            bool up[2] = { bool(ups & 1), bool(ups & 2) };
+            const bool c[2] = { bool(quadrant & 1), bool(quadrant & 2) };
+            const int sx = (c[x] == up[x]) ? 0 : 1;
+            const int sy = (c[y] == (up[y] != bool(sx))) ? 0 : 1;
+            const int j = 2 * sx + sy;
+
+            // same recursive calls as `Hilbert_sort_middle_2::sort()`
+            int next_x = x;
+            if (j == 0) {
+              next_x = y;
+            } else if (j == 3) {
+              up[0] = !up[0];
+              up[1] = !up[1];
+              next_x = y;
+            }
+
+            const int next_state = 4 * next_x + int(up[0]) + 2 * int(up[1]);
+            t[(4 * x + ups) * 4 + quadrant] = static_cast<unsigned char>(4 * next_state + j);
+          }
+        }
+      }
+      return t;
+    }();
+    return table;
+  }
+
+public:
+  template <class RandomAccessIterator>
+  void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
+  {
+    if (end - begin <= _limit) return;
+
+    const std::size_t size = end - begin;
+    double xmin=to_double(_k.compute_x_2_object()(*begin)),
+           ymin=to_double(_k.compute_y_2_object()(*begin)),
+           xmax=xmin,
+           ymax=ymin;
+    for(RandomAccessIterator it=begin+1; it<end; ++it){
+      const double x = to_double(_k.compute_x_2_object()(*it));
+      const double y = to_double(_k.compute_y_2_object()(*it));
+      if (x < xmin) xmin = x;
+      if (y < ymin) ymin = y;
+      if (x > xmax) xmax = x;
+      if (y > ymax) ymax = y;
+    }
+
+    const double cells = double(std::uint64_t(1) << nb_bits);
+    const double xscale = (xmax > xmin) ? cells / (xmax - xmin) : 0.;
+    const double yscale = (ymax > ymin) ? cells / (ymax - ymin) : 0.;
+
+    std::vector<std::uint64_t> keys(size);
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, size),
+                                   [&](std::size_t i) -> bool {
+      const auto& p = *(begin + i);
+      keys[i] = hilbert_key(
+          internal::hilbert_quantize(to_double(_k.compute_x_2_object()(p)), xmin, xscale, nb_bits),
+          internal::hilbert_quantize(to_double(_k.compute_y_2_object()(p)), ymin, yscale, nb_bits));
+      return true;
+    });
+
+    internal::sort_by_hilbert_keys<ConcurrencyTag>(begin, end, keys);
+  }
+};
+
+} // namespace CGAL
+
+#endif//CGAL_HILBERT_SORT_RADIX_2_H
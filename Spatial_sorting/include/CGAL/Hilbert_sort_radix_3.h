@@ -0,0 +1,155 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_HILBERT_SORT_RADIX_3_H
+#define CGAL_HILBERT_SORT_RADIX_3_H
+
+#include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/number_utils.h>
+#include <CGAL/Hilbert_sort_radix_base.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CGAL {
+
+// Sorts the points along the same Hilbert curve as `Hilbert_sort_middle_3`, but instead of
+// partitioning the range recursively, the coordinates are quantized on a grid of `2^21 x 2^21 x 2^21`
+// cells subdividing the bounding box of the points, the Hilbert index of the cell of each point
+// is computed, and the indices are radix-sorted.
+// Points lying in the same cell keep an arbitrary order.
+template <class K, class ConcurrencyTag = Sequential_tag>
+class Hilbert_sort_radix_3
+{
+public:
+  typedef K Kernel;
+  typedef typename Kernel::Point_3 Point;
+
+  static constexpr int nb_bits = 21; // per coordinate
+
+private:
+  Kernel _k;
+  std::ptrdiff_t _limit;
+
+public:
+  Hilbert_sort_radix_3 (const Kernel &k, std::ptrdiff_t limit = 1)
+    : _k(k), _limit (limit)
+  {}
+
+  // Hilbert index of the cell `(qx, qy, qz)`. At each level, the state of the curve is given,
+  // as in `Hilbert_sort_middle_3::sort()`, by the first axis that is split and by the halves
+  // (`up`) that come first along each axis: the transitions are tabulated by `hilbert_table()`.
+  static std::uint64_t hilbert_key (std::uint64_t qx, std::uint64_t qy, std::uint64_t qz)
+  {
+    const Hilbert_table& table = hilbert_table();
+    unsigned int state = 0;
+    std::uint64_t key = 0;
+    for (int level = nb_bits - 1; level >= 0; --level) {
+      const unsigned int octant = unsigned((qx >> level) & 1)
+                                | unsigned((qy >> level) & 1) << 1
+                                | unsigned((qz >> level) & 1) << 2;
+      const unsigned char t = table[state * 8 + octant];
+      key = (key << 3) | std::uint64_t(t & 7);
+      state = t >> 3;
+    }
+    return key;
+  }
+
+private:
+  // `table[8 * state + octant]` is `8 * next_state + rank`, where `rank` is the position along
+  // the curve of the child `octant` (one bit per axis) and `next_state` the state of this child;
+  // `state` is `8 * x + up[0] + 2 * up[1] + 4 * up[2]`.
+  typedef std::array<unsigned char, 24 * 8> Hilbert_table;
+
+  static const Hilbert_table& hilbert_table ()
+  {
+    static const Hilbert_table table = [] {
+      Hilbert_table t;
+      for (int x = 0; x < 3; ++x) {
+        for (int ups = 0; ups < 8; ++ups) {
+          for (int octant = 0; octant < 8; ++octant) {
+            const int y = (x + 1) % 3, z = (x + 2) % 3;
+            bool up[3] = { bool(ups & 1), bool(ups & 2), bool(ups & 4) };
+            const bool c[3] = { bool(octant & 1), bool(octant & 2), bool(octant & 4) };
+            const int sx = (c[x] == up[x]) ? 0 : 1;
+            const int sy = (c[y] == (up[y] != bool(sx))) ? 0 : 1;
+            const int sz = (c[z] == (up[z] != bool(sy))) ? 0 : 1;
+            const int j = 4 * sx + 2 * sy + sz;
+
+            // same recursive calls as `Hilbert_sort_middle_3::sort()`
+            int next_x = x;
+            switch (j) {
+            case 0: next_x = z; break;
+            case 1: case 2: next_x = y; break;
+            case 3: case 4: up[y] = !up[y]; up[z] = !up[z]; break;
+            case 5: case 6: up[x] = !up[x]; up[y] = !up[y]; next_x = y; break;
+            default: up[x] = !up[x]; up[z] = !up[z]; next_x = z; break;
+            }
+
+            const int next_state = 8 * next_x + int(up[0]) + 2 * int(up[1]) + 4 * int(up[2]);
+            t[(8 * x + ups) * 8 + octant] = static_cast<unsigned char>(8 * next_state + j);
+          }
+        }
+      }
+      return t;
+    }();
+    return table;
+  }
+
+public:
+  template <class RandomAccessIterator>
+  void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
+  {
+    if (end - begin <= _limit) return;
+
+    const std::size_t size = end - begin;
+    double xmin=to_double(_k.compute_x_3_object()(*begin)),
+           ymin=to_double(_k.compute_y_3_object()(*begin)),
+           zmin=to_double(_k.compute_z_3_object()(*begin)),
+           xmax=xmin,
+           ymax=ymin,
+           zmax=zmin;
+    for(RandomAccessIterator it=begin+1; it<end; ++it){
+      const double x = to_double(_k.compute_x_3_object()(*it));
+      const double y = to_double(_k.compute_y_3_object()(*it));
+      const double z = to_double(_k.compute_z_3_object()(*it));
+      if (x < xmin) xmin = x;
+      if (y < ymin) ymin = y;
+      if (z < zmin) zmin = z;
+      if (x > xmax) xmax = x;
+      if (y > ymax) ymax = y;
+      if (z > zmax) zmax = z;
+    }
+
+    const double cells = double(std::uint64_t(1) << nb_bits);
+    const double xscale = (xmax > xmin) ? cells / (xmax - xmin) : 0.;
+    const double yscale = (ymax > ymin) ? cells / (ymax - ymin) : 0.;
+    const double zscale = (zmax > zmin) ? cells / (zmax - zmin) : 0.;
+
+    std::vector<std::uint64_t> keys(size);
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, size),
+                                   [&](std::size_t i) -> bool {
+      const auto& p = *(begin + i);
+      keys[i] = hilbert_key(
+          internal::hilbert_quantize(to_double(_k.compute_x_3_object()(p)), xmin, xscale, nb_bits),
+          internal::hilbert_quantize(to_double(_k.compute_y_3_object()(p)), ymin, yscale, nb_bits),
+          internal::hilbert_quantize(to_double(_k.compute_z_3_object()(p)), zmin, zscale, nb_bits));
+      return true;
+    });
+
+    internal::sort_by_hilbert_keys<ConcurrencyTag>(begin, end, keys);
+  }
+};
+
+} // namespace CGAL
+
+#endif//CGAL_HILBERT_SORT_RADIX_3_H
@@ -0,0 +1,133 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_HILBERT_SORT_RADIX_BASE_H
+#define CGAL_HILBERT_SORT_RADIX_BASE_H
+
+#include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+namespace internal {
+
+// Quantizes the coordinate `c` of the interval `[mini, mini + extent]` on `nb_bits` bits.
+// `scale` is `2^nb_bits / extent`, or 0 for an empty interval.
+inline std::uint64_t hilbert_quantize (double c, double mini, double scale, int nb_bits)
+{
+  const double q = (c - mini) * scale;
+  const std::uint64_t max_q = (std::uint64_t(1) << nb_bits) - 1;
+  if (!(q > 0)) return 0;
+  if (q >= double(max_q)) return max_q;
+  return std::uint64_t(q);
+}
+
+// Sorts the indices `order` of the points by increasing Hilbert keys,
+// with a stable least significant digit radix sort on 11-bit digits.
+// Digits that are the same for all keys are skipped.
+template <class ConcurrencyTag>
+void radix_sort_hilbert_keys (std::vector<std::uint64_t>& keys,
+                              std::vector<std::size_t>& order)
+{
+  constexpr int digit_bits = 11;
+  constexpr std::size_t nb_digits = std::size_t(1) << digit_bits;
+
+  const std::size_t size = keys.size();
+  std::size_t nb_blocks = 1;
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    nb_blocks = (std::max)(std::size_t(1), (std::min)(std::size_t(256), size / (std::size_t(1) << 14)));
+  const std::size_t block_size = (size + nb_blocks - 1) / nb_blocks;
+
+  std::vector<std::uint64_t> other_keys(size);
+  std::vector<std::size_t> other_order(size);
+  std::vector<std::size_t> offsets(nb_blocks * nb_digits);
+
+  auto for_each_block = [&](const auto& f) {
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, nb_blocks),
+                                   [&](std::size_t b) -> bool { f(b); return true; });
+  };
+
+  for (int shift = 0; shift < 64; shift += digit_bits) {
+
+    // histogram of the digits of each block
+    std::fill(offsets.begin(), offsets.end(), 0);
+    for_each_block([&](std::size_t b) {
+      std::size_t* histogram = offsets.data() + b * nb_digits;
+      for (std::size_t i = b * block_size; i < (std::min)(size, (b + 1) * block_size); ++i)
+        ++histogram[(keys[i] >> shift) & (nb_digits - 1)];
+    });
+
+    // exclusive prefix sum, digit-major so that the sort is stable
+    std::size_t sum = 0;
+    bool single_digit = false;
+    for (std::size_t d = 0; d < nb_digits; ++d) {
+      std::size_t digit_count = 0;
+      for (std::size_t b = 0; b < nb_blocks; ++b) {
+        std::size_t count = offsets[b * nb_digits + d];
+        offsets[b * nb_digits + d] = sum;
+        sum += count;
+        digit_count += count;
+      }
+      if (digit_count == size)
+        single_digit = true;
+    }
+    if (single_digit)
+      continue;
+
+    for_each_block([&](std::size_t b) {
+      std::size_t* offset = offsets.data() + b * nb_digits;
+      for (std::size_t i = b * block_size; i < (std::min)(size, (b + 1) * block_size); ++i) {
+        std::size_t target = offset[(keys[i] >> shift) & (nb_digits - 1)]++;
+        other_keys[target] = keys[i];
+        other_order[target] = order[i];
+      }
+    });
+
+    keys.swap(other_keys);
+    order.swap(other_order);
+  }
+}
+
+// Sorts `[begin, end)` by increasing keys, `keys[i]` being the key of `begin[i]`.
+template <class ConcurrencyTag, class RandomAccessIterator>
+void sort_by_hilbert_keys (RandomAccessIterator begin, RandomAccessIterator end,
+                           std::vector<std::uint64_t>& keys)
+{
+  typedef typename std::iterator_traits<RandomAccessIterator>::value_type Value;
+
+  const std::size_t size = keys.size();
+  std::vector<std::size_t> order(size);
+  for (std::size_t i = 0; i < size; ++i)
+    order[i] = i;
+
+  radix_sort_hilbert_keys<ConcurrencyTag>(keys, order);
+
+  std::vector<Value> values(begin, end);
+  CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, size),
+                                 [&](std::size_t i) -> bool {
+                                   *(begin + i) = std::move(values[order[i]]);
+                                   return true;
+                                 });
+}
+
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_HILBERT_SORT_RADIX_BASE_H
@@ -0,0 +1,135 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_SPATIAL_SORT_PERMUTATION_CACHE_H
+#define CGAL_SPATIAL_SORT_PERMUTATION_CACHE_H
+
+#include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/spatial_sort_permutation.h>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+template <class PolicyTag = Hilbert_sort_median_policy>
+class Spatial_sort_permutation_cache
+{
+public:
+  typedef std::vector<std::size_t>          Permutation;
+  typedef std::shared_ptr<const Permutation> Permutation_ptr;
+
+private:
+  struct Entry
+  {
+    std::size_t version;
+    Permutation_ptr permutation;
+  };
+
+  std::unordered_map<std::size_t, Entry> entries_;
+  mutable std::mutex mutex_;
+
+public:
+  Spatial_sort_permutation_cache() {}
+
+  // the mutex is not copyable, only the entries are copied
+  Spatial_sort_permutation_cache(const Spatial_sort_permutation_cache& other)
+  {
+    std::lock_guard<std::mutex> lock(other.mutex_);
+    entries_ = other.entries_;
+  }
+
+  Spatial_sort_permutation_cache& operator=(const Spatial_sort_permutation_cache& other)
+  {
+    if (this != &other) {
+      std::unordered_map<std::size_t, Entry> entries;
+      {
+        std::lock_guard<std::mutex> lock(other.mutex_);
+        entries = other.entries_;
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      entries_.swap(entries);
+    }
+    return *this;
+  }
+
+  Permutation_ptr find(std::size_t range_id, std::size_t version) const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(range_id);
+    if (it == entries_.end() || it->second.version != version)
+      return Permutation_ptr();
+    return it->second.permutation;
+  }
+
+  template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator, class Kernel>
+  Permutation_ptr permutation(std::size_t range_id, std::size_t version,
+                              RandomAccessIterator begin, RandomAccessIterator end,
+                              const Kernel& k)
+  {
+    const std::size_t size = std::distance(begin, end);
+    Permutation_ptr result = find(range_id, version);
+    if (result != nullptr && result->size() == size)
+      return result;
+
+    // the sort is done without holding the lock: concurrent requests for other ranges
+    // are not blocked, and concurrent requests for the same range compute the same order
+    result = std::make_shared<const Permutation>(
+               spatial_sort_permutation<ConcurrencyTag>(begin, end, k, PolicyTag()));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry& entry = entries_[range_id];
+    // a caller with an older version than the stored one gets its order without evicting the newer one
+    if (entry.permutation != nullptr && entry.version > version)
+      return result;
+    if (entry.permutation == nullptr || entry.version < version || entry.permutation->size() != size) {
+      entry.version = version;
+      entry.permutation = result;
+    }
+    return entry.permutation;
+  }
+
+  template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator>
+  Permutation_ptr permutation(std::size_t range_id, std::size_t version,
+                              RandomAccessIterator begin, RandomAccessIterator end)
+  {
+    typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+    typedef typename Kernel_traits<value_type>::Kernel                       Kernel;
+
+    return permutation<ConcurrencyTag>(range_id, version, begin, end, Kernel());
+  }
+
+  void invalidate(std::size_t range_id)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.erase(range_id);
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+  }
+
+  std::size_t size() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+};
+
+} // namespace CGAL
+
+#endif // CGAL_SPATIAL_SORT_PERMUTATION_CACHE_H
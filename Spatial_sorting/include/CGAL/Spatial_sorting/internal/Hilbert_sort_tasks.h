@@ -0,0 +1,68 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_SPATIAL_SORTING_INTERNAL_HILBERT_SORT_TASKS_H
+#define CGAL_SPATIAL_SORTING_INTERNAL_HILBERT_SORT_TASKS_H
+
+#include <CGAL/config.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/task_group.h>
+#endif
+
+namespace CGAL {
+
+namespace internal {
+
+// Runs the independent steps of a Hilbert sort (splits of a same level, recursive calls
+// on disjoint ranges) either right away, or as TBB tasks if `parallel` is true.
+// The steps must not overlap, so the result does not depend on the order in which they run.
+class Hilbert_sort_tasks
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  tbb::task_group _tasks;
+#endif
+  bool _parallel;
+
+public:
+  explicit Hilbert_sort_tasks (bool parallel)
+    : _parallel (parallel)
+  {}
+
+  ~Hilbert_sort_tasks ()
+  {
+    wait();
+  }
+
+  template <class F>
+  void run (const F& f)
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    if (_parallel) {
+      _tasks.run(f);
+      return;
+    }
+#endif
+    f();
+  }
+
+  void wait ()
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    if (_parallel)
+      _tasks.wait();
+#endif
+  }
+};
+
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_SPATIAL_SORTING_INTERNAL_HILBERT_SORT_TASKS_H
@@ -49,7 +49,7 @@ void spatial_sort (RandomAccessIterator begin, RandomAccessIterator end,
   if (threshold_multiscale==0) threshold_multiscale=16;
   if (ratio==0.0) ratio=0.25;
 
-  (Multiscale_sort<Sort> (Sort (k, threshold_hilbert), threshold_multiscale, ratio)) (begin, end);
+  (Multiscale_sort<Sort, ConcurrencyTag> (Sort (k, threshold_hilbert), threshold_multiscale, ratio)) (begin, end);
 }
 
 template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator, class Policy, class Kernel>
@@ -72,7 +72,7 @@ void spatial_sort (RandomAccessIterator begin, RandomAccessIterator end,
   if (threshold_multiscale==0) threshold_multiscale=64;
   if (ratio==0.0) ratio=0.125;
 
-  (Multiscale_sort<Sort> (Sort (k, threshold_hilbert), threshold_multiscale, ratio)) (begin, end);
+  (Multiscale_sort<Sort, ConcurrencyTag> (Sort (k, threshold_hilbert), threshold_multiscale, ratio)) (begin, end);
 }
 
 template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator, class Policy, class Kernel>
@@ -86,7 +86,7 @@ void spatial_sort (RandomAccessIterator begin, RandomAccessIterator end,
 {
   typedef std::iterator_traits<RandomAccessIterator> Iterator_traits;
   typedef typename Iterator_traits::difference_type Diff_t;
-  typedef Hilbert_sort_d<Kernel, Policy> Sort;
+  typedef Hilbert_sort_d<Kernel, Policy, ConcurrencyTag> Sort;
   boost::rand48 random;
   boost::random_number_generator<boost::rand48, Diff_t> rng(random);
   CGAL::cpp98::random_shuffle(begin,end, rng);
@@ -95,6 +95,8 @@ void spatial_sort (RandomAccessIterator begin, RandomAccessIterator end,
   if (threshold_multiscale==0) threshold_multiscale=500;
   if (ratio==0.0) ratio=0.05;
 
+  // the levels are sorted one after the other: `Hilbert_sort_d` stores the dimension
+  // of the range being sorted and cannot sort two ranges concurrently
   (Multiscale_sort<Sort> (Sort (k, threshold_hilbert), threshold_multiscale, ratio)) (begin, end);
 }
 
@@ -147,6 +149,22 @@ void spatial_sort (RandomAccessIterator begin, RandomAccessIterator end,
                                 threshold_hilbert,threshold_multiscale,ratio);
 }
 
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator>
+void spatial_sort (RandomAccessIterator begin, RandomAccessIterator end,
+                   Hilbert_sort_radix_policy policy,
+                   std::ptrdiff_t threshold_hilbert=0,
+                   std::ptrdiff_t threshold_multiscale=0,
+                   double ratio=0.0)
+{
+  typedef std::iterator_traits<RandomAccessIterator> ITraits;
+  typedef typename ITraits::value_type               value_type;
+  typedef CGAL::Kernel_traits<value_type>            KTraits;
+  typedef typename KTraits::Kernel                   Kernel;
+
+  spatial_sort<ConcurrencyTag> (begin, end, Kernel(), policy,
+                                threshold_hilbert,threshold_multiscale,ratio);
+}
+
 
 template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator, class Kernel>
 void spatial_sort (RandomAccessIterator begin, RandomAccessIterator end,
@@ -0,0 +1,163 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_SPATIAL_SORT_PERMUTATION_H
+#define CGAL_SPATIAL_SORT_PERMUTATION_H
+
+#include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/spatial_sort.h>
+#include <CGAL/Spatial_sort_traits_adapter_2.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/Spatial_sort_traits_adapter_d.h>
+
+#include <boost/property_map/property_map.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+namespace internal {
+
+template <class RandomAccessIterator>
+struct Spatial_sort_permutation_point_map
+{
+  typedef boost::iterator_property_map<RandomAccessIterator,
+                                       boost::typed_identity_property_map<std::size_t> > type;
+
+  static type make(RandomAccessIterator begin) { return type(begin); }
+};
+
+template <class ConcurrencyTag, class RandomAccessIterator, class Policy, class Kernel>
+void spatial_sort_permutation (RandomAccessIterator begin,
+                               std::vector<std::size_t>& permutation,
+                               const Kernel& k, Policy policy,
+                               typename Kernel::Point_2 *,
+                               std::ptrdiff_t threshold_hilbert,
+                               std::ptrdiff_t threshold_multiscale,
+                               double ratio)
+{
+  typedef Spatial_sort_permutation_point_map<RandomAccessIterator> Point_map;
+  typedef Spatial_sort_traits_adapter_2<Kernel, typename Point_map::type> Traits;
+
+  CGAL::spatial_sort<ConcurrencyTag>(permutation.begin(), permutation.end(),
+                                     Traits(Point_map::make(begin), k), policy,
+                                     threshold_hilbert, threshold_multiscale, ratio);
+}
+
+template <class ConcurrencyTag, class RandomAccessIterator, class Policy, class Kernel>
+void spatial_sort_permutation (RandomAccessIterator begin,
+                               std::vector<std::size_t>& permutation,
+                               const Kernel& k, Policy policy,
+                               typename Kernel::Point_3 *,
+                               std::ptrdiff_t threshold_hilbert,
+                               std::ptrdiff_t threshold_multiscale,
+                               double ratio)
+{
+  typedef Spatial_sort_permutation_point_map<RandomAccessIterator> Point_map;
+  typedef Spatial_sort_traits_adapter_3<Kernel, typename Point_map::type> Traits;
+
+  CGAL::spatial_sort<ConcurrencyTag>(permutation.begin(), permutation.end(),
+                                     Traits(Point_map::make(begin), k), policy,
+                                     threshold_hilbert, threshold_multiscale, ratio);
+}
+
+template <class ConcurrencyTag, class RandomAccessIterator, class Policy, class Kernel>
+void spatial_sort_permutation (RandomAccessIterator begin,
+                               std::vector<std::size_t>& permutation,
+                               const Kernel& k, Policy policy,
+                               typename Kernel::Point_d *,
+                               std::ptrdiff_t threshold_hilbert,
+                               std::ptrdiff_t threshold_multiscale,
+                               double ratio)
+{
+  typedef Spatial_sort_permutation_point_map<RandomAccessIterator> Point_map;
+  typedef Spatial_sort_traits_adapter_d<Kernel, typename Point_map::type> Traits;
+
+  CGAL::spatial_sort<ConcurrencyTag>(permutation.begin(), permutation.end(),
+                                     Traits(Point_map::make(begin), k), policy,
+                                     threshold_hilbert, threshold_multiscale, ratio);
+}
+
+} // namespace internal
+
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator, class Policy, class Kernel>
+std::vector<std::size_t>
+spatial_sort_permutation (RandomAccessIterator begin, RandomAccessIterator end,
+                          const Kernel& k,
+                          Policy policy,
+                          std::ptrdiff_t threshold_hilbert=0,
+                          std::ptrdiff_t threshold_multiscale=0,
+                          double ratio=0.0)
+{
+  typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+
+  std::vector<std::size_t> permutation(std::distance(begin, end));
+  std::iota(permutation.begin(), permutation.end(), std::size_t(0));
+
+  internal::spatial_sort_permutation<ConcurrencyTag>(begin, permutation, k, policy,
+                                                     static_cast<value_type *>(nullptr),
+                                                     threshold_hilbert, threshold_multiscale, ratio);
+  return permutation;
+}
+
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator, class Tag>
+std::vector<std::size_t>
+spatial_sort_permutation (RandomAccessIterator begin, RandomAccessIterator end,
+                          Hilbert_policy<Tag> policy,
+                          std::ptrdiff_t threshold_hilbert=0,
+                          std::ptrdiff_t threshold_multiscale=0,
+                          double ratio=0.0)
+{
+  typedef std::iterator_traits<RandomAccessIterator> ITraits;
+  typedef typename ITraits::value_type               value_type;
+  typedef CGAL::Kernel_traits<value_type>            KTraits;
+  typedef typename KTraits::Kernel                   Kernel;
+
+  return spatial_sort_permutation<ConcurrencyTag>(begin, end, Kernel(), policy,
+                                                  threshold_hilbert, threshold_multiscale, ratio);
+}
+
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator>
+std::vector<std::size_t>
+spatial_sort_permutation (RandomAccessIterator begin, RandomAccessIterator end,
+                          std::ptrdiff_t threshold_hilbert=0,
+                          std::ptrdiff_t threshold_multiscale=0,
+                          double ratio=0.0)
+{
+  return spatial_sort_permutation<ConcurrencyTag>(begin, end, Hilbert_sort_median_policy(),
+                                                  threshold_hilbert, threshold_multiscale, ratio);
+}
+
+template <class ConcurrencyTag = Sequential_tag, class RandomAccessIterator>
+void apply_spatial_sort_permutation (const std::vector<std::size_t>& permutation,
+                                     RandomAccessIterator begin)
+{
+  typedef typename std::iterator_traits<RandomAccessIterator>::value_type Value;
+
+  const std::size_t size = permutation.size();
+  std::vector<Value> values(begin, begin + size);
+
+  CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, size),
+                                 [&](std::size_t i) -> bool
+                                 {
+                                   *(begin + i) = std::move(values[permutation[i]]);
+                                   return true;
+                                 });
+}
+
+} // namespace CGAL
+
+#endif // CGAL_SPATIAL_SORT_PERMUTATION_H
@@ -650,6 +650,141 @@ int main ()
     std::cout << "OK." << std::endl;
   }
 
+  {
+    std::cout << "Testing 2D (radix policy): Generating "<<nb_points_2<<" random points... " << std::flush;
+
+    std::vector<Point_2> v;
+    v.reserve (nb_points_2);
+
+    CGAL::Random_points_in_square_2<Point_2> gen (1.0, random);
+
+    for (int i = 0; i < nb_points_2 - 1; ++i)
+      v.push_back (*gen++);
+    v.push_back(v[0]); //insert twice the same point
+
+    std::cout << "done." << std::endl;
+
+    std::vector<Point_2> v2 (v);
+
+    std::cout << "            Sorting points...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::hilbert_sort(v.begin(),v.end(), CGAL::Hilbert_sort_radix_policy());
+    timer.stop();
+
+    std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
+
+    std::cout << "            Checking...          " << std::flush;
+
+    std::sort (v.begin(),  v.end(),  K().less_xy_2_object());
+    std::sort (v2.begin(), v2.end(), K().less_xy_2_object());
+    assert(v == v2);
+
+    std::cout << "no points lost." << std::endl;
+  }
+  {
+    int size=65536;             // 2^(xd)   with x=8 d=2
+    double box_size = 255.0;    // 2^x -1
+
+    std::cout << "Testing 2D (radix policy): Generating "<<size<<" grid points... " << std::flush;
+
+    std::vector<Point_2> v;
+    v.reserve(size);
+
+    CGAL::points_on_square_grid_2 (box_size, (std::size_t)size,
+                                   std::back_inserter(v), Creator_2() );
+    std::vector<Point_2> v2 (v);
+
+    std::cout << "done." << std::endl;
+
+    std::cout << "            Sorting points...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::hilbert_sort(v.begin(),v.end(), CGAL::Hilbert_sort_radix_policy());
+    timer.stop();
+
+    std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
+
+    std::cout << "            Checking...          " << std::flush;
+
+    for (int i = 0; i < size-1; ++i) {
+      assert(CGAL::squared_distance( v[i], v[i+1]) - 4.0 < 0.1 );
+    }
+
+    // on a grid, the middle policy follows the same curve
+    CGAL::hilbert_sort(v2.begin(),v2.end(), CGAL::Hilbert_sort_middle_policy());
+    assert(v == v2);
+
+    std::cout << "OK." << std::endl;
+  }
+  {
+    std::cout << "Testing 3D (radix policy): Generating "<<nb_points_3<<" random points... " << std::flush;
+
+    std::vector<Point_3> v;
+    v.reserve (nb_points_3);
+
+    CGAL::Random_points_in_cube_3<Point_3> gen (1.0, random);
+
+    for (int i = 0; i < nb_points_3 - 1; ++i)
+      v.push_back (*gen++);
+    v.push_back(v[0]); //insert twice the same point
+
+    std::cout << "done." << std::endl;
+
+    std::vector<Point_3> v2 (v);
+
+    std::cout << "            Sorting points...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::hilbert_sort(v.begin(),v.end(),CGAL::Hilbert_sort_radix_policy());
+    timer.stop();
+
+    std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
+
+    std::cout << "            Checking...          " << std::flush;
+
+    std::sort (v.begin(),  v.end(),  K().less_xyz_3_object());
+    std::sort (v2.begin(), v2.end(), K().less_xyz_3_object());
+    assert(v == v2);
+
+    std::cout << "no points lost." << std::endl;
+  }
+  {
+    int size=32768;             // 2^(xd)   with x=5 d=3
+    double box_size = 31.0;     // 2^x -1
+
+    std::cout << "Testing 3D (radix policy): Generating "<<size<<" grid points... " << std::flush;
+
+    std::vector<Point_3> v;
+    v.reserve(size);
+
+    CGAL::points_on_cube_grid_3 (box_size, (std::size_t)size,
+                                 std::back_inserter(v), Creator_3() );
+    std::vector<Point_3> v2 (v);
+
+    std::cout << "done." << std::endl;
+
+    std::cout << "            Sorting points...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::hilbert_sort(v.begin(),v.end(),CGAL::Hilbert_sort_radix_policy());
+    timer.stop();
+
+    std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
+
+    std::cout << "            Checking...          " << std::flush;
+
+    for (int i = 0; i < size-1; ++i) {
+      assert(CGAL::squared_distance( v[i], v[i+1]) - 4.0 < 0.1 );
+    }
+
+    // on a grid, the middle policy follows the same curve
+    CGAL::hilbert_sort(v2.begin(),v2.end(),CGAL::Hilbert_sort_middle_policy());
+    assert(v == v2);
+
+    std::cout << "OK." << std::endl;
+  }
+
   {
     int dim = 50;
     std::cout << "Testing "<<dim<<"D (median policy): Generating "<<nb_points_d<<" random points... " << std::flush;
@@ -0,0 +1,88 @@
+#include <cassert>
+
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/spatial_sort.h>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Cartesian_d.h>
+
+#include <CGAL/Random.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/point_generators_d.h>
+
+#include <iostream>
+#include <algorithm>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_2                                          Point_2;
+typedef K::Point_3                                          Point_3;
+
+typedef CGAL::Cartesian_d<double>                           Kd;
+typedef Kd::Point_d                                         Point_d;
+
+// The parallel sorts split the ranges exactly as the sequential ones,
+// so both must give the same order.
+template <class Point, class Policy>
+void check_same_order(const std::vector<Point>& points, Policy policy, const char* name)
+{
+  std::cout << "Testing " << name << "... " << std::flush;
+
+  std::vector<Point> v (points), v2 (points);
+  CGAL::hilbert_sort (v.begin(), v.end(), policy);
+  CGAL::hilbert_sort<CGAL::Parallel_if_available_tag> (v2.begin(), v2.end(), policy);
+  assert(v == v2);
+
+  v = points;
+  v2 = points;
+  CGAL::spatial_sort (v.begin(), v.end(), policy);
+  CGAL::spatial_sort<CGAL::Parallel_if_available_tag> (v2.begin(), v2.end(), policy);
+  assert(v == v2);
+
+  std::cout << "OK." << std::endl;
+}
+
+int main ()
+{
+  const int nb_points = 200000, nb_points_d = 50000;
+  CGAL::Random random (42);
+
+  std::cout << "Testing parallel Hilbert and spatial sorts." << std::endl;
+
+  {
+    std::vector<Point_2> v;
+    CGAL::Random_points_in_square_2<Point_2> gen (1.0, random);
+    for (int i = 0; i < nb_points - 1; ++i)
+      v.push_back (*gen++);
+    v.push_back(v[0]); //insert twice the same point
+
+    check_same_order(v, CGAL::Hilbert_sort_median_policy(), "2D (median policy)");
+    check_same_order(v, CGAL::Hilbert_sort_middle_policy(), "2D (middle policy)");
+    check_same_order(v, CGAL::Hilbert_sort_radix_policy(), "2D (radix policy)");
+  }
+  {
+    std::vector<Point_3> v;
+    CGAL::Random_points_in_cube_3<Point_3> gen (1.0, random);
+    for (int i = 0; i < nb_points - 1; ++i)
+      v.push_back (*gen++);
+    v.push_back(v[0]); //insert twice the same point
+
+    check_same_order(v, CGAL::Hilbert_sort_median_policy(), "3D (median policy)");
+    check_same_order(v, CGAL::Hilbert_sort_middle_policy(), "3D (middle policy)");
+    check_same_order(v, CGAL::Hilbert_sort_radix_policy(), "3D (radix policy)");
+  }
+  {
+    const int dim = 5;
+    std::vector<Point_d> v;
+    CGAL::Random_points_in_cube_d<Point_d> gen (dim, 1.0, random);
+    for (int i = 0; i < nb_points_d - 1; ++i)
+      v.push_back (*gen++);
+    v.push_back(v[0]); //insert twice the same point
+
+    check_same_order(v, CGAL::Hilbert_sort_median_policy(), "5D (median policy)");
+    check_same_order(v, CGAL::Hilbert_sort_middle_policy(), "5D (middle policy)");
+  }
+
+  return 0;
+}
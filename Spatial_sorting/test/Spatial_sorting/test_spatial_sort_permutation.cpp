@@ -0,0 +1,103 @@
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Cartesian_d.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/point_generators_d.h>
+#include <CGAL/Spatial_sort_permutation_cache.h>
+#include <CGAL/spatial_sort.h>
+#include <CGAL/spatial_sort_permutation.h>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef CGAL::Cartesian_d<double>                          Kd;
+
+template <class Point, class Policy>
+void check_permutation(const std::vector<Point>& points, Policy policy)
+{
+  std::vector<std::size_t> permutation = CGAL::spatial_sort_permutation(points.begin(), points.end(), policy);
+  assert(permutation.size() == points.size());
+
+  std::vector<bool> seen(points.size(), false);
+  for (std::size_t i : permutation) {
+    assert(i < points.size() && !seen[i]);
+    seen[i] = true;
+  }
+
+  // the order of the points is the one given by `spatial_sort()` on the points themselves
+  std::vector<Point> sorted = points;
+  CGAL::spatial_sort(sorted.begin(), sorted.end(), policy);
+  std::vector<Point> permuted = points;
+  CGAL::apply_spatial_sort_permutation(permutation, permuted.begin());
+  assert(permuted == sorted);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  assert(CGAL::spatial_sort_permutation<CGAL::Parallel_tag>(points.begin(), points.end(), policy) == permutation);
+  std::vector<Point> permuted_in_parallel = points;
+  CGAL::apply_spatial_sort_permutation<CGAL::Parallel_tag>(permutation, permuted_in_parallel.begin());
+  assert(permuted_in_parallel == sorted);
+#endif
+}
+
+int main ()
+{
+  const std::size_t nb_points = 20000;
+
+  std::vector<K::Point_2> points_2;
+  CGAL::Random_points_in_square_2<K::Point_2> gen_2(1.0);
+  for (std::size_t i = 0; i < nb_points; ++i) points_2.push_back(*gen_2++);
+
+  std::vector<K::Point_3> points_3;
+  CGAL::Random_points_in_cube_3<K::Point_3> gen_3(1.0);
+  for (std::size_t i = 0; i < nb_points; ++i) points_3.push_back(*gen_3++);
+
+  std::vector<Kd::Point_d> points_d;
+  CGAL::Random_points_in_cube_d<Kd::Point_d> gen_d(5, 1.0);
+  for (std::size_t i = 0; i < nb_points; ++i) points_d.push_back(*gen_d++);
+
+  std::cout << "Testing spatial_sort_permutation()" << std::endl;
+  check_permutation(points_2, CGAL::Hilbert_sort_median_policy());
+  check_permutation(points_2, CGAL::Hilbert_sort_middle_policy());
+  check_permutation(points_2, CGAL::Hilbert_sort_radix_policy());
+  check_permutation(points_3, CGAL::Hilbert_sort_median_policy());
+  check_permutation(points_3, CGAL::Hilbert_sort_middle_policy());
+  check_permutation(points_3, CGAL::Hilbert_sort_radix_policy());
+  check_permutation(points_d, CGAL::Hilbert_sort_median_policy());
+  check_permutation(points_d, CGAL::Hilbert_sort_middle_policy());
+
+  std::cout << "Testing Spatial_sort_permutation_cache" << std::endl;
+  CGAL::Spatial_sort_permutation_cache<> cache;
+  assert(cache.find(0, 0) == nullptr);
+
+  auto p2 = cache.permutation(0, 0, points_2.begin(), points_2.end());
+  auto p3 = cache.permutation(1, 0, points_3.begin(), points_3.end());
+  assert(cache.size() == 2);
+  assert(*p2 == CGAL::spatial_sort_permutation(points_2.begin(), points_2.end()));
+  assert(*p3 == CGAL::spatial_sort_permutation(points_3.begin(), points_3.end()));
+
+  // the same version gives back the stored permutation
+  assert(cache.permutation(0, 0, points_2.begin(), points_2.end()) == p2);
+  assert(cache.find(1, 0) == p3);
+
+  // a new version of the range is sorted again
+  points_2.resize(nb_points / 2);
+  assert(cache.find(0, 1) == nullptr);
+  auto p2_new = cache.permutation(0, 1, points_2.begin(), points_2.end());
+  assert(p2_new != p2 && p2_new->size() == points_2.size());
+  assert(cache.find(0, 0) == nullptr);
+  assert(p2->size() == nb_points); // previous permutations stay valid for their holders
+
+  // a request for an older version does not evict the newer permutation
+  auto p2_old = cache.permutation(0, 0, points_2.begin(), points_2.end());
+  assert(p2_old != p2_new && cache.find(0, 1) == p2_new && cache.find(0, 0) == nullptr);
+
+  cache.invalidate(1);
+  assert(cache.find(1, 0) == nullptr && cache.size() == 1);
+  cache.clear();
+  assert(cache.size() == 0);
+
+  std::cout << "OK" << std::endl;
+  return 0;
+}
@@ -0,0 +1,481 @@
+// Copyright (c) 2026 GeometryFactory (France).  All Rights Reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s): Le-Jeng Shiue <Andy.Shiue@gmail.com>
+//
+
+#ifndef CGAL_SUBDIVISION_STENCILS_3_H
+#define CGAL_SUBDIVISION_STENCILS_3_H
+
+#include <CGAL/basic.h>
+#include <CGAL/for_each.h>
+#include <CGAL/Origin.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
+#include <CGAL/circulator.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/boost/graph/iterator.h>
+#include <CGAL/boost/graph/properties.h>
+
+#include <CGAL/Subdivision_method_3/internal/subdivision_hosts_impl_3.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+namespace Subdivision_method_3 {
+
+namespace internal {
+
+// A sparse row of weights over the control vertices: the position of a refined
+// vertex is the weighted sum of the positions of the control vertices.
+template <class FT>
+struct Stencil_row
+{
+  typedef std::pair<std::size_t, FT> Entry;
+
+  std::vector<Entry> entries;
+
+  void add(const Stencil_row& r, const FT w) {
+    for(const Entry& e : r.entries)
+      entries.push_back(Entry(e.first, e.second * w));
+  }
+
+  // sorts the entries and merges the entries of the same control vertex
+  void compress() {
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) { return a.first < b.first; });
+    std::size_t n = 0;
+    for(std::size_t i = 0; i < entries.size(); ++i) {
+      if(n > 0 && entries[n-1].first == entries[i].first)
+        entries[n-1].second += entries[i].second;
+      else
+        entries[n++] = entries[i];
+    }
+    entries.resize(n);
+  }
+};
+
+// The stencil masks below mirror the geometry masks of `subdivision_masks_3.h`,
+// but combine stencil rows instead of points.
+template <class PolygonMesh, class RowMap, class FT>
+class Linear_stencil_mask_3 {
+public:
+  typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor   vertex_descriptor;
+  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
+  typedef typename boost::graph_traits<PolygonMesh>::face_descriptor     face_descriptor;
+  typedef Stencil_row<FT>                                                 Row;
+
+  PolygonMesh* pmesh;
+  RowMap rows;
+
+  Linear_stencil_mask_3(PolygonMesh* pmesh, RowMap rows)
+    : pmesh(pmesh), rows(rows)
+  { }
+
+  void face_node(face_descriptor facet, Row& r) {
+    r.entries.clear();
+    int n = 0;
+    for(vertex_descriptor vd : vertices_around_face(halfedge(facet, *pmesh), *pmesh)) {
+      r.add(get(rows, vd), FT(1));
+      ++n;
+    }
+    for(typename Row::Entry& e : r.entries)
+      e.second /= FT(n);
+    r.compress();
+  }
+
+  void edge_node(halfedge_descriptor edge, Row& r) {
+    r.entries.clear();
+    r.add(get(rows, target(edge, *pmesh)), FT(0.5));
+    r.add(get(rows, source(edge, *pmesh)), FT(0.5));
+    r.compress();
+  }
+
+  void vertex_node(vertex_descriptor vertex, Row& r) {
+    r = get(rows, vertex);
+  }
+
+  // border vertex row of the Catmull-Clark and Loop masks
+  void border_vertex_node(halfedge_descriptor edge, Row& vr) {
+    Halfedge_around_target_circulator<PolygonMesh> vcir(edge, *pmesh);
+    vr.entries.clear();
+    vr.add(get(rows, target(opposite(*vcir, *pmesh), *pmesh)), FT(1)/FT(8));
+    vr.add(get(rows, target(*vcir, *pmesh)), FT(6)/FT(8));
+    --vcir;
+    vr.add(get(rows, target(opposite(*vcir, *pmesh), *pmesh)), FT(1)/FT(8));
+    vr.compress();
+  }
+};
+
+template <class PolygonMesh, class RowMap, class FT>
+class CatmullClark_stencil_mask_3
+  : public Linear_stencil_mask_3<PolygonMesh, RowMap, FT>
+{
+  typedef Linear_stencil_mask_3<PolygonMesh, RowMap, FT> Base;
+public:
+  typedef typename Base::vertex_descriptor   vertex_descriptor;
+  typedef typename Base::halfedge_descriptor halfedge_descriptor;
+  typedef typename Base::Row                 Row;
+
+  CatmullClark_stencil_mask_3(PolygonMesh* pmesh, RowMap rows) : Base(pmesh, rows) { }
+
+  void edge_node(halfedge_descriptor edge, Row& r) {
+    const PolygonMesh& pm = *(this->pmesh);
+    Row f1, f2;
+    this->face_node(face(edge, pm), f1);
+    this->face_node(face(opposite(edge, pm), pm), f2);
+    r.entries.clear();
+    r.add(get(this->rows, target(edge, pm)), FT(0.25));
+    r.add(get(this->rows, source(edge, pm)), FT(0.25));
+    r.add(f1, FT(0.25));
+    r.add(f2, FT(0.25));
+    r.compress();
+  }
+
+  void vertex_node(vertex_descriptor vertex, Row& r) {
+    const PolygonMesh& pm = *(this->pmesh);
+    const int n = static_cast<int>(degree(vertex, pm));
+
+    // (Q + 2R + (n-3)S) / n, with Q the average of the incident face points
+    // and R the average of the incident edge midpoints
+    r.entries.clear();
+    Row q;
+    Halfedge_around_target_circulator<PolygonMesh> vcir(vertex, pm);
+    for(int i = 0; i < n; ++i, ++vcir) {
+      r.add(get(this->rows, target(opposite(*vcir, pm), pm)), FT(1) / FT(n*n));
+      this->face_node(face(*vcir, pm), q);
+      r.add(q, FT(1) / FT(n*n));
+    }
+    r.add(get(this->rows, vertex), FT(1) / FT(n) + FT(n-3) / FT(n));
+    r.compress();
+  }
+
+  void border_node(halfedge_descriptor edge, Row& er, Row& vr) {
+    Base::edge_node(edge, er);
+    this->border_vertex_node(edge, vr);
+  }
+};
+
+template <class PolygonMesh, class RowMap, class FT>
+class Loop_stencil_mask_3
+  : public Linear_stencil_mask_3<PolygonMesh, RowMap, FT>
+{
+  typedef Linear_stencil_mask_3<PolygonMesh, RowMap, FT> Base;
+public:
+  typedef typename Base::vertex_descriptor   vertex_descriptor;
+  typedef typename Base::halfedge_descriptor halfedge_descriptor;
+  typedef typename Base::Row                 Row;
+
+  Loop_stencil_mask_3(PolygonMesh* pmesh, RowMap rows) : Base(pmesh, rows) { }
+
+  void edge_node(halfedge_descriptor edge, Row& r) {
+    const PolygonMesh& pm = *(this->pmesh);
+    r.entries.clear();
+    r.add(get(this->rows, target(edge, pm)), FT(3)/FT(8));
+    r.add(get(this->rows, source(edge, pm)), FT(3)/FT(8));
+    r.add(get(this->rows, target(next(edge, pm), pm)), FT(1)/FT(8));
+    r.add(get(this->rows, target(next(opposite(edge, pm), pm), pm)), FT(1)/FT(8));
+    r.compress();
+  }
+
+  void vertex_node(vertex_descriptor vertex, Row& r) {
+    const PolygonMesh& pm = *(this->pmesh);
+    Halfedge_around_target_circulator<PolygonMesh> vcir(vertex, pm);
+    const std::size_t n = circulator_size(vcir);
+    CGAL_assume(n > 0);
+
+    // (Sw*S + R) / W, with R the sum of the neighbors
+    FT Sw(10), W(16);
+    if(n != 6) {
+      const FT Cn = (FT) (5.0/8.0 - CGAL::square(3+2*std::cos(2 * CGAL_PI/(double) n))/64.0);
+      Sw = (double)n*(1-Cn)/Cn;
+      W = (double)n/Cn;
+    }
+
+    r.entries.clear();
+    for(std::size_t i = 0; i < n; ++i, ++vcir)
+      r.add(get(this->rows, target(opposite(*vcir, pm), pm)), FT(1) / W);
+    r.add(get(this->rows, vertex), Sw / W);
+    r.compress();
+  }
+
+  void border_node(halfedge_descriptor edge, Row& er, Row& vr) {
+    Base::edge_node(edge, er);
+    this->border_vertex_node(edge, vr);
+  }
+};
+
+template <class PolygonMesh, class RowMap, class FT>
+class Sqrt3_stencil_mask_3
+  : public Linear_stencil_mask_3<PolygonMesh, RowMap, FT>
+{
+  typedef Linear_stencil_mask_3<PolygonMesh, RowMap, FT> Base;
+public:
+  typedef typename Base::vertex_descriptor   vertex_descriptor;
+  typedef typename Base::halfedge_descriptor halfedge_descriptor;
+  typedef typename Base::Row                 Row;
+
+  Sqrt3_stencil_mask_3(PolygonMesh* pmesh, RowMap rows) : Base(pmesh, rows) { }
+
+  void vertex_node(vertex_descriptor vertex, Row& r) {
+    const PolygonMesh& pm = *(this->pmesh);
+    const int n = static_cast<int>(degree(vertex, pm));
+    const FT a = (FT) ((4.0-2.0*std::cos(2.0*CGAL_PI/(double)n))/9.0);
+
+    r.entries.clear();
+    r.add(get(this->rows, vertex), FT(1) - a);
+    for(halfedge_descriptor h : halfedges_around_target(vertex, pm))
+      r.add(get(this->rows, source(h, pm)), a / FT(n));
+    r.compress();
+  }
+
+  void border_node(halfedge_descriptor hd, Row& er1, Row& er2, Row& vr) {
+    const PolygonMesh& pm = *(this->pmesh);
+    halfedge_descriptor bhd = opposite(hd, pm);
+    CGAL_precondition(is_border(bhd, pm));
+    const Row& prev_s = get(this->rows, source(prev(bhd, pm), pm));
+    const Row& s = get(this->rows, source(bhd, pm));
+    const Row& t = get(this->rows, target(bhd, pm));
+    const Row& next_t = get(this->rows, target(next(bhd, pm), pm));
+
+    const FT denom = FT(1) / FT(27);
+    er1.entries.clear();
+    er1.add(prev_s, denom);
+    er1.add(s, 16 * denom);
+    er1.add(t, 10 * denom);
+    er1.compress();
+
+    er2.entries.clear();
+    er2.add(s, 10 * denom);
+    er2.add(t, 16 * denom);
+    er2.add(next_t, denom);
+    er2.compress();
+
+    vr.entries.clear();
+    vr.add(prev_s, 4 * denom);
+    vr.add(s, 19 * denom);
+    vr.add(t, 4 * denom);
+    vr.compress();
+  }
+};
+
+} // namespace internal
+
+/*!
+\ingroup PkgSurfaceSubdivisionMethod3Ref
+
+The class `Subdivision_stencils_3` subdivides a polygon mesh like the functions
+`CatmullClark_subdivision()`, `Loop_subdivision()`, and `Sqrt3_subdivision()`,
+and records the subdivision stencils of all the levels: the position of each vertex
+of the refined mesh is stored as a sparse weighted sum of the positions of the
+vertices of the control mesh.
+
+Once the stencils are computed, the positions of the refined mesh can be
+recomputed for new positions of the control vertices, for example for each
+frame of an animated control mesh, with a sparse matrix-vector product
+instead of a new refinement of the connectivity. This product can run in parallel.
+
+The recorded vertex descriptors are valid as long as the refined mesh is not modified.
+
+\tparam PolygonMesh must be a model of the concept `MutableFaceGraph`.
+\tparam VertexPointMap must be a model of `ReadWritePropertyMap` with
+        `boost::graph_traits<PolygonMesh>::%vertex_descriptor` as key type and `Point_3` as value type.
+
+\sa `CGAL::Subdivision_method_3::CatmullClark_subdivision()`
+\sa `CGAL::Subdivision_method_3::Loop_subdivision()`
+\sa `CGAL::Subdivision_method_3::Sqrt3_subdivision()`
+*/
+template <class PolygonMesh,
+          class VertexPointMap = typename boost::property_map<PolygonMesh, vertex_point_t>::type>
+class Subdivision_stencils_3
+{
+public:
+  /// \name Types
+  /// @{
+
+  /// vertex descriptor of the polygon mesh
+  typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor  vertex_descriptor;
+  /// point type
+  typedef typename boost::property_traits<VertexPointMap>::value_type   Point;
+  /// number type
+  typedef typename Kernel_traits<Point>::Kernel::FT                     FT;
+
+  /// @}
+
+private:
+  typedef typename Kernel_traits<Point>::Kernel::Vector_3               Vector;
+  typedef internal::Stencil_row<FT>                                     Row;
+  typedef typename boost::property_map<PolygonMesh,
+                     CGAL::dynamic_vertex_property_t<Row> >::type      Row_map;
+
+  std::vector<vertex_descriptor> m_control_vertices;
+  std::vector<vertex_descriptor> m_refined_vertices;
+
+  // compressed rows: the stencil of the refined vertex `i` is stored
+  // in `[m_row_begin[i], m_row_begin[i+1])`
+  std::vector<std::size_t> m_row_begin;
+  std::vector<std::size_t> m_columns;
+  std::vector<FT> m_weights;
+
+public:
+  /// \name Creation
+  /// @{
+
+  /// creates empty stencils.
+  Subdivision_stencils_3() { }
+
+  /// @}
+
+  /// \name Subdivision
+  /// The following functions subdivide `pmesh` in place exactly as the function of the same name
+  /// with the same named parameters does, and record the stencils of the refined vertices.
+  /// The previously recorded stencils are discarded.
+  ///
+  /// The named parameters `vertex_point_map` and `number_of_iterations` are supported.
+  /// @{
+
+  /// applies Catmull-Clark subdivision to `pmesh` and records its stencils.
+  template <class NamedParameters = parameters::Default_named_parameters>
+  void CatmullClark_subdivision(PolygonMesh& pmesh, const NamedParameters& np = parameters::default_values())
+  {
+    typedef internal::CatmullClark_stencil_mask_3<PolygonMesh, Row_map, FT> Mask;
+    subdivide(pmesh, np, [&](Row_map rows, unsigned int) {
+      internal::PQQ_1step(pmesh, rows, Mask(&pmesh, rows));
+    });
+  }
+
+  /// applies Loop subdivision to `pmesh` and records its stencils.
+  /// \pre `pmesh` must be a triangle mesh.
+  template <class NamedParameters = parameters::Default_named_parameters>
+  void Loop_subdivision(PolygonMesh& pmesh, const NamedParameters& np = parameters::default_values())
+  {
+    typedef internal::Loop_stencil_mask_3<PolygonMesh, Row_map, FT> Mask;
+    subdivide(pmesh, np, [&](Row_map rows, unsigned int) {
+      internal::PTQ_1step(pmesh, rows, Mask(&pmesh, rows));
+    });
+  }
+
+  /// applies \f$ \sqrt{3}\f$-subdivision to `pmesh` and records its stencils.
+  /// \pre `pmesh` must be a triangle mesh.
+  template <class NamedParameters = parameters::Default_named_parameters>
+  void Sqrt3_subdivision(PolygonMesh& pmesh, const NamedParameters& np = parameters::default_values())
+  {
+    typedef internal::Sqrt3_stencil_mask_3<PolygonMesh, Row_map, FT> Mask;
+    subdivide(pmesh, np, [&](Row_map rows, unsigned int i) {
+      internal::Sqrt3_1step(pmesh, rows, Mask(&pmesh, rows), (i%2==1));
+    });
+  }
+
+  /// @}
+
+  /// \name Access
+  /// @{
+
+  /// returns the vertices of the control mesh, in the order expected by `update()`.
+  /// They are also vertices of the refined mesh.
+  const std::vector<vertex_descriptor>& control_vertices() const { return m_control_vertices; }
+
+  /// returns the vertices of the refined mesh.
+  const std::vector<vertex_descriptor>& refined_vertices() const { return m_refined_vertices; }
+
+  /// returns the number of non-zero weights of all the stencils.
+  std::size_t number_of_weights() const { return m_weights.size(); }
+
+  /// @}
+
+  /// \name Evaluation
+  /// @{
+
+  /*!
+   * recomputes the positions of the refined vertices from the positions of the control vertices
+   * and puts them in `vpm`.
+   *
+   * \tparam ConcurrencyTag enables sequential versus parallel evaluation.
+   *         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+   *         With `Parallel_tag`, \ref thirdpartyTBB "TBB" or OpenMP must be available.
+   * \tparam PointRange a model of `RandomAccessRange` with value type `Point`
+   *
+   * \param control_points the positions of the control vertices, in the order of `control_vertices()`
+   * \param vpm the vertex point map of the refined mesh
+   */
+  template <class ConcurrencyTag = Sequential_tag, class PointRange>
+  void update(const PointRange& control_points, VertexPointMap vpm) const
+  {
+    CGAL_precondition(static_cast<std::size_t>(std::size(control_points)) == m_control_vertices.size());
+
+    const auto points = std::begin(control_points);
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, m_refined_vertices.size()),
+                                   [&](const std::size_t i) -> bool
+                                   {
+                                     Vector v = NULL_VECTOR;
+                                     for(std::size_t k = m_row_begin[i]; k != m_row_begin[i+1]; ++k)
+                                       v = v + m_weights[k] * (points[m_columns[k]] - ORIGIN);
+                                     put(vpm, m_refined_vertices[i], ORIGIN + v);
+                                     return true;
+                                   });
+  }
+
+  /// @}
+
+private:
+  template <class NamedParameters, class OneStep>
+  void subdivide(PolygonMesh& pmesh, const NamedParameters& np, const OneStep& one_step)
+  {
+    using parameters::choose_parameter;
+    using parameters::get_parameter;
+
+    VertexPointMap vpm = choose_parameter(get_parameter(np, internal_np::vertex_point),
+                                          get_property_map(CGAL::vertex_point, pmesh));
+    unsigned int step = choose_parameter(get_parameter(np, internal_np::number_of_iterations), 1);
+
+    // each control vertex starts with its own stencil
+    m_control_vertices.assign(vertices(pmesh).begin(), vertices(pmesh).end());
+    std::vector<Point> control_points;
+    control_points.reserve(m_control_vertices.size());
+
+    Row_map rows = get(CGAL::dynamic_vertex_property_t<Row>(), pmesh);
+    for(std::size_t i = 0; i < m_control_vertices.size(); ++i) {
+      Row r;
+      r.entries.push_back(typename Row::Entry(i, FT(1)));
+      put(rows, m_control_vertices[i], r);
+      control_points.push_back(get(vpm, m_control_vertices[i]));
+    }
+
+    // refine the connectivity, the stencil masks compose the rows of each level
+    for(unsigned int i = 0; i < step; ++i)
+      one_step(rows, i);
+
+    m_refined_vertices.assign(vertices(pmesh).begin(), vertices(pmesh).end());
+    m_row_begin.assign(1, 0);
+    m_columns.clear();
+    m_weights.clear();
+    for(vertex_descriptor v : m_refined_vertices) {
+      for(const typename Row::Entry& e : get(rows, v).entries) {
+        m_columns.push_back(e.first);
+        m_weights.push_back(e.second);
+      }
+      m_row_begin.push_back(m_columns.size());
+    }
+
+    update(control_points, vpm);
+  }
+};
+
+} // namespace Subdivision_method_3
+
+} // namespace CGAL
+
+#endif // CGAL_SUBDIVISION_STENCILS_3_H
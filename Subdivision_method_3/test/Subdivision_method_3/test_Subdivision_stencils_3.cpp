@@ -0,0 +1,120 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Polyhedron_3.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/subdivision_method_3.h>
+#include <CGAL/Subdivision_method_3/subdivision_stencils_3.h>
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Simple_cartesian<double> Kernel;
+typedef Kernel::Point_3                Point;
+typedef Kernel::Vector_3               Vector;
+
+namespace SMS = CGAL::Subdivision_method_3;
+namespace params = CGAL::parameters;
+
+enum Method { CATMULL_CLARK, LOOP, SQRT3 };
+
+template <class Mesh>
+void subdivide(Mesh& mesh, const Method method, const unsigned int depth)
+{
+  if(method == CATMULL_CLARK)
+    SMS::CatmullClark_subdivision(mesh, params::number_of_iterations(depth));
+  else if(method == LOOP)
+    SMS::Loop_subdivision(mesh, params::number_of_iterations(depth));
+  else
+    SMS::Sqrt3_subdivision(mesh, params::number_of_iterations(depth));
+}
+
+template <class Mesh>
+void subdivide(SMS::Subdivision_stencils_3<Mesh>& stencils,
+               Mesh& mesh, const Method method, const unsigned int depth)
+{
+  if(method == CATMULL_CLARK)
+    stencils.CatmullClark_subdivision(mesh, params::number_of_iterations(depth));
+  else if(method == LOOP)
+    stencils.Loop_subdivision(mesh, params::number_of_iterations(depth));
+  else
+    stencils.Sqrt3_subdivision(mesh, params::number_of_iterations(depth));
+}
+
+template <class Mesh>
+std::vector<Point> points(const Mesh& mesh)
+{
+  std::vector<Point> pts;
+  for(auto v : vertices(mesh))
+    pts.push_back(get(CGAL::vertex_point, mesh, v));
+  return pts;
+}
+
+template <class Mesh>
+void test(const std::string& filename, const Method method, const unsigned int depth)
+{
+  typedef SMS::Subdivision_stencils_3<Mesh> Stencils;
+
+  Mesh reference, mesh;
+  std::ifstream in(filename);
+  in >> reference;
+  assert(num_vertices(reference) > 0);
+  mesh = reference;
+  const std::vector<Point> control_points = points(mesh);
+
+  // the refined mesh is the one of the subdivision function
+  subdivide(reference, method, depth);
+  Stencils stencils;
+  subdivide(stencils, mesh, method, depth);
+  assert(CGAL::is_valid_polygon_mesh(mesh));
+  assert(num_vertices(mesh) == num_vertices(reference));
+  assert(num_faces(mesh) == num_faces(reference));
+  assert(stencils.control_vertices().size() == control_points.size());
+  assert(stencils.refined_vertices().size() == num_vertices(mesh));
+
+  const std::vector<Point> ref_points = points(reference);
+  const std::vector<Point> sub_points = points(mesh);
+  for(std::size_t i = 0; i < ref_points.size(); ++i)
+    assert(CGAL::squared_distance(ref_points[i], sub_points[i]) < 1e-20);
+
+  // the stencils are affine: translating the control points translates the refined points
+  const Vector t(1., -2., 3.);
+  std::vector<Point> moved_points;
+  for(const Point& p : control_points)
+    moved_points.push_back(p + t);
+  stencils.update(moved_points, get(CGAL::vertex_point, mesh));
+  const std::vector<Point> moved_sub_points = points(mesh);
+  for(std::size_t i = 0; i < sub_points.size(); ++i)
+    assert(CGAL::squared_distance(sub_points[i] + t, moved_sub_points[i]) < 1e-20);
+
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
+  // the parallel evaluation gives the same points
+  stencils.update(control_points, get(CGAL::vertex_point, mesh));
+  stencils.template update<CGAL::Parallel_tag>(moved_points, get(CGAL::vertex_point, mesh));
+  assert(points(mesh) == moved_sub_points);
+#endif
+
+  std::cout << filename << ": " << num_vertices(mesh) << " refined vertices, "
+            << stencils.number_of_weights() << " weights" << std::endl;
+}
+
+template <class Mesh>
+void test_all()
+{
+  test<Mesh>(CGAL::data_file_path("meshes/corner.off"), CATMULL_CLARK, 3);
+  test<Mesh>(CGAL::data_file_path("meshes/corner_with_hole.off"), CATMULL_CLARK, 3);
+  test<Mesh>(CGAL::data_file_path("meshes/quint_tris.off"), LOOP, 3);
+  test<Mesh>(CGAL::data_file_path("meshes/nefertiti.off"), LOOP, 2);
+  test<Mesh>(CGAL::data_file_path("meshes/quint_tris.off"), SQRT3, 3);
+  test<Mesh>(CGAL::data_file_path("meshes/nefertiti.off"), SQRT3, 2);
+}
+
+int main()
+{
+  test_all<CGAL::Surface_mesh<Point> >();
+  test_all<CGAL::Polyhedron_3<Kernel> >();
+
+  std::cerr << "Done" << std::endl;
+  return 0;
+}
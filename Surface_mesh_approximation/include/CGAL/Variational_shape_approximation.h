@@ -25,6 +25,9 @@
 
 #include <CGAL/Surface_mesh_approximation/L21_metric_plane_proxy.h>
 #include <CGAL/Default.h>
+#include <CGAL/for_each.h>
+#include <CGAL/Iterator_range.h>
+#include <CGAL/property_map.h>
 #include <CGAL/tags.h>
 
 #include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
@@ -38,18 +41,15 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
+#include <algorithm>
 #include <vector>
 #include <stack>
 #include <queue>
+#include <unordered_map>
 #include <iterator>
 #include <cmath>
 #include <cstdlib>
 
-#ifdef CGAL_LINKED_WITH_TBB
-#include <tbb/parallel_for.h>
-#include <tbb/blocked_range.h>
-#endif // CGAL_LINKED_WITH_TBB
-
 #ifdef CGAL_SURFACE_MESH_APPROXIMATION_DEBUG
 #include <iostream>
 #endif
@@ -79,7 +79,11 @@ enum Seeding_method {
 /// @tparam VertexPointMap a `ReadablePropertyMap` with `boost::graph_traits<TriangleMesh>::%vertex_descriptor` as key and `GeomTraits::Point_3` as value type
 /// @tparam ErrorMetricProxy a model of `ErrorMetricProxy`
 /// @tparam GeomTraits a model of Kernel
-/// @tparam Concurrency_tag concurrency tag.
+/// @tparam Concurrency_tag enables sequential versus parallel algorithm.
+/// Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+/// With `Parallel_tag`, the partition, the proxy fitting, and the mesh extraction steps are run in parallel;
+/// the parallel partition floods the faces by increasing fitting error in synchronous rounds,
+/// and may differ slightly from the sequential one.
 template <typename TriangleMesh,
   typename VertexPointMap,
   typename ErrorMetricProxy = CGAL::Default,
@@ -380,7 +384,7 @@ public:
       for(face_descriptor f : faces(*m_ptm))
         put(m_fproxy_map, f, CGAL_VSA_INVALID_TAG);
 
-      partition(m_proxies.begin(), m_proxies.end());
+      partition(m_proxies.begin(), m_proxies.end(), Concurrency_tag());
       fit(m_proxies.begin(), m_proxies.end(), Concurrency_tag());
     }
 
@@ -768,7 +772,7 @@ public:
       for(face_descriptor f : confined_area)
         put(m_fproxy_map, f, CGAL_VSA_INVALID_TAG);
 
-      partition(confined_proxies.begin(), confined_proxies.end());
+      partition(confined_proxies.begin(), confined_proxies.end(), Concurrency_tag());
       fit(confined_proxies.begin(), confined_proxies.end(), Concurrency_tag());
     }
 
@@ -1179,13 +1183,15 @@ private:
 
   /*!
    * @brief partitions the area tagged with CGAL_VSA_INVALID_TAG with proxies, global face proxy map is updated.
-   * Propagates the proxy seed faces and floods the tagged area to minimize the fitting error.
+   * Propagates the proxy seed faces and floods the tagged area to minimize the fitting error, sequential.
    * @tparam ProxyWrapperIterator forward iterator with Proxy_wrapper as value type
    * @param beg iterator point to the first element
    * @param end iterator point to the one past the last element
+   * @param t concurrency tag
    */
   template<typename ProxyWrapperIterator>
-  void partition(const ProxyWrapperIterator beg, const ProxyWrapperIterator end) {
+  void partition(const ProxyWrapperIterator beg, const ProxyWrapperIterator end, const CGAL::Sequential_tag & t) {
+    CGAL_USE(t);
     std::priority_queue<Face_to_integrate> face_pqueue;
     for (ProxyWrapperIterator pxw_itr = beg; pxw_itr != end; ++pxw_itr) {
       face_descriptor f = pxw_itr->seed;
@@ -1216,6 +1222,135 @@ private:
     }
   }
 
+  /*!
+   * @brief partitions the area tagged with CGAL_VSA_INVALID_TAG with proxies, global face proxy map is updated.
+   * Propagates the proxy seed faces and floods the tagged area to minimize the fitting error, parallel.
+   * The flood proceeds in synchronous rounds over the frontier of the flooded area and, as the sequential
+   * best-first flood, integrates the faces by increasing fitting error:
+   * the best proxy of each frontier face is computed concurrently, and a frontier face is integrated
+   * when its fitting error is below the current threshold and minimal among its adjacent frontier faces.
+   * The threshold is only raised when no frontier face is below it, to the fitting error
+   * of a small part of the frontier.
+   * The result is deterministic, but may differ slightly from the sequential flood.
+   * @tparam ProxyWrapperIterator forward iterator with Proxy_wrapper as value type
+   * @param beg iterator point to the first element
+   * @param end iterator point to the one past the last element
+   * @param t concurrency tag
+   */
+  template<typename ProxyWrapperIterator>
+  void partition(const ProxyWrapperIterator beg, const ProxyWrapperIterator end, const CGAL::Parallel_tag & t) {
+    CGAL_USE(t);
+    const face_descriptor null_face = boost::graph_traits<TriangleMesh>::null_face();
+
+    // only the faces integrated by the flooding proxies propagate
+    std::vector<bool> is_flooding(m_proxies.size(), false);
+    for (ProxyWrapperIterator pxw_itr = beg; pxw_itr != end; ++pxw_itr) {
+      is_flooding[pxw_itr->idx] = true;
+      put(m_fproxy_map, pxw_itr->seed, pxw_itr->idx);
+    }
+
+    // the frontier: the tagged faces adjacent to the flooded area, with their position
+    std::vector<face_descriptor> frontier;
+    std::unordered_map<face_descriptor, std::size_t> frontier_slot;
+    const auto expand_frontier = [&](const face_descriptor f) {
+      for(face_descriptor fadj : faces_around_face(halfedge(f, *m_ptm), *m_ptm)) {
+        if (fadj != null_face
+            && get(m_fproxy_map, fadj) == CGAL_VSA_INVALID_TAG
+            && frontier_slot.emplace(fadj, frontier.size()).second)
+          frontier.push_back(fadj);
+      }
+    };
+    for (ProxyWrapperIterator pxw_itr = beg; pxw_itr != end; ++pxw_itr)
+      expand_frontier(pxw_itr->seed);
+
+    std::vector<Face_to_integrate> candidates;
+    std::vector<FT> errors;
+    std::vector<char> to_integrate;
+    FT threshold(0.0);
+    while (!frontier.empty()) {
+      const std::size_t nb_frontier = frontier.size();
+      candidates.assign(nb_frontier, Face_to_integrate(null_face, CGAL_VSA_INVALID_TAG, FT(0.0)));
+      to_integrate.assign(nb_frontier, 0);
+
+      // best flooding proxy of each frontier face among its adjacent flooded faces
+      CGAL::for_each<CGAL::Parallel_tag>(CGAL::make_counting_range<std::size_t>(0, nb_frontier),
+        [&](const std::size_t i) -> bool {
+          Face_to_integrate &c = candidates[i];
+          c.f = frontier[i];
+          for(face_descriptor fadj : faces_around_face(halfedge(c.f, *m_ptm), *m_ptm)) {
+            if (fadj == null_face)
+              continue;
+            const std::size_t px = get(m_fproxy_map, fadj);
+            if (px == CGAL_VSA_INVALID_TAG || !is_flooding[px] || px == c.px)
+              continue;
+            const FT err = m_metric->compute_error(c.f, *m_ptm, m_proxies[px].px);
+            if (c.px == CGAL_VSA_INVALID_TAG || err < c.err || (err == c.err && px < c.px)) {
+              c.px = px;
+              c.err = err;
+            }
+          }
+          CGAL_assertion(c.px != CGAL_VSA_INVALID_TAG);
+          return true;
+        });
+
+      // if no frontier face is below the threshold, raise it to the error of the first eighth of the frontier
+      bool is_below_threshold = false;
+      for (const Face_to_integrate &c : candidates) {
+        if (!(threshold < c.err)) {
+          is_below_threshold = true;
+          break;
+        }
+      }
+      if (!is_below_threshold) {
+        errors.clear();
+        for (const Face_to_integrate &c : candidates)
+          errors.push_back(c.err);
+        const std::size_t k = nb_frontier / 8;
+        std::nth_element(errors.begin(), errors.begin() + k, errors.end());
+        threshold = errors[k];
+      }
+
+      // integrate the frontier faces below the threshold with a locally minimal error, ties broken by position
+      CGAL::for_each<CGAL::Parallel_tag>(CGAL::make_counting_range<std::size_t>(0, nb_frontier),
+        [&](const std::size_t i) -> bool {
+          if (threshold < candidates[i].err)
+            return true;
+          for(face_descriptor fadj : faces_around_face(halfedge(frontier[i], *m_ptm), *m_ptm)) {
+            if (fadj == null_face)
+              continue;
+            const auto slot_itr = frontier_slot.find(fadj);
+            if (slot_itr == frontier_slot.end())
+              continue;
+            const std::size_t j = slot_itr->second;
+            if (candidates[j].err < candidates[i].err
+                || (candidates[j].err == candidates[i].err && j < i))
+              return true;
+          }
+          to_integrate[i] = 1;
+          return true;
+        });
+
+      for (std::size_t i = 0; i < nb_frontier; ++i) {
+        if (to_integrate[i])
+          put(m_fproxy_map, candidates[i].f, candidates[i].px);
+      }
+
+      // next frontier: the remaining faces, then the tagged faces adjacent to the integrated ones
+      frontier.clear();
+      frontier_slot.clear();
+      for (std::size_t i = 0; i < nb_frontier; ++i) {
+        if (!to_integrate[i]) {
+          frontier_slot.emplace(candidates[i].f, frontier.size());
+          frontier.push_back(candidates[i].f);
+        }
+      }
+      for (std::size_t i = 0; i < nb_frontier; ++i) {
+        if (to_integrate[i])
+          expand_frontier(candidates[i].f);
+      }
+    }
+  }
+
   /*!
    * @brief refits and updates input range of proxies, sequential.
    * @tparam ProxyWrapperIterator forward iterator with Proxy_wrapper as value type
@@ -1237,7 +1372,6 @@ private:
     }
   }
 
-#ifdef CGAL_LINKED_WITH_TBB
   /*!
    * @brief refits and updates input range of proxies, parallel.
    * @tparam ProxyWrapperIterator forward iterator with Proxy_wrapper as value type
@@ -1253,15 +1387,14 @@ private:
       px_faces[get(m_fproxy_map, f)].push_back(f);
 
     // update proxy parameters and seed
-    tbb::parallel_for(tbb::blocked_range<ProxyWrapperIterator>(beg, end),
-      [&](tbb::blocked_range<ProxyWrapperIterator> &r) {
-        for (ProxyWrapperIterator pxw_itr = r.begin(); pxw_itr != r.end(); ++pxw_itr) {
-          const std::size_t px_idx = pxw_itr->idx;
-          *pxw_itr = fit_proxy_from_patch(px_faces[px_idx], px_idx);
-        }
+    CGAL::Iterator_range<ProxyWrapperIterator> pxws(beg, end);
+    CGAL::for_each<CGAL::Parallel_tag>(pxws,
+      [&](Proxy_wrapper &pxw) -> bool {
+        const std::size_t px_idx = pxw.idx;
+        pxw = fit_proxy_from_patch(px_faces[px_idx], px_idx);
+        return true;
       });
   }
-#endif // CGAL_LINKED_WITH_TBB
 
   /*!
    * @brief adds a proxy seed at the face with the maximum fitting error.
@@ -1480,7 +1613,11 @@ private:
     for(face_descriptor f : faces(*m_ptm))
       px_faces[get(m_fproxy_map, f)].push_back(f);
 
-    for(const std::list<face_descriptor>& px_patch : px_faces) {
+    m_px_planes.assign(px_faces.size(),
+      Proxy_plane(Plane_3(), CGAL::NULL_VECTOR, FT(0.0)));
+    CGAL::for_each<Concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, px_faces.size()),
+      [&](const std::size_t px_idx) -> bool {
+      const std::list<face_descriptor> &px_patch = px_faces[px_idx];
       Plane_3 fit_plane = if_pca_plane ?
         fit_plane_pca(px_patch.begin(), px_patch.end()) :
           fit_plane_area_averaged(px_patch.begin(), px_patch.end());
@@ -1504,15 +1641,20 @@ private:
       else
         norm = Vector_3(FT(0.0), FT(0.0), FT(1.0));
 
-      m_px_planes.push_back(Proxy_plane(fit_plane, norm, area));
-    }
+      m_px_planes[px_idx] = Proxy_plane(fit_plane, norm, area);
+      return true;
+    });
   }
 
   /*!
    * @brief finds the anchors.
    */
   void find_anchors() {
-    for(vertex_descriptor vtx : vertices(*m_ptm)) {
+    const std::vector<vertex_descriptor> vtxs(vertices(*m_ptm).begin(), vertices(*m_ptm).end());
+    std::vector<char> is_anchor(vtxs.size(), 0);
+    CGAL::for_each<Concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, vtxs.size()),
+      [&](const std::size_t i) -> bool {
+      const vertex_descriptor vtx = vtxs[i];
       std::size_t border_count = 0;
 
       for(halfedge_descriptor h : halfedges_around_target(vtx, *m_ptm)) {
@@ -1521,8 +1663,14 @@ private:
         else if (get(m_fproxy_map, face(h, *m_ptm)) != get(m_fproxy_map, face(opposite(h, *m_ptm), *m_ptm)))
           ++border_count;
       }
-      if (border_count >= 3)
-        attach_anchor(vtx);
+      is_anchor[i] = (border_count >= 3);
+      return true;
+    });
+
+    // anchors are attached in the vertex order
+    for (std::size_t i = 0; i < vtxs.size(); ++i) {
+      if (is_anchor[i])
+        attach_anchor(vtxs[i]);
     }
   }
 
@@ -2020,12 +2168,14 @@ private:
    * the anchor vertex to the incident proxy plane.
    */
   void optimize_anchor_location(bool optimize_boundary_anchor_location) {
-    for(Anchor& a : m_anchors) {
+    CGAL::for_each<Concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, m_anchors.size()),
+      [&](const std::size_t i) -> bool {
+      Anchor &a = m_anchors[i];
       const vertex_descriptor v = a.vtx;
 
       if(! optimize_boundary_anchor_location && is_border(v,*m_ptm)){
         a.pos  = m_vpoint_map[v];
-        continue;
+        return true;
       }
 
       // incident proxy set
@@ -2053,7 +2203,8 @@ private:
           scale_functor(vec, FT(1.0) / sum_area));
       else
         a.pos = vtx_pt;
-    }
+      return true;
+    });
   }
 
   /*!
@@ -0,0 +1,131 @@
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <vector>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/remesh.h>
+
+#include <CGAL/Variational_shape_approximation.h>
+#include <CGAL/Surface_mesh_approximation/L2_metric_plane_proxy.h>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::FT FT;
+
+typedef CGAL::Surface_mesh<Kernel::Point_3> Mesh;
+typedef boost::graph_traits<Mesh>::face_descriptor face_descriptor;
+
+typedef Mesh::Property_map<face_descriptor, std::size_t> Face_proxy_map;
+typedef boost::property_map<Mesh, boost::vertex_point_t>::type Vertex_point_map;
+
+typedef CGAL::Surface_mesh_approximation::L21_metric_plane_proxy<Mesh> L21_metric;
+typedef CGAL::Surface_mesh_approximation::L2_metric_plane_proxy<Mesh> L2_metric;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+struct Approximation_result
+{
+  FT error;
+  std::vector<std::size_t> proxy_ids;
+  std::vector<Kernel::Point_3> anchors;
+  std::vector<std::array<std::size_t, 3> > triangles;
+};
+
+template <typename Metric, typename ConcurrencyTag>
+Approximation_result approximate(Mesh &mesh, const std::size_t nb_proxies, const unsigned int seed)
+{
+  typedef CGAL::Variational_shape_approximation<Mesh, Vertex_point_map,
+    Metric, Kernel, ConcurrencyTag> Approximation;
+
+  const Vertex_point_map vpmap = get(boost::vertex_point, mesh);
+  Metric error_metric(mesh, vpmap);
+  Approximation approx(mesh, vpmap, error_metric);
+
+  // same random seeds, without relaxation
+  std::srand(seed);
+  approx.initialize_seeds(CGAL::parameters::seeding_method(CGAL::Surface_mesh_approximation::RANDOM)
+    .max_number_of_proxies(nb_proxies)
+    .number_of_relaxations(0));
+  assert(approx.number_of_proxies() == nb_proxies);
+
+  const FT first_error = approx.run(1);
+  Approximation_result result;
+  result.error = approx.run(10);
+  assert(result.error <= first_error);
+  CGAL_USE(first_error);
+
+  // a valid partition: each face is assigned to a proxy, and each proxy has a region
+  Face_proxy_map fpxmap =
+    mesh.add_property_map<face_descriptor, std::size_t>("f:proxy_id", 0).first;
+  approx.proxy_map(fpxmap);
+  std::vector<std::size_t> region_sizes(nb_proxies, 0);
+  for (face_descriptor f : faces(mesh)) {
+    assert(fpxmap[f] < nb_proxies);
+    ++region_sizes[fpxmap[f]];
+    result.proxy_ids.push_back(fpxmap[f]);
+  }
+  for (std::size_t s : region_sizes) {
+    assert(s > 0);
+    CGAL_USE(s);
+  }
+  mesh.remove_property_map(fpxmap);
+
+  approx.extract_mesh(CGAL::parameters::subdivision_ratio(1.0));
+  approx.output(CGAL::parameters::anchors(std::back_inserter(result.anchors))
+    .triangles(std::back_inserter(result.triangles)));
+  assert(!result.anchors.empty() && !result.triangles.empty());
+
+  return result;
+}
+
+template <typename Metric>
+void test(Mesh &mesh, const char *name)
+{
+  const std::size_t nb_proxies = 20;
+  const unsigned int nb_seeds = 4;
+  FT sequential_error(0.0);
+  for (unsigned int seed = 0; seed < nb_seeds; ++seed)
+    sequential_error += approximate<Metric, CGAL::Sequential_tag>(mesh, nb_proxies, seed).error;
+  std::cout << name << " sequential error: " << sequential_error / nb_seeds << std::endl;
+
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
+  // the parallel partition may differ slightly from the sequential one, and so may the local
+  // minimum reached from given seeds, but it is as good on average
+  FT parallel_error(0.0);
+  for (unsigned int seed = 0; seed < nb_seeds; ++seed)
+    parallel_error += approximate<Metric, CGAL::Parallel_tag>(mesh, nb_proxies, seed).error;
+  std::cout << name << " parallel error: " << parallel_error / nb_seeds << std::endl;
+  assert(parallel_error <= FT(1.05) * sequential_error);
+
+  // the parallel approximation is deterministic
+  const Approximation_result parallel = approximate<Metric, CGAL::Parallel_tag>(mesh, nb_proxies, 0);
+  const Approximation_result parallel_again = approximate<Metric, CGAL::Parallel_tag>(mesh, nb_proxies, 0);
+  assert(parallel.error == parallel_again.error);
+  assert(parallel.proxy_ids == parallel_again.proxy_ids);
+  assert(parallel.anchors == parallel_again.anchors);
+  assert(parallel.triangles == parallel_again.triangles);
+#endif
+}
+
+/**
+ * This file tests the approximation with the parallel concurrency tag.
+ */
+int main()
+{
+  Mesh mesh;
+  std::ifstream input(CGAL::data_file_path("meshes/sphere.off"));
+  if (!input || !(input >> mesh) || !CGAL::is_triangle_mesh(mesh)) {
+    std::cerr << "Invalid input file." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  PMP::isotropic_remeshing(faces(mesh), 0.05, mesh, CGAL::parameters::number_of_iterations(3));
+  std::cout << num_faces(mesh) << " faces" << std::endl;
+
+  test<L21_metric>(mesh, "L21");
+  test<L2_metric>(mesh, "L2");
+
+  return EXIT_SUCCESS;
+}
@@ -20,8 +20,11 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/config.h>
 #include <CGAL/Default.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
 #include <CGAL/tuple.h>
 #include <CGAL/Simple_cartesian.h>
+#include <CGAL/tags.h>
 #include <CGAL/Weights/cotangent_weights.h>
 
 #include <vector>
@@ -191,6 +194,13 @@ struct Types_selectors<TriangleMesh, VertexPointMap, CGAL::SRE_ARAP>
  /// `Deformation_Eigen_polar_closest_rotation_traits_3` is provided as default parameter.
  /// @tparam VPM a model of `ReadWritePropertyMap`</a>  with `Surface_mesh_deformation::vertex_descriptor` as key and a point as value type. The point type must be a model of `::RawPoint_3`.
  /// The default is `boost::property_map<TM, CGAL::vertex_point_t>::%type`.
+ /// @tparam ConcurrencyTag enables sequential versus parallel computation of the optimal rotations,
+ ///         of the right-hand sides of the linear systems and of the energy at each iteration.
+ ///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+ ///         With `SRE_ARAP`, the optimal rotations depend on the rotations of the neighbors computed
+ ///         during the same iteration and are always computed sequentially.
+ ///         The deformation is the same whatever the concurrency tag.
+ ///         The default is `Sequential_tag`.
 template <
   class TM,
   class VIM=Default,
@@ -199,7 +209,8 @@ template <
   class WC = Default,
   class ST = Default,
   class CR = Default,
-  class VPM = Default
+  class VPM = Default,
+  class ConcurrencyTag = Sequential_tag
   >
 class Surface_mesh_deformation
 {
@@ -296,7 +307,7 @@ public:
 /// @}
 
 private:
-  typedef Surface_mesh_deformation<TM, VIM, HIM, TAG, WC, ST, CR> Self;
+  typedef Surface_mesh_deformation<TM, VIM, HIM, TAG, WC, ST, CR, VPM, ConcurrencyTag> Self;
   // Repeat Triangle_mesh types
   typedef typename boost::graph_traits<Triangle_mesh>::in_edge_iterator    in_edge_iterator;
   typedef typename boost::graph_traits<Triangle_mesh>::out_edge_iterator   out_edge_iterator;
@@ -1196,52 +1207,60 @@ private:
   }
   void optimal_rotations_arap()
   {
-    Closest_rotation_traits cr_traits;
-    CR_matrix cov = cr_traits.zero_matrix();
+    // with SRE_ARAP, the covariance matrix of a vertex depends on the rotations
+    // of its neighbors, computed during the same iteration: keep it sequential
+    if(TAG == SRE_ARAP)
+    {
+      Closest_rotation_traits cr_traits;
+      for ( std::size_t k = 0; k < ros.size(); k++ )
+        optimal_rotation_arap(ros[k], cr_traits);
+      return;
+    }
 
     // only accumulate ros vertices
-    for ( std::size_t k = 0; k < ros.size(); k++ )
+    for_each_ros_vertex([&](vertex_descriptor vi)
     {
-      vertex_descriptor vi = ros[k];
-      std::size_t vi_id = ros_id(vi);
-      // compute covariance matrix (user manual eq:cov_matrix)
-      cov = cr_traits.zero_matrix();
-
-      in_edge_iterator e, e_end;
+      Closest_rotation_traits cr_traits;
+      optimal_rotation_arap(vi, cr_traits);
+    });
+  }
+  void optimal_rotation_arap(vertex_descriptor vi, Closest_rotation_traits& cr_traits)
+  {
+    std::size_t vi_id = ros_id(vi);
+    // compute covariance matrix (user manual eq:cov_matrix)
+    CR_matrix cov = cr_traits.zero_matrix();
 
-      arap_visitor.rotation_matrix_pre(vi, m_triangle_mesh);
+    in_edge_iterator e, e_end;
 
-      for (std::tie(e,e_end) = in_edges(vi, m_triangle_mesh); e != e_end; e++)
-      {
-        halfedge_descriptor he=halfedge(*e, m_triangle_mesh);
-        vertex_descriptor vj = source(he, m_triangle_mesh);
-        std::size_t vj_id = ros_id(vj);
+    arap_visitor.rotation_matrix_pre(vi, m_triangle_mesh);
 
-        const CR_vector& pij = sub_to_CR_vector(original[vi_id], original[vj_id]);
-        const CR_vector& qij = sub_to_CR_vector(solution[vi_id], solution[vj_id]);
-        double wij = hedge_weight[id(he)];
+    for (std::tie(e,e_end) = in_edges(vi, m_triangle_mesh); e != e_end; e++)
+    {
+      halfedge_descriptor he=halfedge(*e, m_triangle_mesh);
+      vertex_descriptor vj = source(he, m_triangle_mesh);
+      std::size_t vj_id = ros_id(vj);
 
-        cr_traits.add_scalar_t_vector_t_vector_transpose(cov, wij, pij, qij); // cov += wij * (pij * qij)
+      const CR_vector& pij = sub_to_CR_vector(original[vi_id], original[vj_id]);
+      const CR_vector& qij = sub_to_CR_vector(solution[vi_id], solution[vj_id]);
+      double wij = hedge_weight[id(he)];
 
-        if ( vj_id < rot_mtr.size() )
-          arap_visitor.update_covariance_matrix(cov, rot_mtr[vj_id]);
-      }
+      cr_traits.add_scalar_t_vector_t_vector_transpose(cov, wij, pij, qij); // cov += wij * (pij * qij)
 
-      cr_traits.compute_close_rotation(cov, rot_mtr[vi_id]);
+      if ( vj_id < rot_mtr.size() )
+        arap_visitor.update_covariance_matrix(cov, rot_mtr[vj_id]);
     }
+
+    cr_traits.compute_close_rotation(cov, rot_mtr[vi_id]);
   }
   void optimal_rotations_spokes_and_rims()
   {
-    Closest_rotation_traits cr_traits;
-    CR_matrix cov =cr_traits.zero_matrix();
-
     // only accumulate ros vertices
-    for ( std::size_t k = 0; k < ros.size(); k++ )
+    for_each_ros_vertex([&](vertex_descriptor vi)
     {
-      vertex_descriptor vi = ros[k];
+      Closest_rotation_traits cr_traits;
       std::size_t vi_id = ros_id(vi);
       // compute covariance matrix
-      cov = cr_traits.zero_matrix();
+      CR_matrix cov = cr_traits.zero_matrix();
 
       //iterate through all triangles
       out_edge_iterator e, e_end;
@@ -1268,7 +1287,7 @@ private:
       }
 
       cr_traits.compute_close_rotation(cov, rot_mtr[vi_id]);
-    }
+    });
   }
 
 #ifdef CGAL_DEFORM_MESH_USE_EXPERIMENTAL_SCALE
@@ -1322,12 +1341,10 @@ private:
     typename Sparse_linear_solver::Vector Y(ros.size()), By(ros.size());
     typename Sparse_linear_solver::Vector Z(ros.size()), Bz(ros.size());
 
-    Closest_rotation_traits cr_traits;
-
     // assemble right columns of linear system
-    for ( std::size_t k = 0; k < ros.size(); k++ )
+    for_each_ros_vertex([&](vertex_descriptor vi)
     {
-      vertex_descriptor vi = ros[k];
+      Closest_rotation_traits cr_traits;
       std::size_t vi_id = ros_id(vi);
 
       if ( is_roi_vertex(vi) && !is_control_vertex(vi) )
@@ -1362,7 +1379,7 @@ private:
       {// constrained vertex
         Bx[vi_id] = solution[vi_id][0]; By[vi_id] = solution[vi_id][1]; Bz[vi_id] = solution[vi_id][2];
       }
-    }
+    });
 
     // solve "A*X = B".
     bool is_all_solved = m_solver.linear_solver(Bx, X) && m_solver.linear_solver(By, Y) && m_solver.linear_solver(Bz, Z);
@@ -1386,12 +1403,10 @@ private:
     typename Sparse_linear_solver::Vector Y(ros.size()), By(ros.size());
     typename Sparse_linear_solver::Vector Z(ros.size()), Bz(ros.size());
 
-    Closest_rotation_traits cr_traits;
-
     // assemble right columns of linear system
-    for ( std::size_t k = 0; k < ros.size(); k++ )
+    for_each_ros_vertex([&](vertex_descriptor vi)
     {
-      vertex_descriptor vi = ros[k];
+      Closest_rotation_traits cr_traits;
       std::size_t vi_id = ros_id(vi);
 
       if ( is_roi_vertex(vi) && !is_control_vertex(vi) )
@@ -1433,7 +1448,7 @@ private:
       {// constrained vertices
         Bx[vi_id] = solution[vi_id][0]; By[vi_id] = solution[vi_id][1]; Bz[vi_id] = solution[vi_id][2];
       }
-    }
+    });
     // solve "A*X = B".
     bool is_all_solved = m_solver.linear_solver(Bx, X) && m_solver.linear_solver(By, Y) && m_solver.linear_solver(Bz, Z);
     if(!is_all_solved) {
@@ -1477,15 +1492,13 @@ private:
   }
   double energy_arap() const
   {
-    Closest_rotation_traits cr_traits;
-
-    double sum_of_energy = 0;
     // only accumulate ros vertices
-    for( std::size_t k = 0; k < ros.size(); k++ )
+    return sum_over_ros_vertices([&](vertex_descriptor vi)
     {
-      vertex_descriptor vi = ros[k];
+      Closest_rotation_traits cr_traits;
       std::size_t vi_id = ros_id(vi);
 
+      double sum_of_energy = 0;
       in_edge_iterator e, e_end;
       for (std::tie(e,e_end) = in_edges(vi, m_triangle_mesh); e != e_end; e++)
       {
@@ -1501,19 +1514,18 @@ private:
         sum_of_energy += wij * cr_traits.squared_norm_vector_scalar_vector_subs(qij, rot_mtr[vi_id], pij);
         // sum_of_energy += wij * ( qij - rot_mtr[vi_id]*pij )^2
       }
-    }
-    return sum_of_energy;
+      return sum_of_energy;
+    });
   }
   double energy_spokes_and_rims() const
   {
-    Closest_rotation_traits cr_traits;
-
-    double sum_of_energy = 0;
     // only accumulate ros vertices
-    for( std::size_t k = 0; k < ros.size(); k++ )
+    return sum_over_ros_vertices([&](vertex_descriptor vi)
     {
-      vertex_descriptor vi = ros[k];
+      Closest_rotation_traits cr_traits;
       std::size_t vi_id = ros_id(vi);
+
+      double sum_of_energy = 0;
       //iterate through all triangles
       out_edge_iterator e, e_end;
       for (std::tie(e,e_end) = out_edges(vi, m_triangle_mesh); e != e_end; e++)
@@ -1537,8 +1549,40 @@ private:
 
         } while( (hedge_around_facet = next(hedge_around_facet, m_triangle_mesh)) != he);
       }
-    }
-    return sum_of_energy;
+      return sum_of_energy;
+    });
+  }
+
+  /// Calls `f(vi)` for each ros vertex `vi`, concurrently if `ConcurrencyTag` is `Parallel_tag`.
+  /// `f` must only write data that is specific to `vi`.
+  template <class Functor>
+  void for_each_ros_vertex(const Functor& f) const
+  {
+    CGAL::for_each<ConcurrencyTag>(ros, [&](vertex_descriptor vi) -> bool
+                                   {
+                                     f(vi);
+                                     return true;
+                                   });
+  }
+
+  /// Returns the sum of `f(vi)` over the ros vertices `vi`.
+  /// The terms are computed concurrently if `ConcurrencyTag` is `Parallel_tag`,
+  /// but always summed in the same order, so that the result does not depend on `ConcurrencyTag`.
+  template <class Functor>
+  double sum_over_ros_vertices(const Functor& f) const
+  {
+    std::vector<double> terms(ros.size());
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, ros.size()),
+                                   [&](std::size_t k) -> bool
+                                   {
+                                     terms[k] = f(ros[k]);
+                                     return true;
+                                   });
+
+    double sum = 0;
+    for(double t : terms)
+      sum += t;
+    return sum;
   }
 
   void need_preprocess_both()
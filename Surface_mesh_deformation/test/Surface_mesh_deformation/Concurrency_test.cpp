@@ -0,0 +1,76 @@
+#include "Surface_mesh_deformation_test_commons.h"
+#include <vector>
+#include <iostream>
+#include <fstream>
+
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Surface_mesh_deformation.h>
+
+typedef CGAL::Simple_cartesian<double>   Kernel;
+typedef CGAL::Surface_mesh<Kernel::Point_3>  Mesh;
+
+typedef boost::graph_traits<Mesh>::vertex_descriptor    vertex_descriptor;
+
+template <CGAL::Deformation_algorithm_tag TAG, class ConcurrencyTag>
+void deform(Mesh& mesh, unsigned int iterations, double tolerance)
+{
+  typedef CGAL::Surface_mesh_deformation<Mesh, CGAL::Default, CGAL::Default, TAG,
+                                         CGAL::Default, CGAL::Default, CGAL::Default, CGAL::Default,
+                                         ConcurrencyTag> Deform_mesh;
+
+  Deform_mesh deform_mesh(mesh);
+  std::vector<vertex_descriptor> hg =
+    read_rois(deform_mesh, "data/Symmetry_test_roi.txt", "data/Symmetry_test_handle.txt");
+
+  bool is_preprocessed = deform_mesh.preprocess();
+  assert(is_preprocessed);
+  CGAL_USE(is_preprocessed);
+
+  deform_mesh.translate(hg.begin(), hg.end(), Kernel::Vector_3(-0.45, -0.65, 0.));
+  deform_mesh.deform(iterations, tolerance);
+}
+
+// The deformation must not depend on the concurrency tag
+template <CGAL::Deformation_algorithm_tag TAG>
+void test(const Mesh& mesh, const char* name)
+{
+  std::cerr << name << std::endl;
+
+  const double tolerances[] = { 0., 1e-4 };
+  for(double tolerance : tolerances)
+  {
+    Mesh sequential_mesh = mesh;
+    deform<TAG, CGAL::Sequential_tag>(sequential_mesh, 20, tolerance);
+
+    bool moved = false;
+    for(vertex_descriptor v : vertices(mesh))
+      if(mesh.point(v) != sequential_mesh.point(v))
+        moved = true;
+    assert(moved);
+    CGAL_USE(moved);
+
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
+    Mesh parallel_mesh = mesh;
+    deform<TAG, CGAL::Parallel_tag>(parallel_mesh, 20, tolerance);
+
+    for(vertex_descriptor v : vertices(mesh))
+      assert(sequential_mesh.point(v) == parallel_mesh.point(v));
+#endif
+  }
+}
+
+int main()
+{
+  Mesh mesh;
+  std::ifstream input("data/square.off");
+  input >> mesh;
+  assert(input && !is_empty(mesh));
+
+  test<CGAL::ORIGINAL_ARAP>(mesh, "ORIGINAL_ARAP");
+  test<CGAL::SPOKES_AND_RIMS>(mesh, "SPOKES_AND_RIMS");
+  test<CGAL::SRE_ARAP>(mesh, "SRE_ARAP");
+
+  std::cerr << "All done!" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -18,6 +18,8 @@
 
 #include <CGAL/Surface_mesh_parameterization/internal/Bool_property_map.h>
 #include <CGAL/Surface_mesh_parameterization/internal/Containers_filler.h>
+#include <CGAL/Surface_mesh_parameterization/internal/Factorized_solver.h>
+#include <CGAL/Surface_mesh_parameterization/internal/Hash_map_property_map.h>
 #include <CGAL/Surface_mesh_parameterization/internal/kernel_traits.h>
 #include <CGAL/Surface_mesh_parameterization/internal/validity.h>
 #include <CGAL/Surface_mesh_parameterization/IO/File_off.h>
@@ -42,7 +44,10 @@
 #include <CGAL/basic.h>
 #include <CGAL/circulator.h>
 #include <CGAL/Default.h>
+#include <CGAL/for_each.h>
 #include <CGAL/number_utils.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 
 // Below are two macros that can be used to improve the accuracy of optimal Lt
 // matrices.
@@ -84,6 +89,7 @@
 #include <boost/iterator/function_output_iterator.hpp>
 #include <boost/functional/hash.hpp>
 
+#include <atomic>
 #include <unordered_set>
 #include <iostream>
 #include <fstream>
@@ -99,7 +105,6 @@
 // @todo Handle the case cot = 0 with a local parameterization aligned with the axes
 //       (this produces C2=0 which is problematic to compute a & b)
 // @todo Add distortion measures
-// @todo Parallelize the local phase?
 
 namespace CGAL {
 
@@ -160,13 +165,24 @@ namespace Surface_mesh_parameterization {
 ///   CGAL::Eigen_solver_traits<
 ///           Eigen::UmfPackLU<Eigen_sparse_matrix<double>::EigenType> >
 /// \endcode
+///         The matrix of the linear system is the same at each iteration: if the solver
+///         traits provide the functions `factor()` and `linear_solver(B, X)`,
+///         it is factored only once.
+///
+/// \tparam ConcurrencyTag_ enables sequential versus parallel assembly of the linear system
+///         and computation of the local (per face) transformations and energies.
+///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+///         The result does not depend on this parameter.
+///         With `Parallel_tag`, the property maps passed to `parameterize()` are read concurrently.<br>
+///         <b>%Default:</b> `Sequential_tag`
 ///
 /// \sa `CGAL::Surface_mesh_parameterization::Fixed_border_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>`
 /// \sa `CGAL::Surface_mesh_parameterization::Iterative_authalic_parameterizer_3<TriangleMesh, BorderParameterizer, SolverTraits>`
 ///
 template < class TriangleMesh_,
            class BorderParameterizer_ = Default,
-           class SolverTraits_ = Default>
+           class SolverTraits_ = Default,
+           class ConcurrencyTag_ = Sequential_tag>
 class ARAP_parameterizer_3
 {
 public:
@@ -210,6 +226,9 @@ public:
 
   typedef TriangleMesh_                                       TriangleMesh;
 
+  /// Concurrency tag type
+  typedef ConcurrencyTag_                                     Concurrency_tag;
+
   /// Mesh halfedge type
   typedef typename boost::graph_traits<Triangle_mesh>::halfedge_descriptor  halfedge_descriptor;
 
@@ -237,6 +256,7 @@ private:
   // Solver traits subtypes:
   typedef typename Solver_traits::Vector                            Vector;
   typedef typename Solver_traits::Matrix                            Matrix;
+  typedef internal::Factorized_solver<Solver_traits>                Factorized_solver;
 
   // Memory maps
     // Each triangle is associated a linear transformation matrix
@@ -244,21 +264,24 @@ private:
   typedef CGAL::Unique_hash_map<face_descriptor,
                                 Lt_matrix,
                                 boost::hash<face_descriptor> >      Lt_hash_map;
-  typedef boost::associative_property_map<Lt_hash_map>              Lt_map;
+  typedef internal::Hash_map_property_map<Lt_hash_map>  Lt_map;
 
     // Each angle (uniquely determined by the opposite half edge) has a cotangent
   typedef CGAL::Unique_hash_map<halfedge_descriptor, NT,
                                 boost::hash<halfedge_descriptor> >  Cot_hm;
-  typedef boost::associative_property_map<Cot_hm>                   Cot_map;
+  typedef internal::Hash_map_property_map<Cot_hm>       Cot_map;
 
     // Each face has a local 2D isometric parameterization
   typedef std::pair<int, int>                                       Local_indices;
   typedef CGAL::Unique_hash_map<halfedge_descriptor,
                                 Local_indices,
                                 boost::hash<halfedge_descriptor> >  Lp_hm;
-  typedef boost::associative_property_map<Lp_hm>                    Lp_map;
+  typedef internal::Hash_map_property_map<Lp_hm>        Lp_map;
   typedef std::vector<Point_2>                                      Local_points;
 
+    // Non-zero coefficients of a line of the matrix A
+  typedef std::vector<std::pair<int, NT> >                          Matrix_row;
+
 // Private fields
 private:
   // %Object that maps (at least two) border vertices onto a 2D space
@@ -500,15 +523,15 @@ private:
     return weight;
   }
 
-  // Compute the line i of matrix A
+  // Compute the line i of matrix A, as the list of its (column, coefficient) pairs
   // - call compute_w_ij() to compute the A coefficient w_ij for each neighbor v_j.
   // - compute w_ii = - sum of w_ijs.
   //
   // \pre Vertices must be indexed.
   // \pre Vertex i mustn't be already parameterized.
-  // \pre Line i of A must contain only zeros.
+  // \pre `row` must be empty.
   template <typename VertexIndexMap>
-  Error_code fill_linear_system_matrix(Matrix& A,
+  Error_code fill_linear_system_matrix(Matrix_row& row,
                                        const Triangle_mesh& mesh,
                                        vertex_descriptor vertex,
                                        const Cot_map ct_map,
@@ -535,7 +558,7 @@ private:
       int j = get(vimap, v_j);
 
       // Set w_ij in matrix
-      A.set_coef(i, j, w_ij, true /*new*/);
+      row.emplace_back(j, w_ij);
       vertexIndex++;
     }
 
@@ -543,7 +566,7 @@ private:
       return ERROR_NON_TRIANGULAR_MESH;
 
     // Set w_ii in matrix
-    A.set_coef(i, i, w_ii, true /*new*/);
+    row.emplace_back(i, w_ii);
     return OK;
   }
 
@@ -558,21 +581,37 @@ private:
                                  VertexParameterizedMap vpmap,
                                  Matrix& A) const
   {
-    Error_code status = OK;
+    // compute the lines of A independently...
+    const std::vector<vertex_descriptor> vds(vertices.begin(), vertices.end());
+    std::vector<Matrix_row> rows(vds.size());
+    std::atomic<bool> non_triangular(false);
 
-    // compute A
-    for(vertex_descriptor vd : vertices) {
+    CGAL::for_each<Concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, vds.size()),
+      [&](const std::size_t k) -> bool
+    {
+      const vertex_descriptor vd = vds[k];
       if(!get(vpmap, vd)) { // not yet parameterized
         // Compute the line i of the matrix A
-        status = fill_linear_system_matrix(A, mesh, vd, ctmap, vimap);
-        if(status != OK)
-          return status;
+        if(fill_linear_system_matrix(rows[k], mesh, vd, ctmap, vimap) != OK)
+          non_triangular = true;
       } else { // fixed vertices
         int index = get(vimap, vd);
-        A.set_coef(index, index, 1, true /*new*/);
+        rows[k].emplace_back(index, NT(1));
       }
+      return true;
+    });
+
+    if(non_triangular)
+      return ERROR_NON_TRIANGULAR_MESH;
+
+    // ... and set them in A
+    for(std::size_t k=0; k<vds.size(); ++k) {
+      int i = get(vimap, vds[k]);
+      for(const std::pair<int, NT>& coef : rows[k])
+        A.set_coef(i, coef.first, coef.second, true /*new*/);
     }
-    return status;
+
+    return OK;
   }
 
   // Solves the cubic equation a3 x^3 + a2 x^2 + a1 x + a0 = 0.
@@ -757,102 +796,118 @@ private:
     return index_arg;
   }
 
-  // Compute the optimal values of the linear transformation matrices Lt.
+  // Compute the optimal value of the linear transformation matrix Lt of a face.
   template <typename VertexUVMap>
-  Error_code compute_optimal_Lt_matrices(const Triangle_mesh& mesh,
-                                         const Faces_vector& faces,
-                                         const Cot_map ctmap,
-                                         const Local_points& lp,
-                                         const Lp_map lpmap,
-                                         const VertexUVMap uvmap,
-                                         Lt_map ltmap) const
+  Lt_matrix compute_optimal_Lt_matrix(const Triangle_mesh& mesh,
+                                      face_descriptor fd,
+                                      const Cot_map ctmap,
+                                      const Local_points& lp,
+                                      const Lp_map lpmap,
+                                      const VertexUVMap uvmap) const
   {
-    Error_code status = OK;
+    // Compute the coefficients C1, C2, C3
+    NT C1 = 0., C2 = 0., C3 = 0.;
 
-    for(face_descriptor fd : faces) {
-      // Compute the coefficients C1, C2, C3
-      NT C1 = 0., C2 = 0., C3 = 0.;
-
-      halfedge_around_face_circulator hc(halfedge(fd, mesh), mesh), end(hc);
-      CGAL_For_all(hc, end) {
-        halfedge_descriptor hd = *hc;
-        NT c = get(ctmap, hd);
-
-        // UV positions
-        const Point_2& uvpi = get(uvmap, source(hd, mesh));
-        const Point_2& uvpj = get(uvmap, target(hd, mesh));
-        NT diff_x = uvpi.x() - uvpj.x();
-        NT diff_y = uvpi.y() - uvpj.y();
+    halfedge_around_face_circulator hc(halfedge(fd, mesh), mesh), end(hc);
+    CGAL_For_all(hc, end) {
+      halfedge_descriptor hd = *hc;
+      NT c = get(ctmap, hd);
+
+      // UV positions
+      const Point_2& uvpi = get(uvmap, source(hd, mesh));
+      const Point_2& uvpj = get(uvmap, target(hd, mesh));
+      NT diff_x = uvpi.x() - uvpj.x();
+      NT diff_y = uvpi.y() - uvpj.y();
 //        CGAL_warning(diff_x == 0. && diff_y == 0.);
 
-        // local positions (in the isometric 2D param)
-        const Local_indices& li = get(lpmap, hd);
-        const Point_2& ppi = lp[ li.first ];
-        const Point_2& ppj = lp[ li.second ];
-        NT p_diff_x = ppi.x() - ppj.x();
-        NT p_diff_y = ppi.y() - ppj.y();
-        CGAL_precondition(p_diff_x != 0. || p_diff_y != 0.);
-
-        C1 += c * ( p_diff_x*p_diff_x + p_diff_y*p_diff_y );
-        C2 += c * ( diff_x*p_diff_x + diff_y*p_diff_y );
-        C3 += c * ( diff_x*p_diff_y - diff_y*p_diff_x );
-      }
+      // local positions (in the isometric 2D param)
+      const Local_indices& li = get(lpmap, hd);
+      const Point_2& ppi = lp[ li.first ];
+      const Point_2& ppj = lp[ li.second ];
+      NT p_diff_x = ppi.x() - ppj.x();
+      NT p_diff_y = ppi.y() - ppj.y();
+      CGAL_precondition(p_diff_x != 0. || p_diff_y != 0.);
 
-      // Compute a and b
-      NT a = 0., b = 0.;
+      C1 += c * ( p_diff_x*p_diff_x + p_diff_y*p_diff_y );
+      C2 += c * ( diff_x*p_diff_x + diff_y*p_diff_y );
+      C3 += c * ( diff_x*p_diff_y - diff_y*p_diff_x );
+    }
 
-      if(m_lambda == 0.) { // ASAP
-        CGAL_precondition(C1 != 0.);
-        a = C2 / C1;
-        b = C3 / C1;
-      }
-      else if( std::abs(C1) < m_lambda_tolerance * m_lambda &&
-               std::abs(C2) < m_lambda_tolerance * m_lambda ) { // ARAP
-        // If lambda is large compared to C1 and C2, the cubic equation that
-        // determines a and b can be simplified to a simple quadric equation
-
-        CGAL_precondition(C2*C2 + C3*C3 != 0.);
-        NT denom = 1. / CGAL::sqrt(C2*C2 + C3*C3);
-        a = C2 * denom;
-        b = C3 * denom;
-      }
-      else { // general case
+    // Compute a and b
+    NT a = 0., b = 0.;
+
+    if(m_lambda == 0.) { // ASAP
+      CGAL_precondition(C1 != 0.);
+      a = C2 / C1;
+      b = C3 / C1;
+    }
+    else if( std::abs(C1) < m_lambda_tolerance * m_lambda &&
+             std::abs(C2) < m_lambda_tolerance * m_lambda ) { // ARAP
+      // If lambda is large compared to C1 and C2, the cubic equation that
+      // determines a and b can be simplified to a simple quadric equation
+
+      CGAL_precondition(C2*C2 + C3*C3 != 0.);
+      NT denom = 1. / CGAL::sqrt(C2*C2 + C3*C3);
+      a = C2 * denom;
+      b = C3 * denom;
+    }
+    else { // general case
 #ifdef CGAL_SMP_SOLVE_CUBIC_EQUATION
-        CGAL_precondition(C2 != 0.);
-        NT C2_denom = 1. / C2;
-        NT a3_coeff = 2. * m_lambda * (C2 * C2 + C3 * C3) * C2_denom * C2_denom;
+      CGAL_precondition(C2 != 0.);
+      NT C2_denom = 1. / C2;
+      NT a3_coeff = 2. * m_lambda * (C2 * C2 + C3 * C3) * C2_denom * C2_denom;
 
-        std::vector<NT> roots;
+      std::vector<NT> roots;
 #ifdef CGAL_SMP_SOLVE_EQUATIONS_WITH_GMP
-        solve_cubic_equation_with_AK(a3_coeff, 0., (C1 - 2. * m_lambda), -C2, roots);
+      solve_cubic_equation_with_AK(a3_coeff, 0., (C1 - 2. * m_lambda), -C2, roots);
 #else // !CGAL_SMP_SOLVE_EQUATIONS_WITH_GMP
-        solve_cubic_equation(a3_coeff, 0., (C1 - 2. * m_lambda), -C2, roots);
+      solve_cubic_equation(a3_coeff, 0., (C1 - 2. * m_lambda), -C2, roots);
 #endif
-        std::size_t ind = compute_root_with_lowest_energy(mesh, fd,
-                                                          ctmap, lp, lpmap, uvmap,
-                                                          C2_denom, C3, roots);
+      std::size_t ind = compute_root_with_lowest_energy(mesh, fd,
+                                                        ctmap, lp, lpmap, uvmap,
+                                                        C2_denom, C3, roots);
 
-        a = roots[ind];
-        b = C3 * C2_denom * a;
+      a = roots[ind];
+      b = C3 * C2_denom * a;
 #else // !CGAL_SMP_SOLVE_CUBIC_EQUATION, solve the bivariate system
-        std::vector<NT> a_roots;
-        std::vector<NT> b_roots;
-        solve_bivariate_system(C1, C2, C3, a_roots, b_roots);
-
-        std::size_t ind = compute_root_with_lowest_energy(mesh, fd,
-                                                          ctmap, lp, lpmap, uvmap,
-                                                          a_roots, b_roots);
-        a = a_roots[ind];
-        b = b_roots[ind];
+      std::vector<NT> a_roots;
+      std::vector<NT> b_roots;
+      solve_bivariate_system(C1, C2, C3, a_roots, b_roots);
+
+      std::size_t ind = compute_root_with_lowest_energy(mesh, fd,
+                                                        ctmap, lp, lpmap, uvmap,
+                                                        a_roots, b_roots);
+      a = a_roots[ind];
+      b = b_roots[ind];
 #endif
-      }
-
-      // Update the map faces --> optimal Lt matrices
-      Lt_matrix ltm = std::make_pair(a, b);
-      put(ltmap, fd, ltm);
     }
 
-    return status;
+    return std::make_pair(a, b);
+  }
+
+  // Compute the optimal values of the linear transformation matrices Lt.
+  template <typename VertexUVMap>
+  Error_code compute_optimal_Lt_matrices(const Triangle_mesh& mesh,
+                                         const Faces_vector& faces,
+                                         const Cot_map ctmap,
+                                         const Local_points& lp,
+                                         const Lp_map lpmap,
+                                         const VertexUVMap uvmap,
+                                         Lt_map ltmap) const
+  {
+    std::vector<Lt_matrix> ltms(faces.size());
+    CGAL::for_each<Concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, faces.size()),
+      [&](const std::size_t k) -> bool
+    {
+      ltms[k] = compute_optimal_Lt_matrix(mesh, faces[k], ctmap, lp, lpmap, uvmap);
+      return true;
+    });
+
+    // Update the map faces --> optimal Lt matrices
+    for(std::size_t k=0; k<faces.size(); ++k)
+      put(ltmap, faces[k], ltms[k]);
+
+    return OK;
   }
 
   // Computes the coordinates of the vertices p0, p1, p2
@@ -1076,27 +1131,36 @@ private:
                          Vector& Bu, Vector& Bv) const
   {
     // Initialize the right hand side B in the linear system "A*X = B"
-    Error_code status = OK;
+    const std::vector<vertex_descriptor> vds(vertices.begin(), vertices.end());
+    std::atomic<bool> non_triangular(false);
 
-    for(vertex_descriptor vd : vertices) {
+    // each vertex sets its own lines of Bu and Bv
+    CGAL::for_each<Concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, vds.size()),
+      [&](const std::size_t k) -> bool
+    {
+      const vertex_descriptor vd = vds[k];
       if(!get(vpmap, vd)) { // not yet parameterized
         // Compute the lines i of the vectors Bu and Bv
-        status = fill_linear_system_rhs(mesh, vd, ctmap, lp, lpmap,
-                                                  ltmap, vimap, Bu, Bv);
-        if(status != OK)
-          return status;
+        if(fill_linear_system_rhs(mesh, vd, ctmap, lp, lpmap,
+                                  ltmap, vimap, Bu, Bv) != OK)
+          non_triangular = true;
       } else { // fixed vertices
         int index = get(vimap, vd);
         const Point_2& uv = get(uvmap, vd);
         Bu.set(index, uv.x());
         Bv.set(index, uv.y());
       }
-    }
-    return status;
+      return true;
+    });
+
+    if(non_triangular)
+      return ERROR_NON_TRIANGULAR_MESH;
+
+    return OK;
   }
 
   // Compute the right hand side and solve the linear system to obtain the
-  // new UV coordinates.
+  // new UV coordinates. The (constant) matrix of the system has been factored in `solver`.
   template <typename VertexUVMap,
             typename VertexIndexMap,
             typename VertexParameterizedMap>
@@ -1109,7 +1173,7 @@ private:
                              VertexUVMap uvmap,
                              VertexIndexMap vimap,
                              VertexParameterizedMap vpmap,
-                             const Matrix& A)
+                             Factorized_solver& solver)
   {
     Error_code status = OK;
 
@@ -1126,8 +1190,7 @@ private:
     // Solve "A*Xu = Bu". On success, the solution is (1/Du) * Xu.
     // Solve "A*Xv = Bv". On success, the solution is (1/Dv) * Xv.
     double Du, Dv;
-    if(!get_linear_algebra_traits().linear_solver(A, Bu, Xu, Du) ||
-       !get_linear_algebra_traits().linear_solver(A, Bv, Xv, Dv)) {
+    if(!solver.solve(Bu, Xu, Du) || !solver.solve(Bv, Xv, Dv)) {
       std::cerr << "Could not solve linear system" << std::endl;
       status = ERROR_CANNOT_SOLVE_LINEAR_SYSTEM;
       return status;
@@ -1224,13 +1287,19 @@ private:
                             const Lt_map ltmap,
                             const VertexUVMap uvmap) const
   {
-    NT E = 0.;
+    std::vector<NT> face_energies(faces.size());
+    CGAL::for_each<Concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, faces.size()),
+      [&](const std::size_t k) -> bool
+    {
+      face_energies[k] = compute_current_face_energy(mesh, faces[k], ctmap, lp, lpmap,
+                                                     ltmap, uvmap);
+      return true;
+    });
 
-    for(face_descriptor fd : faces) {
-      NT Ef = compute_current_face_energy(mesh, fd, ctmap, lp, lpmap,
-                                          ltmap, uvmap);
+    // the sum is sequential, so that the energy does not depend on the concurrency tag
+    NT E = 0.;
+    for(const NT Ef : face_energies)
       E += Ef;
-    }
 
     E *= 0.5;
     return E;
@@ -1361,6 +1430,13 @@ public:
     if(status != OK)
       return status;
 
+    // ... and factored once
+    Factorized_solver solver(get_linear_algebra_traits());
+    if(!solver.factor(A)) {
+      std::cerr << "Could not solve linear system" << std::endl;
+      return ERROR_CANNOT_SOLVE_LINEAR_SYSTEM;
+    }
+
     NT energy_this = compute_current_energy(mesh, faces, ctmap, lp, lpmap,
                                             ltmap, uvmap);
     NT energy_last;
@@ -1376,7 +1452,7 @@ public:
     {
       compute_optimal_Lt_matrices(mesh, faces, ctmap, lp, lpmap, uvmap, ltmap);
       status = update_solution(mesh, vertices, ctmap, lp, lpmap, ltmap,
-                                               uvmap, vimap, vpmap, A);
+                                               uvmap, vimap, vpmap, solver);
 
       // Output the current parameterization
 #ifdef CGAL_SMP_ARAP_DEBUG
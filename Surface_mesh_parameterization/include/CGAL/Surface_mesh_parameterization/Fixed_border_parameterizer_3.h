@@ -17,6 +17,7 @@
 #include <CGAL/disable_warnings.h>
 
 #include <CGAL/Surface_mesh_parameterization/internal/Containers_filler.h>
+#include <CGAL/Surface_mesh_parameterization/internal/Factorized_solver.h>
 #include <CGAL/Surface_mesh_parameterization/internal/kernel_traits.h>
 #include <CGAL/Surface_mesh_parameterization/Error_code.h>
 #include <CGAL/Surface_mesh_parameterization/Circular_border_parameterizer_3.h>
@@ -268,8 +269,7 @@ public:
     // Solve "A*Xu = Bu". On success, solution is (1/Du) * Xu.
     // Solve "A*Xv = Bv". On success, solution is (1/Dv) * Xv.
     double Du = 0, Dv = 0;
-    if(!get_linear_algebra_traits().linear_solver(A, Bu, Xu, Du) ||
-       !get_linear_algebra_traits().linear_solver(A, Bv, Xv, Dv))
+    if(!internal::solve_uv_systems(get_linear_algebra_traits(), A, Bu, Bv, Xu, Xv, Du, Dv))
     {
       status = ERROR_CANNOT_SOLVE_LINEAR_SYSTEM;
     }
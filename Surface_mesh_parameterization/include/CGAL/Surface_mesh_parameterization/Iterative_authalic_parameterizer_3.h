@@ -23,6 +23,7 @@
 
 #include <CGAL/Surface_mesh_parameterization/internal/Bool_property_map.h>
 #include <CGAL/Surface_mesh_parameterization/internal/Containers_filler.h>
+#include <CGAL/Surface_mesh_parameterization/internal/Factorized_solver.h>
 #include <CGAL/Surface_mesh_parameterization/internal/kernel_traits.h>
 #include <CGAL/Surface_mesh_parameterization/IO/File_off.h>
 #include <CGAL/Surface_mesh_parameterization/Error_code.h>
@@ -930,8 +931,7 @@ public:
       // Solve "A*Xu = Bu". On success, solution is (1/Du) * Xu.
       // Solve "A*Xv = Bv". On success, solution is (1/Dv) * Xv.
       double Du = 0, Dv = 0;
-      if(!get_linear_algebra_traits().linear_solver(A, Bu, Xu, Du) ||
-         !get_linear_algebra_traits().linear_solver(A, Bv, Xv, Dv))
+      if(!internal::solve_uv_systems(get_linear_algebra_traits(), A, Bu, Bv, Xu, Xv, Du, Dv))
       {
         if(CGAL_SMP_IA_DEBUG_L0)
           std::cout << " Linear solver failure #" << m_linear_solver_failures << std::endl;
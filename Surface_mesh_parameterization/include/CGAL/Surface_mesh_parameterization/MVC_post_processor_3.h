@@ -16,6 +16,7 @@
 
 #include <CGAL/Surface_mesh_parameterization/internal/Bool_property_map.h>
 #include <CGAL/Surface_mesh_parameterization/internal/Containers_filler.h>
+#include <CGAL/Surface_mesh_parameterization/internal/Factorized_solver.h>
 #include <CGAL/Surface_mesh_parameterization/internal/kernel_traits.h>
 
 #include <CGAL/Surface_mesh_parameterization/Two_vertices_parameterizer_3.h>
@@ -599,8 +600,7 @@ private:
     Error_code status = OK;
 
     double Du, Dv;
-    if(!get_linear_algebra_traits().linear_solver(A, Bu, Xu, Du) ||
-       !get_linear_algebra_traits().linear_solver(A, Bv, Xv, Dv)) {
+    if(!internal::solve_uv_systems(get_linear_algebra_traits(), A, Bu, Bv, Xu, Xv, Du, Dv)) {
       status = ERROR_CANNOT_SOLVE_LINEAR_SYSTEM;
     }
 
@@ -0,0 +1,125 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_SURFACE_MESH_PARAMETERIZATION_INTERNAL_FACTORIZED_SOLVER_H
+#define CGAL_SURFACE_MESH_PARAMETERIZATION_INTERNAL_FACTORIZED_SOLVER_H
+
+#include <CGAL/license/Surface_mesh_parameterization.h>
+
+#include <CGAL/assertions.h>
+
+#include <type_traits>
+#include <utility>
+
+namespace CGAL {
+
+namespace Surface_mesh_parameterization {
+
+namespace internal {
+
+// Detects whether the solver traits can factor a matrix once and then solve
+// for several right hand sides (`factor(A, D)` and `linear_solver(B, X)`),
+// as `Eigen_solver_traits` does with a direct solver.
+template <typename SolverTraits, typename = void>
+struct Has_factor
+  : public std::false_type
+{ };
+
+template <typename SolverTraits>
+struct Has_factor<SolverTraits,
+                  std::void_t<decltype(std::declval<SolverTraits&>().factor(
+                                         std::declval<const typename SolverTraits::Matrix&>(),
+                                         std::declval<double&>())),
+                              decltype(std::declval<SolverTraits&>().linear_solver(
+                                         std::declval<const typename SolverTraits::Vector&>(),
+                                         std::declval<typename SolverTraits::Vector&>()))> >
+  : public std::true_type
+{ };
+
+// Solves several sparse linear systems "A*X = B" sharing the same matrix `A`.
+// If the solver traits support it, `A` is factored once in `factor()` and the
+// factorization is reused by every call to `solve()`; otherwise, `solve()`
+// calls `linear_solver(A, B, X, D)`.
+//
+// The matrix passed to `factor()` must outlive the calls to `solve()`.
+template <typename SolverTraits,
+          bool has_factor = Has_factor<SolverTraits>::value>
+class Factorized_solver
+{
+  typedef typename SolverTraits::Matrix                      Matrix;
+  typedef typename SolverTraits::Vector                      Vector;
+
+public:
+  Factorized_solver(SolverTraits& solver) : m_solver(solver), m_A(nullptr) { }
+
+  bool factor(const Matrix& A)
+  {
+    m_A = &A;
+    return true;
+  }
+
+  bool solve(const Vector& B, Vector& X, double& D)
+  {
+    CGAL_precondition(m_A != nullptr);
+    return m_solver.linear_solver(*m_A, B, X, D);
+  }
+
+private:
+  SolverTraits& m_solver;
+  const Matrix* m_A;
+};
+
+template <typename SolverTraits>
+class Factorized_solver<SolverTraits, true>
+{
+  typedef typename SolverTraits::Matrix                      Matrix;
+  typedef typename SolverTraits::Vector                      Vector;
+
+public:
+  Factorized_solver(SolverTraits& solver) : m_solver(solver), m_D(1) { }
+
+  bool factor(const Matrix& A)
+  {
+    return m_solver.factor(A, m_D);
+  }
+
+  bool solve(const Vector& B, Vector& X, double& D)
+  {
+    D = m_D;
+    return m_solver.linear_solver(B, X);
+  }
+
+private:
+  SolverTraits& m_solver;
+  double m_D;
+};
+
+// Solves "A*Xu = Bu" and "A*Xv = Bv", factoring `A` only once if possible.
+template <typename SolverTraits>
+bool solve_uv_systems(SolverTraits& solver,
+                      const typename SolverTraits::Matrix& A,
+                      const typename SolverTraits::Vector& Bu,
+                      const typename SolverTraits::Vector& Bv,
+                      typename SolverTraits::Vector& Xu,
+                      typename SolverTraits::Vector& Xv,
+                      double& Du, double& Dv)
+{
+  Factorized_solver<SolverTraits> factorized_solver(solver);
+  return factorized_solver.factor(A) &&
+         factorized_solver.solve(Bu, Xu, Du) &&
+         factorized_solver.solve(Bv, Xv, Dv);
+}
+
+} // namespace internal
+
+} // namespace Surface_mesh_parameterization
+
+} // namespace CGAL
+
+#endif // CGAL_SURFACE_MESH_PARAMETERIZATION_INTERNAL_FACTORIZED_SOLVER_H
@@ -0,0 +1,60 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_SURFACE_MESH_PARAMETERIZATION_INTERNAL_HASH_MAP_PROPERTY_MAP_H
+#define CGAL_SURFACE_MESH_PARAMETERIZATION_INTERNAL_HASH_MAP_PROPERTY_MAP_H
+
+#include <CGAL/license/Surface_mesh_parameterization.h>
+
+#include <CGAL/boost/graph/properties.h>
+
+namespace CGAL {
+
+namespace Surface_mesh_parameterization {
+
+namespace internal {
+
+// Property map over a `CGAL::Unique_hash_map`, whose `get()` does not insert missing keys
+// (it returns the default value of the map), so that it can be called concurrently.
+template <typename Map>
+class Hash_map_property_map
+{
+  typedef Map M;
+  typedef Hash_map_property_map<M> Self;
+
+public:
+  typedef typename Map::Key key_type;
+  typedef typename Map::Data value_type;
+  typedef const value_type& reference;
+  typedef boost::read_write_property_map_tag category;
+
+  friend reference get(const Self& pm, const key_type& k)
+  {
+    return static_cast<const M&>(*pm.m_m)[k];
+  }
+
+  friend void put(const Self& pm, const key_type& k, const value_type& v)
+  {
+    (*pm.m_m)[k] = v;
+  }
+
+  Hash_map_property_map() : m_m(nullptr) { }
+  Hash_map_property_map(M& m) : m_m(&m) { }
+
+private:
+  M* m_m;
+};
+
+} // namespace internal
+
+} // namespace Surface_mesh_parameterization
+
+} // namespace CGAL
+
+#endif // CGAL_SURFACE_MESH_PARAMETERIZATION_INTERNAL_HASH_MAP_PROPERTY_MAP_H
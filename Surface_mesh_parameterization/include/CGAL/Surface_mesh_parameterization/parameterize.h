@@ -18,8 +18,15 @@
 #include <CGAL/Surface_mesh_parameterization/Error_code.h>
 #include <CGAL/Surface_mesh_parameterization/Mean_value_coordinates_parameterizer_3.h>
 
+#include <CGAL/boost/graph/Seam_mesh.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
 #include <boost/property_map/property_map.hpp>
 
+#include <vector>
+
 /// \file parameterize.h
 
 namespace CGAL {
@@ -109,6 +116,135 @@ Error_code parameterize(TriangleMesh& mesh,
   return parameterize(mesh, parameterizer, bhd, uvmap);
 }
 
+/// \ingroup  PkgSurfaceMeshParameterizationMainFunction
+///
+/// computes a mapping to a 2D domain for each chart of a seam mesh, independently.
+///
+/// A chart is a set of faces with the same id in `fcmap`. The seams of `mesh`
+/// must separate the charts, so that each chart is a topological disc in `mesh`:
+/// this is the case when the edges between faces of different charts are
+/// seam edges and the charts are topological discs in the input mesh, or are cut
+/// into topological discs by the other seam edges.
+/// Each chart is parameterized with its own parameterizer, obtained by calling
+/// `parameterizer_factory()`, and with its own view of `mesh`, so the charts
+/// can be parameterized in parallel.
+/// The result is the same as calling `parameterize()` for each chart,
+/// with a border halfedge of that chart.
+///
+/// \tparam ConcurrencyTag enables sequential versus parallel parameterization of the charts.
+///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+///         With `Parallel_tag`, the seam property maps of `mesh` and `fcmap` are read concurrently,
+///         and `uvmap` is written concurrently for the vertices of different charts: the property maps
+///         must support this, as for example the property maps of `Surface_mesh`.
+///         Note that the seam mesh vertices of different charts are represented by different
+///         halfedges of the underlying mesh.
+/// \tparam TM, SEM, SVM the template parameters of the seam mesh.
+/// \tparam ParameterizerFactory must provide `Parameterizer operator()() const`, with `Parameterizer`
+///         a model of `Parameterizer_3` for `Seam_mesh<TM, SEM, SVM>`.
+///         With `Parallel_tag`, the parameterizers are used concurrently, so they must not share
+///         their solvers: copies of a parameterizer using `Eigen_solver_traits` share the same solver,
+///         but parameterizers that are constructed independently do not.
+/// \tparam FaceChartMap must be a model of `ReadablePropertyMap` with
+///         `boost::graph_traits<TM>::%face_descriptor` as key type and
+///         `std::size_t` as value type.
+/// \tparam VertexUVmap must be a model of `ReadWritePropertyMap` with
+///         `boost::graph_traits<Seam_mesh<TM, SEM, SVM> >::%vertex_descriptor` as key type and
+///         %Point_2 (type deduced from `TM` using `Kernel_traits`) as value type.
+///
+/// \param mesh a triangulated seam mesh.
+/// \param parameterizer_factory a functor creating the parameterizer of a chart.
+/// \param fcmap the chart ids of the faces, which must be in `[0, n)`, `n` being the number of charts.
+/// \param uvmap an instantiation of the class `VertexUVmap`.
+///
+/// \return `OK` if all charts have been parameterized, and the error code of the failing chart with the lowest id otherwise.
+///         A chart without border (for example, a closed connected component that is not cut by any seam)
+///         is not parameterized and yields `ERROR_NO_TOPOLOGICAL_DISC`.
+///
+template <typename ConcurrencyTag = Sequential_tag,
+          typename TM, typename SEM, typename SVM,
+          typename ParameterizerFactory, typename FaceChartMap, typename VertexUVmap>
+Error_code parameterize_charts(const Seam_mesh<TM, SEM, SVM>& mesh,
+                               const ParameterizerFactory& parameterizer_factory,
+                               FaceChartMap fcmap,
+                               VertexUVmap uvmap)
+{
+  typedef Seam_mesh<TM, SEM, SVM>                                   Mesh;
+  typedef typename boost::graph_traits<Mesh>::halfedge_descriptor   halfedge_descriptor;
+  typedef typename boost::graph_traits<Mesh>::face_descriptor       face_descriptor;
+
+  CGAL_precondition(is_valid_polygon_mesh(mesh));
+
+  // a border halfedge of each chart
+  const halfedge_descriptor null_halfedge = boost::graph_traits<Mesh>::null_halfedge();
+  std::vector<halfedge_descriptor> chart_borders;
+  std::vector<bool> non_empty_charts;
+  for(face_descriptor fd : faces(mesh)) {
+    const std::size_t chart = get(fcmap, fd);
+    if(chart >= chart_borders.size()) {
+      chart_borders.resize(chart + 1, null_halfedge);
+      non_empty_charts.resize(chart + 1, false);
+    }
+
+    non_empty_charts[chart] = true;
+    if(chart_borders[chart] != null_halfedge)
+      continue;
+
+    for(halfedge_descriptor hd : halfedges_around_face(halfedge(fd, mesh), mesh)) {
+      if(is_border(opposite(hd, mesh), mesh)) {
+        chart_borders[chart] = opposite(hd, mesh);
+        break;
+      }
+    }
+  }
+
+  // the number of vertices is cached in the seam mesh, and thus in its copies
+  num_vertices(mesh);
+
+  std::vector<Error_code> status(chart_borders.size(), OK);
+  CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, chart_borders.size()),
+    [&](const std::size_t chart) -> bool
+  {
+    if(!non_empty_charts[chart])
+      return true;
+
+    if(chart_borders[chart] == null_halfedge) {
+      status[chart] = ERROR_NO_TOPOLOGICAL_DISC;
+      return true;
+    }
+
+    // the seam mesh is not thread-safe (it caches its number of vertices), so each chart has its own view
+    Mesh chart_mesh(mesh);
+    status[chart] = parameterize(chart_mesh, parameterizer_factory(), chart_borders[chart], uvmap);
+    return true;
+  });
+
+  for(const Error_code chart_status : status) {
+    if(chart_status != OK)
+      return chart_status;
+  }
+
+  return OK;
+}
+
+/// \ingroup  PkgSurfaceMeshParameterizationMainFunction
+///
+/// computes a mapping to a 2D circle for each chart of a seam mesh, independently,
+/// using Floater Mean Value Coordinates algorithm.
+/// A one-to-one mapping is guaranteed.
+///
+/// See the overload of `parameterize_charts()` taking a parameterizer factory for the requirements.
+///
+template <typename ConcurrencyTag = Sequential_tag,
+          typename TM, typename SEM, typename SVM,
+          typename FaceChartMap, typename VertexUVmap>
+Error_code parameterize_charts(const Seam_mesh<TM, SEM, SVM>& mesh,
+                               FaceChartMap fcmap,
+                               VertexUVmap uvmap)
+{
+  typedef Mean_value_coordinates_parameterizer_3<Seam_mesh<TM, SEM, SVM> >     Parameterizer;
+  return parameterize_charts<ConcurrencyTag>(mesh, []() { return Parameterizer(); }, fcmap, uvmap);
+}
+
 } // namespace Surface_mesh_parameterization
 
 } // namespace CGAL
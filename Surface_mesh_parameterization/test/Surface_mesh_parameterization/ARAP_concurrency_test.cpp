@@ -0,0 +1,83 @@
+#include <CGAL/Simple_cartesian.h>
+
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh_parameterization/Error_code.h>
+#include <CGAL/surface_mesh_parameterization.h>
+
+#include <CGAL/Polygon_mesh_processing/measure.h>
+
+#include <cassert>
+#include <iostream>
+#include <fstream>
+
+namespace SMP = CGAL::Surface_mesh_parameterization;
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+typedef CGAL::Simple_cartesian<double>                            Kernel;
+typedef Kernel::Point_2                                           Point_2;
+typedef Kernel::Point_3                                           Point_3;
+
+typedef CGAL::Surface_mesh<Point_3>                               SMesh;
+
+typedef boost::graph_traits<SMesh>::vertex_descriptor             vertex_descriptor;
+typedef boost::graph_traits<SMesh>::halfedge_descriptor           halfedge_descriptor;
+
+typedef SMesh::Property_map<vertex_descriptor, Point_2>           UV_pmap;
+
+template <typename ConcurrencyTag>
+UV_pmap parameterize(SMesh& sm, const double lambda, const std::string& name)
+{
+  typedef SMP::ARAP_parameterizer_3<SMesh, CGAL::Default, CGAL::Default, ConcurrencyTag> Parameterizer;
+
+  UV_pmap uvmap = sm.add_property_map<vertex_descriptor, Point_2>(name).first;
+  const halfedge_descriptor bhd = PMP::longest_border(sm).first;
+
+  Parameterizer parameterizer(typename Parameterizer::Border_parameterizer(),
+                              typename Parameterizer::Solver_traits(),
+                              lambda);
+  SMP::Error_code status = SMP::parameterize(sm, parameterizer, bhd, uvmap);
+  assert(status == SMP::OK);
+  CGAL_USE(status);
+
+  return uvmap;
+}
+
+// The parallel parameterization must be the same as the sequential one
+void test(const std::string& filename, const double lambda)
+{
+  std::ifstream in(filename);
+  SMesh sm;
+  in >> sm;
+  assert(in && num_vertices(sm) > 0);
+
+  std::cout << filename << " (lambda = " << lambda << ")" << std::endl;
+
+  UV_pmap sequential_uvmap = parameterize<CGAL::Sequential_tag>(sm, lambda, "v:sequential_uv");
+
+  // not all vertices are at the origin
+  bool non_degenerate = false;
+  for(vertex_descriptor v : vertices(sm))
+    if(get(sequential_uvmap, v) != CGAL::ORIGIN)
+      non_degenerate = true;
+  assert(non_degenerate);
+  CGAL_USE(non_degenerate);
+
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
+  UV_pmap parallel_uvmap = parameterize<CGAL::Parallel_tag>(sm, lambda, "v:parallel_uv");
+  for(vertex_descriptor v : vertices(sm))
+    assert(get(sequential_uvmap, v) == get(parallel_uvmap, v));
+#endif
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/nefertiti.off");
+
+  test(filename, 1000.);
+  test(filename, 0.);
+  test(filename, 1.);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
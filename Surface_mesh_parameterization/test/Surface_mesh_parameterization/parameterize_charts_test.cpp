@@ -0,0 +1,170 @@
+#include <CGAL/Simple_cartesian.h>
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/boost/graph/generators.h>
+#include <CGAL/boost/graph/Seam_mesh.h>
+
+#include <CGAL/Surface_mesh_parameterization/Error_code.h>
+#include <CGAL/surface_mesh_parameterization.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace SMP = CGAL::Surface_mesh_parameterization;
+
+typedef CGAL::Simple_cartesian<double>                            Kernel;
+typedef Kernel::Point_2                                           Point_2;
+typedef Kernel::Point_3                                           Point_3;
+
+typedef CGAL::Surface_mesh<Point_3>                               SMesh;
+
+typedef boost::graph_traits<SMesh>::vertex_descriptor             SM_vertex_descriptor;
+typedef boost::graph_traits<SMesh>::halfedge_descriptor           SM_halfedge_descriptor;
+typedef boost::graph_traits<SMesh>::edge_descriptor               SM_edge_descriptor;
+typedef boost::graph_traits<SMesh>::face_descriptor               SM_face_descriptor;
+
+typedef SMesh::Property_map<SM_edge_descriptor, bool>             Seam_edge_pmap;
+typedef SMesh::Property_map<SM_vertex_descriptor, bool>           Seam_vertex_pmap;
+typedef SMesh::Property_map<SM_face_descriptor, std::size_t>      Chart_pmap;
+typedef SMesh::Property_map<SM_halfedge_descriptor, Point_2>      UV_pmap;
+
+typedef CGAL::Seam_mesh<SMesh, Seam_edge_pmap, Seam_vertex_pmap>  Mesh;
+
+typedef boost::graph_traits<Mesh>::vertex_descriptor              vertex_descriptor;
+typedef boost::graph_traits<Mesh>::halfedge_descriptor            halfedge_descriptor;
+typedef boost::graph_traits<Mesh>::face_descriptor                face_descriptor;
+
+typedef SMP::ARAP_parameterizer_3<Mesh>                           ARAP_parameterizer;
+
+struct Height
+{
+  Point_3 operator()(std::size_t i, std::size_t j) const
+  {
+    return Point_3(double(i), double(j), std::sin(0.3 * i) * std::cos(0.2 * j));
+  }
+};
+
+// Parameterizes each chart with `parameterize()`, in the same way as `parameterize_charts()`.
+template <typename ParameterizerFactory>
+void parameterize_each_chart(Mesh& mesh,
+                             const ParameterizerFactory& parameterizer_factory,
+                             const Chart_pmap chart_map,
+                             const std::size_t number_of_charts,
+                             UV_pmap uvmap)
+{
+  std::vector<halfedge_descriptor> chart_borders(number_of_charts);
+  std::vector<bool> found(number_of_charts, false);
+  for(face_descriptor fd : faces(mesh)) {
+    const std::size_t chart = get(chart_map, fd);
+    for(halfedge_descriptor hd : halfedges_around_face(halfedge(fd, mesh), mesh)) {
+      if(!found[chart] && is_border(opposite(hd, mesh), mesh)) {
+        chart_borders[chart] = opposite(hd, mesh);
+        found[chart] = true;
+      }
+    }
+  }
+
+  for(std::size_t chart = 0; chart < number_of_charts; ++chart) {
+    SMP::Error_code status = SMP::parameterize(mesh, parameterizer_factory(), chart_borders[chart], uvmap);
+    assert(status == SMP::OK);
+    CGAL_USE(status);
+  }
+}
+
+template <typename ConcurrencyTag, typename ParameterizerFactory>
+void test(SMesh& sm,
+          Mesh& mesh,
+          const ParameterizerFactory& parameterizer_factory,
+          const Chart_pmap chart_map,
+          const std::size_t number_of_charts)
+{
+  UV_pmap expected_uvmap = sm.add_property_map<SM_halfedge_descriptor, Point_2>("h:expected_uv").first;
+  parameterize_each_chart(mesh, parameterizer_factory, chart_map, number_of_charts, expected_uvmap);
+
+  UV_pmap uvmap = sm.add_property_map<SM_halfedge_descriptor, Point_2>("h:uv").first;
+  SMP::Error_code status = SMP::parameterize_charts<ConcurrencyTag>(mesh, parameterizer_factory, chart_map, uvmap);
+  assert(status == SMP::OK);
+  CGAL_USE(status);
+
+  for(vertex_descriptor vd : vertices(mesh))
+    assert(get(uvmap, vd) == get(expected_uvmap, vd));
+
+  sm.remove_property_map(expected_uvmap);
+  sm.remove_property_map(uvmap);
+}
+
+template <typename ConcurrencyTag>
+void test(SMesh& sm,
+          Mesh& mesh,
+          const Chart_pmap chart_map,
+          const std::size_t number_of_charts)
+{
+  test<ConcurrencyTag>(sm, mesh,
+                       []() { return SMP::Mean_value_coordinates_parameterizer_3<Mesh>(); },
+                       chart_map, number_of_charts);
+  test<ConcurrencyTag>(sm, mesh,
+                       []() { return ARAP_parameterizer(ARAP_parameterizer::Border_parameterizer(),
+                                                        ARAP_parameterizer::Solver_traits(),
+                                                        10.); },
+                       chart_map, number_of_charts);
+
+  // default parameterizer
+  UV_pmap uvmap = sm.add_property_map<SM_halfedge_descriptor, Point_2>("h:uv").first;
+  SMP::Error_code status = SMP::parameterize_charts<ConcurrencyTag>(mesh, chart_map, uvmap);
+  assert(status == SMP::OK);
+  CGAL_USE(status);
+  for(vertex_descriptor vd : vertices(mesh)) {
+    const Point_2& uv = get(uvmap, vd);
+    assert(uv.x() >= 0. && uv.x() <= 1. && uv.y() >= 0. && uv.y() <= 1.);
+  }
+  sm.remove_property_map(uvmap);
+}
+
+int main(int, char**)
+{
+  // a grid of 12 x 8 charts of 4 x 4 cells
+  const std::size_t chart_size = 4, nx = 12, ny = 8;
+
+  SMesh sm;
+  CGAL::make_grid(chart_size * nx, chart_size * ny, sm, Height(), true /*triangulated*/);
+
+  Chart_pmap chart_map = sm.add_property_map<SM_face_descriptor, std::size_t>("f:chart").first;
+  for(SM_face_descriptor fd : faces(sm)) {
+    double x = 0., y = 0.;
+    for(SM_vertex_descriptor vd : vertices_around_face(halfedge(fd, sm), sm)) {
+      x += sm.point(vd).x() / 3.;
+      y += sm.point(vd).y() / 3.;
+    }
+    put(chart_map, fd, std::size_t(x) / chart_size + nx * (std::size_t(y) / chart_size));
+  }
+
+  // the seams separate the charts
+  Seam_edge_pmap seam_edge_pm = sm.add_property_map<SM_edge_descriptor, bool>("e:on_seam", false).first;
+  Seam_vertex_pmap seam_vertex_pm = sm.add_property_map<SM_vertex_descriptor, bool>("v:on_seam", false).first;
+  Mesh mesh(sm, seam_edge_pm, seam_vertex_pm);
+  std::size_t number_of_seams = 0;
+  for(SM_edge_descriptor ed : edges(sm)) {
+    const SM_halfedge_descriptor hd = halfedge(ed, sm);
+    if(!is_border_edge(hd, sm) &&
+       get(chart_map, face(hd, sm)) != get(chart_map, face(opposite(hd, sm), sm))) {
+      put(seam_edge_pm, ed, true);
+      put(seam_vertex_pm, source(hd, sm), true);
+      put(seam_vertex_pm, target(hd, sm), true);
+      ++number_of_seams;
+    }
+  }
+  mesh.set_seam_edges_number(number_of_seams);
+
+  std::cout << nx * ny << " charts, " << number_of_seams << " seam edges" << std::endl;
+
+  test<CGAL::Sequential_tag>(sm, mesh, chart_map, nx * ny);
+
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
+  test<CGAL::Parallel_tag>(sm, mesh, chart_map, nx * ny);
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -115,6 +115,8 @@ struct Benchmark_data
 
   SampledValue<boost::timer::nanosecond_type> constructionTime;
   SampledValue<boost::timer::nanosecond_type> queryTime;
+  SampledValue<boost::timer::nanosecond_type> sequentialSourceSetsTime;
+  SampledValue<boost::timer::nanosecond_type> parallelSourceSetsTime;
 
 #if !defined(NDEBUG)
   SampledValue<size_t> peakMemoryUsage;
@@ -127,6 +129,8 @@ struct Benchmark_data
     numFaces = 0;
     constructionTime.reset();
     queryTime.reset();
+    sequentialSourceSetsTime.reset();
+    parallelSourceSetsTime.reset();
 #if !defined(NDEBUG)
     peakMemoryUsage.reset();
 #endif
@@ -142,6 +146,14 @@ void print_results(std::ostream& stream, const std::string& filename, const Benc
 
   stream << "Construction  | " << outData.constructionTime.average_float() / 1.0e9 << " | " << double(outData.constructionTime.minimum()) / 1.0e9 << " | " << double(outData.constructionTime.maximum()) / 1.0e9 << " |" << std::endl;
   stream << "Query         | " << 1.0 / (outData.queryTime.average_float() / 1.0e9) << " | " << double(outData.queryTime.minimum()) / 1.0e9 << " | " << double(outData.queryTime.maximum()) / 1.0e9 << " |" << std::endl;
+  if (outData.sequentialSourceSetsTime.sum() > 0)
+  {
+    stream << "Source Sets (Sequential) | " << outData.sequentialSourceSetsTime.average_float() / 1.0e9 << " | " << double(outData.sequentialSourceSetsTime.minimum()) / 1.0e9 << " | " << double(outData.sequentialSourceSetsTime.maximum()) / 1.0e9 << " |" << std::endl;
+  }
+  if (outData.parallelSourceSetsTime.sum() > 0)
+  {
+    stream << "Source Sets (Parallel)   | " << outData.parallelSourceSetsTime.average_float() / 1.0e9 << " | " << double(outData.parallelSourceSetsTime.minimum()) / 1.0e9 << " | " << double(outData.parallelSourceSetsTime.maximum()) / 1.0e9 << " |" << std::endl;
+  }
 #if !defined(NDEBUG)
   stream << "Memory (Peak) | " << outData.peakMemoryUsage.average_float() / 1.0e6 << " | " << double(outData.peakMemoryUsage.minimum()) / 1.0e6 << " | " << double(outData.peakMemoryUsage.maximum()) / 1.0e6 << " |" << std::endl;
 #endif
@@ -158,7 +170,7 @@ typename Traits::Barycentric_coordinates random_coordinates(CGAL::Random& rand)
 }
 
 template <class Kernel>
-void run_benchmarks(CGAL::Random& rand, size_t numTrials, size_t numSources, size_t numQueries, const std::string& polyhedronFile, Benchmark_data& outData)
+void run_benchmarks(CGAL::Random& rand, size_t numTrials, size_t numSources, size_t numQueries, size_t numSourceSets, const std::string& polyhedronFile, Benchmark_data& outData)
 {
   typedef CGAL::Polyhedron_3<Kernel, CGAL::Polyhedron_items_with_id_3> Polyhedron_3;
   typedef CGAL::Surface_mesh_shortest_path_traits<Kernel, Polyhedron_3> Traits;
@@ -211,7 +223,7 @@ void run_benchmarks(CGAL::Random& rand, size_t numTrials, size_t numSources, siz
     while (sourcePoints.size() < numSources)
     {
       face_descriptor sourceFace = allFaces[rand.get_int(0, allFaces.size())];
-      Barycentric_coordinates sourceLocation = random_coordinate<Traits>(rand);
+      Barycentric_coordinates sourceLocation = random_coordinates<Traits>(rand);
       sourcePoints.push_back(Face_location(sourceFace, sourceLocation));
     }
 
@@ -233,7 +245,7 @@ void run_benchmarks(CGAL::Random& rand, size_t numTrials, size_t numSources, siz
     for (size_t j = 0; j < numQueries; ++j)
     {
       face_descriptor sourceFace = allFaces[rand.get_int(0, allFaces.size())];
-      Barycentric_coordinates sourceLocation = random_coordinate<Traits>(rand);
+      Barycentric_coordinates sourceLocation = random_coordinates<Traits>(rand);
 
       timer.start();
       FT distance = shortestPaths.shortest_distance_to_source_points(sourceFace, sourceLocation).first;
@@ -244,6 +256,36 @@ void run_benchmarks(CGAL::Random& rand, size_t numTrials, size_t numSources, siz
 
       outData.queryTime.add_sample(elapsed.wall);
     }
+
+    if (numSourceSets > 0)
+    {
+      // independent sets of source points, each with `numSources` points
+      std::vector<std::vector<Face_location> > sourceSets(numSourceSets);
+
+      for (size_t j = 0; j < numSourceSets; ++j)
+      {
+        while (sourceSets[j].size() < numSources)
+        {
+          face_descriptor sourceFace = allFaces[rand.get_int(0, allFaces.size())];
+          Barycentric_coordinates sourceLocation = random_coordinates<Traits>(rand);
+          sourceSets[j].push_back(Face_location(sourceFace, sourceLocation));
+        }
+      }
+
+      std::vector<FT> distances;
+
+      timer.start();
+      shortestPaths.template shortest_distances_to_source_sets<CGAL::Sequential_tag>(sourceSets, distances);
+      timer.stop();
+      outData.sequentialSourceSetsTime.add_sample(timer.elapsed().wall);
+
+#ifdef CGAL_LINKED_WITH_TBB
+      timer.start();
+      shortestPaths.template shortest_distances_to_source_sets<CGAL::Parallel_tag>(sourceSets, distances);
+      timer.stop();
+      outData.parallelSourceSetsTime.add_sample(timer.elapsed().wall);
+#endif
+    }
   }
 }
 
@@ -279,6 +321,7 @@ int main(int argc, char* argv[])
     ("trials,t", po::value<size_t>()->default_value(20), "Number of trials to run")
     ("numpoints,n", po::value<size_t>()->default_value(1), "Number of source points per trial")
     ("queries,q", po::value<size_t>()->default_value(100), "Number of queries to run per trial")
+    ("sourcesets,s", po::value<size_t>()->default_value(0), "Number of independent sets of source points whose distances to all vertices are computed per trial")
     ("kernel,k", po::value<std::string>()->default_value("epick"), "Kernel to use.  One of \'ipick\', \'epick\', \'epeck\'")
     ;
 
@@ -298,6 +341,7 @@ int main(int argc, char* argv[])
     size_t numTrials = vm["trials"].as<size_t>();
     size_t numPoints = vm["numpoints"].as<size_t>();
     size_t numQueries = vm["queries"].as<size_t>();
+    size_t numSourceSets = vm["sourcesets"].as<size_t>();
     std::string polyhedronFile = vm["polyhedron"].as<std::string>();
 
     try
@@ -305,13 +349,13 @@ int main(int argc, char* argv[])
       switch (parse_kernel_type(vm["kernel"].as<std::string>()))
       {
         case KERNEL_IPICK:
-          run_benchmarks<CGAL::Simple_cartesian<double> >(rand, numTrials, numPoints, numQueries, polyhedronFile, results);
+          run_benchmarks<CGAL::Simple_cartesian<double> >(rand, numTrials, numPoints, numQueries, numSourceSets, polyhedronFile, results);
           break;
         case KERNEL_EPICK:
-          run_benchmarks<CGAL::Exact_predicates_inexact_constructions_kernel>(rand, numTrials, numPoints, numQueries, polyhedronFile, results);
+          run_benchmarks<CGAL::Exact_predicates_inexact_constructions_kernel>(rand, numTrials, numPoints, numQueries, numSourceSets, polyhedronFile, results);
           break;
         case KERNEL_EPECK:
-          run_benchmarks<CGAL::Exact_predicates_exact_constructions_kernel_with_sqrt>(rand, numTrials, numPoints, numQueries, polyhedronFile, results);
+          run_benchmarks<CGAL::Exact_predicates_exact_constructions_kernel_with_sqrt>(rand, numTrials, numPoints, numQueries, numSourceSets, polyhedronFile, results);
           break;
         default:
           std::cerr << "Invalid kernel type: \"" << vm["kernel"].as<std::string>() << "\"" << std::endl;
@@ -22,9 +22,13 @@
 #include <CGAL/AABB_tree.h>
 #include <CGAL/boost/graph/helpers.h>
 #include <CGAL/boost/graph/iterator.h>
+#include <CGAL/Compact_container.h>
 #include <CGAL/Default.h>
 #include <CGAL/enum.h>
 #include <CGAL/number_utils.h>
+#include <CGAL/tags.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
 
 #include <boost/lexical_cast.hpp>
 #include <boost/variant/get.hpp>
@@ -38,6 +42,12 @@
 #include <vector>
 #include <type_traits>
 
+// The queue of events is not compacted while it has fewer elements than this.
+// Tests lower it to exercise the compaction on small meshes.
+#ifndef CGAL_SURFACE_MESH_SHORTEST_PATH_MIN_QUEUE_COMPACTION_SIZE
+#define CGAL_SURFACE_MESH_SHORTEST_PATH_MIN_QUEUE_COMPACTION_SIZE 4096
+#endif
+
 namespace CGAL {
 
 /*!
@@ -284,9 +294,7 @@ private:
   typedef Surface_mesh_shortest_paths_3::internal::Cone_tree_node<Traits> Cone_tree_node;
   typedef Surface_mesh_shortest_paths_3::internal::Cone_expansion_event<Traits> Cone_expansion_event;
 
-  typedef std::priority_queue<Cone_expansion_event*,
-                              std::vector<Cone_expansion_event*>,
-                              Surface_mesh_shortest_paths_3::internal::Cone_expansion_event_min_priority_queue_comparator<Traits> > Expansion_priqueue;
+  typedef Surface_mesh_shortest_paths_3::internal::Cone_expansion_event_queue<Traits> Expansion_priqueue;
   typedef std::pair<Cone_tree_node*, FT> Node_distance_pair;
 
 private:
@@ -345,6 +353,14 @@ private:
 
   Expansion_priqueue m_expansionPriqueue;
 
+  // Nodes and events are allocated in blocks, and the slots of the nodes of pruned
+  // subtrees and of the processed events are reused for the next allocations
+  Compact_container<Cone_tree_node> m_nodePool;
+  Compact_container<Cone_expansion_event> m_eventPool;
+
+  // Cancelled events are removed from the queue when its size reaches this value
+  std::size_t m_nextQueueCompaction;
+
 #if !defined(NDEBUG)
   std::size_t m_currentNodeCount;
   std::size_t m_peakNodeCount;
@@ -451,6 +467,45 @@ private:
 #endif
   }
 
+  template <class... Args>
+  Cone_tree_node* create_node(const Args&... args)
+  {
+    return &*m_nodePool.emplace(m_traits, m_graph, args...);
+  }
+
+  template <class... Args>
+  Cone_expansion_event* create_event(const Args&... args)
+  {
+    return &*m_eventPool.emplace(args...);
+  }
+
+  void release_event(Cone_expansion_event* event)
+  {
+    m_eventPool.erase(m_eventPool.iterator_to(*event));
+  }
+
+  /*
+    Drops the events that were cancelled since they were pushed, that is the windows of the
+    pruned subtrees and the windows dominated by another node, so that the size of the queue
+    stays proportional to the number of live events. The queue is compacted each time
+    its size doubles, so that the amortized cost is constant per event.
+  */
+  void compact_queue()
+  {
+    if (m_expansionPriqueue.size() < m_nextQueueCompaction)
+    {
+      return;
+    }
+
+    m_expansionPriqueue.remove_cancelled([this](Cone_expansion_event* event) { release_event(event); });
+    m_nextQueueCompaction = (std::max)(std::size_t(2) * m_expansionPriqueue.size(), min_queue_compaction_size());
+  }
+
+  static std::size_t min_queue_compaction_size()
+  {
+    return CGAL_SURFACE_MESH_SHORTEST_PATH_MIN_QUEUE_COMPACTION_SIZE;
+  }
+
   Point_2 construct_barycenter_in_triangle_2(const Triangle_2& t,
                                              const Barycentric_coordinates& b) const
   {
@@ -655,10 +710,10 @@ private:
     {
       Triangle_3 adjacentFace = triangle_from_halfedge(cone->left_child_edge());
       Triangle_2 layoutFace = ft3as2(adjacentFace, 0, cone->left_child_base_segment());
-      Cone_tree_node* child = new Cone_tree_node(m_traits, m_graph, cone->left_child_edge(), layoutFace,
-                                                 cone->source_image(), cone->distance_from_source_to_root(),
-                                                 cv2(windowSegment, 0), cv2(windowSegment, 1),
-                                                 Cone_tree_node::INTERVAL);
+      Cone_tree_node* child = create_node(cone->left_child_edge(), layoutFace,
+                                          cone->source_image(), cone->distance_from_source_to_root(),
+                                          cv2(windowSegment, 0), cv2(windowSegment, 1),
+                                          Cone_tree_node::INTERVAL);
       node_created();
       cone->set_left_child(child);
       process_node(child);
@@ -690,10 +745,10 @@ private:
     {
       Triangle_3 adjacentFace = triangle_from_halfedge(cone->right_child_edge());
       Triangle_2 layoutFace = ft3as2(adjacentFace, 0, cone->right_child_base_segment());
-      Cone_tree_node* child = new Cone_tree_node(m_traits, m_graph, cone->right_child_edge(), layoutFace,
-                                                 cone->source_image(), cone->distance_from_source_to_root(),
-                                                 cv2(windowSegment, 0), cv2(windowSegment, 1),
-                                                 Cone_tree_node::INTERVAL);
+      Cone_tree_node* child = create_node(cone->right_child_edge(), layoutFace,
+                                          cone->source_image(), cone->distance_from_source_to_root(),
+                                          cv2(windowSegment, 0), cv2(windowSegment, 1),
+                                          Cone_tree_node::INTERVAL);
       node_created();
       cone->set_right_child(child);
       process_node(child);
@@ -763,7 +818,7 @@ private:
     const halfedge_descriptor start = halfedge(f, m_graph);
     halfedge_descriptor current = start;
 
-    Cone_tree_node* faceRoot = new Cone_tree_node(m_traits, m_graph, m_rootNodes.size());
+    Cone_tree_node* faceRoot = create_node(m_rootNodes.size());
     node_created();
     m_rootNodes.emplace_back(faceRoot, sourcePointIt);
 
@@ -784,13 +839,12 @@ private:
       const Barycentric_coordinates rotatedFaceLocation(shifted_coordinates(faceLocation, currentVertex));
       const Point_2 sourcePoint(construct_barycenter_in_triangle_2(layoutFace, rotatedFaceLocation));
 
-      Cone_tree_node* child = new Cone_tree_node(m_traits, m_graph,
-                                                 current /*entryEdge*/,
-                                                 layoutFace, sourcePoint,
-                                                 FT(0) /*pseudoSourceDistance*/,
-                                                 cv2(layoutFace, 0) /*windowLeft*/,
-                                                 cv2(layoutFace, 2) /*windowRight*/,
-                                                 Cone_tree_node::FACE_SOURCE);
+      Cone_tree_node* child = create_node(current /*entryEdge*/,
+                                          layoutFace, sourcePoint,
+                                          FT(0) /*pseudoSourceDistance*/,
+                                          cv2(layoutFace, 0) /*windowLeft*/,
+                                          cv2(layoutFace, 2) /*windowRight*/,
+                                          Cone_tree_node::FACE_SOURCE);
       node_created();
       faceRoot->push_middle_child(child);
 
@@ -830,7 +884,7 @@ private:
       std::cout << "\t\tBoundary: " << is_border_edge(baseEdge, m_graph) << std::endl;
     }
 
-    Cone_tree_node* edgeRoot = new Cone_tree_node(m_traits, m_graph, m_rootNodes.size());
+    Cone_tree_node* edgeRoot = create_node(m_rootNodes.size());
     node_created();
     m_rootNodes.emplace_back(edgeRoot, sourcePointIt);
 
@@ -892,14 +946,13 @@ private:
         std::cout << "\t\tLocation = " << sourcePoint << std::endl;
       }
 
-      Cone_tree_node* v2_Child = new Cone_tree_node(m_traits, m_graph,
-                                                    baseEdges[side] /*entryEdge*/,
-                                                    layoutFace,
-                                                    sourcePoint /*sourceImage*/,
-                                                    FT(0) /*pseudoSourceDistance*/,
-                                                    cv2(layoutFace, 0) /*windowLeft*/,
-                                                    cv2(layoutFace, 2) /*windowRight*/,
-                                                    Cone_tree_node::EDGE_SOURCE);
+      Cone_tree_node* v2_Child = create_node(baseEdges[side] /*entryEdge*/,
+                                             layoutFace,
+                                             sourcePoint /*sourceImage*/,
+                                             FT(0) /*pseudoSourceDistance*/,
+                                             cv2(layoutFace, 0) /*windowLeft*/,
+                                             cv2(layoutFace, 2) /*windowRight*/,
+                                             Cone_tree_node::EDGE_SOURCE);
       node_created();
       edgeRoot->push_middle_child(v2_Child);
       process_node(v2_Child);
@@ -925,14 +978,13 @@ private:
         std::cout << "\t\tLocation = " << sourcePoint << std::endl;
       }
 
-      Cone_tree_node* v1_Child = new Cone_tree_node(m_traits, m_graph,
-                                                    prev(baseEdges[side], m_graph) /*entryEdge*/,
-                                                    layoutFace,
-                                                    sourcePoint /*sourceImage*/,
-                                                    FT(0) /*pseudoSourceDistance*/,
-                                                    cv2(layoutFace, 0) /*windowLeft*/,
-                                                    cv2(layoutFace, 2) /*windowRight*/,
-                                                    Cone_tree_node::EDGE_SOURCE);
+      Cone_tree_node* v1_Child = create_node(prev(baseEdges[side], m_graph) /*entryEdge*/,
+                                             layoutFace,
+                                             sourcePoint /*sourceImage*/,
+                                             FT(0) /*pseudoSourceDistance*/,
+                                             cv2(layoutFace, 0) /*windowLeft*/,
+                                             cv2(layoutFace, 2) /*windowRight*/,
+                                             Cone_tree_node::EDGE_SOURCE);
       node_created();
       edgeRoot->push_middle_child(v1_Child);
       process_node(v1_Child);
@@ -951,8 +1003,8 @@ private:
       std::cout << "\tVertex Root Expansion: Vertex = " << get(m_vertexIndexMap, vertex) << std::endl;
     }
 
-    Cone_tree_node* vertexRoot = new Cone_tree_node(m_traits, m_graph, m_rootNodes.size(),
-                                                    prev(halfedge(vertex, m_graph), m_graph));
+    Cone_tree_node* vertexRoot = create_node(m_rootNodes.size(),
+                                             prev(halfedge(vertex, m_graph), m_graph));
 
     node_created();
     m_rootNodes.emplace_back(vertexRoot, sourcePointIt);
@@ -1022,12 +1074,12 @@ private:
         }
       }
 
-      Cone_tree_node* child = new Cone_tree_node(m_traits, m_graph, currentEdge /*entryEdge*/,
-                                                 layoutFace, cv2(layoutFace, 1) /*sourceImage*/,
-                                                 distanceFromTargetToRoot,
-                                                 cv2(layoutFace, 0) /*windowLeft*/,
-                                                 cv2(layoutFace, 2) /*windowRight*/,
-                                                 Cone_tree_node::VERTEX_SOURCE);
+      Cone_tree_node* child = create_node(currentEdge /*entryEdge*/,
+                                          layoutFace, cv2(layoutFace, 1) /*sourceImage*/,
+                                          distanceFromTargetToRoot,
+                                          cv2(layoutFace, 0) /*windowLeft*/,
+                                          cv2(layoutFace, 2) /*windowRight*/,
+                                          Cone_tree_node::VERTEX_SOURCE);
 
       node_created();
       parent->push_middle_child(child);
@@ -1536,8 +1588,8 @@ private:
                   << " , clipped = " << leftWindow << " , Estimate = " << distanceEstimate << std::endl;
       }
 
-      Cone_expansion_event* event = new Cone_expansion_event(parent, distanceEstimate,
-                                                             Cone_expansion_event::LEFT_CHILD, leftWindow);
+      Cone_expansion_event* event = create_event(parent, distanceEstimate,
+                                                 Cone_expansion_event::LEFT_CHILD, leftWindow);
       parent->m_pendingLeftSubtree = event;
 
       m_expansionPriqueue.push(event);
@@ -1581,8 +1633,8 @@ private:
                   << " , clipped = " << rightWindow << " , Estimate = " << distanceEstimate << std::endl;
       }
 
-      Cone_expansion_event* event = new Cone_expansion_event(parent, distanceEstimate,
-                                                             Cone_expansion_event::RIGHT_CHILD, rightWindow);
+      Cone_expansion_event* event = create_event(parent, distanceEstimate,
+                                                 Cone_expansion_event::RIGHT_CHILD, rightWindow);
       parent->m_pendingRightSubtree = event;
 
       m_expansionPriqueue.push(event);
@@ -1597,15 +1649,14 @@ private:
       std::cout << ">>> Pushing Middle Child, Estimate = " << parent->distance_from_target_to_root() << std::endl;
     }
 
-    Cone_expansion_event* event = new Cone_expansion_event(parent, parent->distance_from_target_to_root(), Cone_expansion_event::PSEUDO_SOURCE);
+    Cone_expansion_event* event = create_event(parent, parent->distance_from_target_to_root(), Cone_expansion_event::PSEUDO_SOURCE);
     parent->m_pendingMiddleSubtree = event;
 
     m_expansionPriqueue.push(event);
     queue_pushed();
   }
 
-  void delete_node(Cone_tree_node* node,
-                   const bool destruction = false)
+  void delete_node(Cone_tree_node* node)
   {
     if (node != nullptr)
     {
@@ -1627,7 +1678,7 @@ private:
           std::cout << "\t"  << node << " Descending left." << std::endl;
         }
 
-        delete_node(node->remove_left_child(), destruction);
+        delete_node(node->remove_left_child());
       }
 
       if (node->m_pendingRightSubtree != nullptr)
@@ -1643,7 +1694,7 @@ private:
           std::cout << "\t"  << node << " Descending right." << std::endl;
         }
 
-        delete_node(node->remove_right_child(), destruction);
+        delete_node(node->remove_right_child());
       }
 
       if (node->m_pendingMiddleSubtree != nullptr)
@@ -1659,13 +1710,10 @@ private:
 
       while (node->has_middle_children())
       {
-        delete_node(node->pop_middle_child(), destruction);
+        delete_node(node->pop_middle_child());
       }
 
-      // At the point of destruction, the `Triangle_mesh` referenced may have gone out of scope,
-      // we wish to distinguish between deletion with an assumed reference
-      // to the original `Triangle_mesh`, and deletion without
-      if (!node->is_root_node() && !destruction)
+      if (!node->is_root_node())
       {
         std::size_t entryHalfEdgeIndex = get(m_halfedgeIndexMap, node->entry_edge());
 
@@ -1682,7 +1730,7 @@ private:
         }
       }
 
-      delete node;
+      m_nodePool.erase(m_nodePool.iterator_to(*node));
     }
 
     node_deleted();
@@ -1710,10 +1758,10 @@ private:
 
   void delete_all_nodes()
   {
-    for (std::size_t i = 0; i < m_rootNodes.size(); ++i)
-    {
-      delete_node(m_rootNodes[i].first, true);
-    }
+#if !defined(NDEBUG)
+    m_currentNodeCount -= m_nodePool.size();
+#endif
+    m_nodePool.clear();
   }
 
   void reset_algorithm(const bool clearFaceLocations = true)
@@ -1721,11 +1769,9 @@ private:
     m_closestToVertices.assign(num_vertices(m_graph), Node_distance_pair(nullptr, FT(-1)));
     m_vertexOccupiers.assign(num_halfedges(m_graph), Node_distance_pair(nullptr, FT(-1)));
 
-    while (!m_expansionPriqueue.empty())
-    {
-      delete m_expansionPriqueue.top();
-      m_expansionPriqueue.pop();
-    }
+    m_expansionPriqueue = Expansion_priqueue();
+    m_eventPool.clear();
+    m_nextQueueCompaction = min_queue_compaction_size();
 
     if (clearFaceLocations)
     {
@@ -2203,7 +2249,8 @@ private:
         std::cout << "Found cancelled event for node: " << event->m_parent << std::endl;
       }
 
-      delete event;
+      release_event(event);
+      compact_queue();
     }
 
     m_faceOccupiers.clear();
@@ -2586,6 +2633,48 @@ public:
     }
   }
 
+  /*!
+  \brief Computes the shortest surface distances from every vertex to each of several independent sets of source points
+
+  \details Each set of source points is handled as if it was the only set of source points of
+  a separate shortest paths object: the source points and the sequence tree of this object
+  are neither used nor modified. Only one sequence tree per thread is alive at any time.
+
+  \tparam ConcurrencyTag enables sequential versus parallel computation of the sequence trees
+    of the different sets of source points. Possible values are `Sequential_tag` (the default)
+    and `Parallel_tag`. With `Parallel_tag`, \ref thirdpartyTBB or OpenMP must be available and linked.
+  \tparam SourceSetRange a model of `RandomAccessRange` whose value type is a model of `ForwardRange`
+    with value type either `Surface_mesh_shortest_path::Face_location`
+    or `Surface_mesh_shortest_path::vertex_descriptor`.
+
+  \param source_sets the sets of source points
+  \param distances is resized to `source_sets.size() * num_vertices(tm)`, and
+    `distances[s * num_vertices(tm) + get(vertexIndexMap, v)]` is the shortest surface distance from
+    the vertex `v` to any point of `source_sets[s]`, or a negative value if none of these points is reachable from `v`.
+  */
+  template <class ConcurrencyTag = Sequential_tag, class SourceSetRange>
+  void shortest_distances_to_source_sets(const SourceSetRange& source_sets,
+                                         std::vector<FT>& distances) const
+  {
+    const std::size_t numVertices = num_vertices(m_graph);
+    const std::size_t numSourceSets = source_sets.size();
+    distances.resize(numSourceSets * numVertices);
+
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, numSourceSets),
+                                   [&](const std::size_t s) -> bool
+    {
+      Surface_mesh_shortest_path shortestPaths(m_graph, m_vertexIndexMap, m_halfedgeIndexMap,
+                                               m_faceIndexMap, m_vertexPointMap, m_traits);
+      shortestPaths.add_source_points(std::begin(source_sets[s]), std::end(source_sets[s]));
+
+      for (vertex_descriptor v : vertices(m_graph))
+      {
+        distances[s * numVertices + get(m_vertexIndexMap, v)] = shortestPaths.shortest_distance_to_source_points(v).first;
+      }
+      return true;
+    });
+  }
+
   /// @}
 
   /// \name Shortest Path Sequence Queries
@@ -14,6 +14,12 @@
 
 #include <CGAL/license/Surface_mesh_shortest_path.h>
 
+#include <CGAL/Compact_container.h>
+
+#include <algorithm>
+#include <queue>
+#include <vector>
+
 namespace CGAL {
 namespace Surface_mesh_shortest_paths_3 {
 namespace internal {
@@ -21,8 +27,10 @@ namespace internal {
 template<class Traits>
 class Cone_tree_node;
 
+// Events are stored in a `Compact_container`, see `Surface_mesh_shortest_path`
 template <class Traits>
 struct Cone_expansion_event
+  : public Compact_container_base
 {
 public:
   typedef typename Traits::Segment_2 Segment_2;
@@ -79,6 +87,29 @@ public:
   }
 };
 
+// A min-priority queue of expansion events, from which the events that were
+// cancelled while waiting in the queue can be removed before they reach the top
+template <class Traits>
+class Cone_expansion_event_queue
+  : public std::priority_queue<Cone_expansion_event<Traits>*,
+                               std::vector<Cone_expansion_event<Traits>*>,
+                               Cone_expansion_event_min_priority_queue_comparator<Traits> >
+{
+public:
+  // Removes all cancelled events from the queue, and calls `release` on each of them
+  template <class Release>
+  void remove_cancelled(Release release)
+  {
+    typename std::vector<Cone_expansion_event<Traits>*>::iterator firstCancelled =
+      std::partition(this->c.begin(), this->c.end(),
+                     [](const Cone_expansion_event<Traits>* event) { return !event->m_cancelled; });
+
+    std::for_each(firstCancelled, this->c.end(), release);
+    this->c.erase(firstCancelled, this->c.end());
+    std::make_heap(this->c.begin(), this->c.end(), this->comp);
+  }
+};
+
 } // namespace internal
 } // namespace Surface_mesh_shortest_paths_3
 } // namespace CGAL
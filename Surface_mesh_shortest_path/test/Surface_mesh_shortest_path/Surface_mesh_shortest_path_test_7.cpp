@@ -0,0 +1,139 @@
+#include <cstddef>
+#include <limits>
+
+// the queue of events is compacted as soon as its size reaches this value,
+// which is lowered so that the compaction happens on small meshes
+std::size_t smsp_queue_compaction_size = 16;
+#define CGAL_SURFACE_MESH_SHORTEST_PATH_MIN_QUEUE_COMPACTION_SIZE smsp_queue_compaction_size
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Surface_mesh_shortest_path.h>
+
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+
+typedef CGAL::Surface_mesh<Kernel::Point_3> Triangle_mesh;
+
+typedef CGAL::Surface_mesh_shortest_path_traits<Kernel, Triangle_mesh> Traits;
+typedef CGAL::Surface_mesh_shortest_path<Traits> Surface_mesh_shortest_path;
+typedef Surface_mesh_shortest_path::Face_location Face_location;
+typedef Surface_mesh_shortest_path::Barycentric_coordinates Barycentric_coordinates;
+
+typedef boost::graph_traits<Triangle_mesh>::vertex_descriptor vertex_descriptor;
+typedef boost::graph_traits<Triangle_mesh>::face_descriptor face_descriptor;
+
+// The distances to each source set must be those computed by a shortest paths object
+// having only that source set
+template <class ConcurrencyTag, class SourceSet>
+void test_source_sets(const Triangle_mesh& mesh,
+                      const std::vector<SourceSet>& source_sets)
+{
+  Surface_mesh_shortest_path shortest_paths(mesh);
+  shortest_paths.add_source_point(*(vertices(mesh).begin()));
+
+  std::vector<Kernel::FT> distances;
+  shortest_paths.shortest_distances_to_source_sets<ConcurrencyTag>(source_sets, distances);
+  assert(distances.size() == source_sets.size() * num_vertices(mesh));
+
+  // the source points of `shortest_paths` are not modified
+  assert(shortest_paths.number_of_source_points() == 1);
+
+  for (std::size_t s = 0; s < source_sets.size(); ++s)
+  {
+    Surface_mesh_shortest_path single(mesh);
+    single.add_source_points(source_sets[s].begin(), source_sets[s].end());
+
+    for (vertex_descriptor v : vertices(mesh))
+    {
+      assert(distances[s * num_vertices(mesh) + v.idx()] == single.shortest_distance_to_source_points(v).first);
+    }
+  }
+}
+
+// Dropping the cancelled events from the queue does not change the distances
+void test_queue_compaction(const Triangle_mesh& mesh)
+{
+  std::vector<Kernel::FT> compacted, not_compacted;
+  for (vertex_descriptor v : vertices(mesh))
+  {
+    Surface_mesh_shortest_path shortest_paths(mesh);
+    shortest_paths.add_source_point(v);
+    for (vertex_descriptor w : vertices(mesh))
+      compacted.push_back(shortest_paths.shortest_distance_to_source_points(w).first);
+
+    if (compacted.size() >= 50 * num_vertices(mesh))
+      break;
+  }
+
+  smsp_queue_compaction_size = (std::numeric_limits<std::size_t>::max)();
+  for (vertex_descriptor v : vertices(mesh))
+  {
+    Surface_mesh_shortest_path shortest_paths(mesh);
+    shortest_paths.add_source_point(v);
+    for (vertex_descriptor w : vertices(mesh))
+      not_compacted.push_back(shortest_paths.shortest_distance_to_source_points(w).first);
+
+    if (not_compacted.size() >= 50 * num_vertices(mesh))
+      break;
+  }
+  smsp_queue_compaction_size = 16;
+
+  assert(compacted == not_compacted);
+}
+
+template <class ConcurrencyTag>
+void test(const char* filename, const bool vertex_sources)
+{
+  Triangle_mesh mesh;
+  std::ifstream input(filename);
+  input >> mesh;
+  input.close();
+
+  std::cout << filename << ": " << num_vertices(mesh) << " nv" << std::endl;
+
+  std::vector<vertex_descriptor> vds(vertices(mesh).begin(), vertices(mesh).end());
+  std::vector<face_descriptor> fds(faces(mesh).begin(), faces(mesh).end());
+
+  std::vector<std::vector<vertex_descriptor> > vertex_sets;
+  std::vector<std::vector<Face_location> > location_sets;
+  for (std::size_t s = 0; s < 12; ++s)
+  {
+    std::vector<vertex_descriptor> vertex_set;
+    std::vector<Face_location> location_set;
+    for (std::size_t j = 0; j <= s % 3; ++j)
+    {
+      vertex_set.push_back(vds[(s * 37 + j * 101) % vds.size()]);
+      location_set.push_back(Face_location(fds[(s * 41 + j * 89) % fds.size()],
+                                           Barycentric_coordinates{{0.25, 0.25, 0.5}}));
+    }
+    vertex_sets.push_back(vertex_set);
+    location_sets.push_back(location_set);
+  }
+
+  if (vertex_sources)
+  {
+    test_source_sets<ConcurrencyTag>(mesh, vertex_sets);
+    test_queue_compaction(mesh);
+  }
+  test_source_sets<ConcurrencyTag>(mesh, location_sets);
+}
+
+int main()
+{
+  test<CGAL::Sequential_tag>("data/heightmap_20x30.off", true);
+  test<CGAL::Sequential_tag>("data/test_mesh_6.off", false);
+
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
+  test<CGAL::Parallel_tag>("data/heightmap_20x30.off", true);
+  test<CGAL::Parallel_tag>("data/test_mesh_6.off", false);
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,58 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Mean_curvature_flow_skeletonization.h>
+#include <CGAL/subdivision_method_3.h>
+#include <CGAL/Real_timer.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+typedef CGAL::Simple_cartesian<double>                        Kernel;
+typedef Kernel::Point_3                                       Point;
+typedef CGAL::Surface_mesh<Point>                             Triangle_mesh;
+
+// Times the skeletonization of a mesh, refined by Loop subdivision to get a large input.
+// Usage: concurrency_benchmark [mesh.off] [number of subdivisions]
+template <class ConcurrencyTag>
+double skeletonize(const Triangle_mesh& tmesh, std::size_t& skeleton_size)
+{
+  typedef CGAL::Mean_curvature_flow_skeletonization<Triangle_mesh, CGAL::Default, CGAL::Default,
+                                                    CGAL::Default, ConcurrencyTag> Skeletonization;
+  typename Skeletonization::Skeleton skeleton;
+
+  CGAL::Real_timer timer;
+  timer.start();
+  Skeletonization mcs(tmesh);
+  mcs(skeleton);
+  timer.stop();
+
+  skeleton_size = num_vertices(skeleton);
+  return timer.time();
+}
+
+int main(int argc, char* argv[])
+{
+  std::ifstream input((argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off"));
+  const unsigned int nb_subdivisions = (argc > 2) ? std::atoi(argv[2]) : 2;
+
+  Triangle_mesh tmesh;
+  if (!input || !(input >> tmesh) || is_empty(tmesh))
+  {
+    std::cerr << "Cannot read input mesh" << std::endl;
+    return EXIT_FAILURE;
+  }
+  CGAL::Subdivision_method_3::Loop_subdivision(tmesh, CGAL::parameters::number_of_iterations(nb_subdivisions));
+  std::cout << num_vertices(tmesh) << " vertices" << std::endl;
+
+  std::size_t skeleton_size;
+  double time = skeletonize<CGAL::Sequential_tag>(tmesh, skeleton_size);
+  std::cout << "Sequential: " << time << " s (" << skeleton_size << " skeleton vertices)" << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  time = skeletonize<CGAL::Parallel_tag>(tmesh, skeleton_size);
+  std::cout << "Parallel: " << time << " s (" << skeleton_size << " skeleton vertices)" << std::endl;
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -18,6 +18,9 @@
 #include <CGAL/IO/trace.h>
 #include <CGAL/Timer.h>
 #include <CGAL/Default.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 
 #include <CGAL/HalfedgeDS_default.h>
 #include <CGAL/HalfedgeDS_vertex_max_base_with_id.h>
@@ -72,6 +75,9 @@
 
 #include <queue>
 #include <unordered_map>
+#include <utility>
+#include <vector>
+
 
 // for default parameters
 #if defined(CGAL_EIGEN3_ENABLED)
@@ -157,6 +163,14 @@ struct Skel_polyhedron_items_3 {
 ///      >
 /// \endcode
 ///
+/// @tparam ConcurrencyTag
+///         enables sequential versus parallel computation of the per-vertex and per-edge steps of each iteration:
+///         the assembly of the linear system, the computation of the edge weights, and the tests of the local remeshing
+///         and of the degeneracy detection.
+///         Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+///         The result does not depend on the concurrency tag.<br>
+///         <b>%Default:</b> `Sequential_tag`
+///
 /// @cond CGAL_DOCUMENT_INTERNAL
 /// @tparam Degeneracy_algorithm_tag
 ///         tag for selecting the degeneracy detection algorithm
@@ -164,7 +178,8 @@ struct Skel_polyhedron_items_3 {
 template <class TriangleMesh,
           class Traits_ = Default,
           class VertexPointMap_ = Default,
-          class SolverTraits_ = Default>
+          class SolverTraits_ = Default,
+          class ConcurrencyTag = Sequential_tag>
 class Mean_curvature_flow_skeletonization
 {
 // Public types
@@ -308,8 +323,8 @@ private:
    *  greater than `m_max_id` are created during split,
    *  thus will not be considered in correspondence tracking. */
   int m_max_id;
-  /** Used when assembling the matrix. */
-  std::map<int, int> m_new_id;
+  /** Used when assembling the matrix: the row of each vertex, indexed by vertex id. */
+  std::vector<int> m_new_id;
 
   /** The incident angle for a halfedge. */
   std::vector<double> m_halfedge_angle;
@@ -665,14 +680,24 @@ public:
     {
       nrows = nver * 2;
     }
+    // The vertices in the order of their rows
+    std::vector<vertex_descriptor> vds(vertices(m_tmesh).begin(), vertices(m_tmesh).end());
+
+    // Vertices attracted by their pole
+    std::vector<char> is_pole_attractive;
+    if (m_is_medially_centered)
+    {
+      compute_pole_attraction(vds, is_pole_attractive);
+    }
+
     // Assemble linear system At * A * X = At * B
     typename SolverTraits::Matrix A(nrows, nver);
-    assemble_LHS(A);
+    assemble_LHS(A, vds, is_pole_attractive);
 
     typename SolverTraits::Vector X(nver), Bx(nrows);
     typename SolverTraits::Vector Y(nver), By(nrows);
     typename SolverTraits::Vector Z(nver), Bz(nrows);
-    assemble_RHS(Bx, By, Bz);
+    assemble_RHS(Bx, By, Bz, vds, is_pole_attractive);
 
     MCFSKEL_DEBUG(std::cerr << "before solve\n";)
 
@@ -918,6 +943,7 @@ private:
   double get_x(const Point& v){ return m_traits.compute_x_3_object()(v); }
   double get_y(const Point& v){ return m_traits.compute_y_3_object()(v); }
   double get_z(const Point& v){ return m_traits.compute_z_3_object()(v); }
+
   // --------------------------------------------------------------------------
   // Contraction
   // --------------------------------------------------------------------------
@@ -925,23 +951,47 @@ private:
   /// Compute cotangent weights of all edges.
   void compute_edge_weight()
   {
-    m_edge_weight.clear();
-    m_edge_weight.reserve(num_halfedges(m_tmesh));
-    for(halfedge_descriptor hd : halfedges(m_tmesh))
-      m_edge_weight.push_back(m_weight_calculator(hd));
+    std::vector<halfedge_descriptor> hds(halfedges(m_tmesh).begin(), halfedges(m_tmesh).end());
+    m_edge_weight.resize(hds.size());
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, hds.size()),
+      [&](std::size_t i) -> bool
+    {
+      m_edge_weight[i] = m_weight_calculator(hds[i]);
+      return true;
+    });
+  }
+
+  /// For each vertex of `vds`, check whether it is attracted by its pole,
+  /// that is whether the pole is inside the meso-skeleton.
+  void compute_pole_attraction(const std::vector<vertex_descriptor>& vds,
+                               std::vector<char>& is_pole_attractive)
+  {
+    Side_of_triangle_mesh<mTriangleMesh, Traits> test_inside(m_tmesh);
+
+    is_pole_attractive.assign(vds.size(), false);
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, vds.size()),
+      [&](std::size_t k) -> bool
+    {
+      vertex_descriptor vd = vds[k];
+      int id = static_cast<int>(get(m_vertex_id_pmap, vd));
+      is_pole_attractive[k] = !vd->is_fixed && id < m_max_id &&
+                              test_inside(vd->pole) == CGAL::ON_BOUNDED_SIDE;
+      return true;
+    });
   }
 
   /// Assemble the left hand side.
-  void assemble_LHS(typename SolverTraits::Matrix& A)
+  void assemble_LHS(typename SolverTraits::Matrix& A,
+                    const std::vector<vertex_descriptor>& vds,
+                    const std::vector<char>& is_pole_attractive)
   {
     MCFSKEL_DEBUG(std::cerr << "start LHS\n";)
 
-    std::size_t nver = num_vertices(m_tmesh);
+    std::size_t nver = vds.size();
 
-    Side_of_triangle_mesh<mTriangleMesh, Traits> test_inside(m_tmesh);
-
-    for(vertex_descriptor vd : vertices(m_tmesh))
+    for (std::size_t k = 0; k < nver; ++k)
     {
+      vertex_descriptor vd = vds[k];
       int id = static_cast<int>(get(m_vertex_id_pmap, vd));
 
       int i = m_new_id[id];
@@ -953,23 +1003,21 @@ private:
       else
       {
         A.set_coef(i + nver, i, m_omega_H, true);
-        if (m_is_medially_centered)
+        if (m_is_medially_centered && is_pole_attractive[k])
         {
-          if (id < m_max_id)
-          {
-            if (test_inside(vd->pole) == CGAL::ON_BOUNDED_SIDE)
-            {
-              A.set_coef(i + nver * 2, i, m_omega_P, true);
-            }
-          }
+          A.set_coef(i + nver * 2, i, m_omega_P, true);
         }
       }
     }
 
-    for(vertex_descriptor vd : vertices(m_tmesh))
+    // The rows of the Laplacian are computed independently,
+    // and inserted in the matrix in the order of the vertices.
+    typedef std::vector<std::pair<int, double> > Matrix_row;
+    std::vector<Matrix_row> rows(nver);
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, nver),
+      [&](std::size_t k) -> bool
     {
-      int id = static_cast<int>(get(m_vertex_id_pmap, vd));
-      int i = m_new_id[id];
+      vertex_descriptor vd = vds[k];
       double L = 1.0;
       // if the vertex is fixed
       if (vd->is_fixed)
@@ -977,16 +1025,25 @@ private:
         L = 0;
       }
       double diagonal = 0;
+      Matrix_row& row = rows[k];
       for(edge_descriptor ed : in_edges(vd, m_tmesh))
       {
         vertex_descriptor vj = source(ed, m_tmesh);
         double wij = m_edge_weight[get(m_hedge_id_pmap, halfedge(ed, m_tmesh))] * 2.0;
         int jd = static_cast<int>(get(m_vertex_id_pmap, vj));
         int j = m_new_id[jd];
-        A.set_coef(i, j, wij * L, true);
+        row.emplace_back(j, wij * L);
         diagonal += -wij;
       }
-      A.set_coef(i, i, diagonal, true);
+      row.emplace_back(m_new_id[get(m_vertex_id_pmap, vd)], diagonal);
+      return true;
+    });
+
+    for (std::size_t k = 0; k < nver; ++k)
+    {
+      int i = m_new_id[get(m_vertex_id_pmap, vds[k])];
+      for(const std::pair<int, double>& coef : rows[k])
+        A.set_coef(i, coef.first, coef.second, true);
     }
 
     MCFSKEL_DEBUG(std::cerr << "end LHS\n";)
@@ -995,14 +1052,14 @@ private:
   /// Assemble the right hand side.
   void assemble_RHS(typename SolverTraits::Vector& Bx,
                     typename SolverTraits::Vector& By,
-                    typename SolverTraits::Vector& Bz)
+                    typename SolverTraits::Vector& Bz,
+                    const std::vector<vertex_descriptor>& vds,
+                    const std::vector<char>& is_pole_attractive)
   {
     MCFSKEL_DEBUG(std::cerr << "start RHS\n";)
 
-    Side_of_triangle_mesh<mTriangleMesh, Traits> test_inside(m_tmesh);
-
     // assemble right columns of linear system
-    int nver = static_cast<int>(num_vertices(m_tmesh));
+    int nver = static_cast<int>(vds.size());
     for (int i = 0; i < nver; ++i)
     {
       Bx[i] = 0;
@@ -1010,8 +1067,10 @@ private:
       Bz[i] = 0;
     }
 
-    for(vertex_descriptor vd : vertices(m_tmesh))
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, vds.size()),
+      [&](std::size_t k) -> bool
     {
+      vertex_descriptor vd = vds[k];
       int id = static_cast<int>(get(m_vertex_id_pmap, vd));
       int i = m_new_id[id];
 
@@ -1023,15 +1082,9 @@ private:
       else
       {
         oh = m_omega_H;
-        if (m_is_medially_centered)
+        if (m_is_medially_centered && is_pole_attractive[k])
         {
-          if (id < m_max_id)
-          {
-            if (test_inside(vd->pole) == CGAL::ON_BOUNDED_SIDE)
-            {
-              op = m_omega_P;
-            }
-          }
+          op = m_omega_P;
         }
       }
       Bx[i + nver] = get_x(get(m_tmesh_point_pmap, vd)) * oh;
@@ -1046,7 +1099,8 @@ private:
         By[i + nver * 2] = y * op;
         Bz[i + nver * 2] = z * op;
       }
-    }
+      return true;
+    });
 
     MCFSKEL_DEBUG(std::cerr << "end RHS\n";)
   }
@@ -1054,7 +1108,7 @@ private:
   /// The order of vertex id is the same as the traverse order.
   void update_vertex_id()
   {
-    m_new_id.clear();
+    m_new_id.assign(m_vertex_id_count, -1);
     int cnt = 0;
 
     for(vertex_descriptor vd : vertices(m_tmesh))
@@ -1107,19 +1161,22 @@ private:
   /// Compute the incident angles for all the halfedges.
   void compute_incident_angle()
   {
-    m_halfedge_angle.clear();
-    int ne = 2 * static_cast<int>(num_edges(m_tmesh));
-    m_halfedge_angle.resize(ne, 0);
+    std::vector<halfedge_descriptor> hds;
+    hds.reserve(num_halfedges(m_tmesh));
 
     int idx = 0;
     for(halfedge_descriptor hd : halfedges(m_tmesh))
     {
       put(m_hedge_id_pmap, hd, idx++);
+      hds.push_back(hd);
     }
 
-    for(halfedge_descriptor hd : halfedges(m_tmesh))
+    m_halfedge_angle.assign(hds.size(), 0);
+
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, hds.size()),
+      [&](std::size_t e_id) -> bool
     {
-      int e_id = static_cast<int>(get(m_hedge_id_pmap, hd));
+      halfedge_descriptor hd = hds[e_id];
 
       if (is_border(hd, m_tmesh))
       {
@@ -1153,7 +1210,8 @@ private:
               acos((dis2_ik + dis2_jk - dis2_ij) / (2.0 * dis_ik * dis_jk));
         }
       }
-    }
+      return true;
+    });
   }
 
   void normalize(Vector& v)
@@ -1261,18 +1319,28 @@ private:
   /// its local neighborhood disk.
   std::size_t detect_degeneracies_in_disk()
   {
+    // the tests do not depend on the vertices being fixed, so they are
+    // all done before fixing the degenerate vertices
+    std::vector<vertex_descriptor> vds(vertices(m_tmesh).begin(), vertices(m_tmesh).end());
+    std::vector<char> willbefixed(vds.size(), false);
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, vds.size()),
+      [&](std::size_t k) -> bool
+    {
+      if (!vds[k]->is_fixed)
+      {
+        willbefixed[k] = internal::is_vertex_degenerate(m_tmesh, m_tmesh_point_pmap,
+                                                        vds[k], m_min_edge_length, m_traits);
+      }
+      return true;
+    });
+
     std::size_t num_fixed = 0;
-    for(vertex_descriptor v : vertices(m_tmesh))
+    for (std::size_t k = 0; k < vds.size(); ++k)
     {
-      if (!v->is_fixed)
+      if (willbefixed[k])
       {
-        bool willbefixed = internal::is_vertex_degenerate(m_tmesh, m_tmesh_point_pmap,
-                                                          v, m_min_edge_length, m_traits);
-        if (willbefixed)
-        {
-          v->is_fixed=true;
-          ++num_fixed;
-        }
+        vds[k]->is_fixed=true;
+        ++num_fixed;
       }
     }
 
@@ -1330,9 +1398,11 @@ private:
     }
 
     typedef std::pair<Exact_point, vertex_descriptor> Pair_type;
-    std::vector<Pair_type> duplicated_points;
-    for(const Pair_type& p : points)
+    std::vector<char> is_duplicated(points.size(), false);
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, points.size()),
+      [&](std::size_t k) -> bool
     {
+      const Pair_type& p = points[k];
       std::size_t vid = get(m_vertex_id_pmap, p.second);
       Point surface_point = get(m_tmesh_point_pmap, p.second);
 
@@ -1360,11 +1430,14 @@ private:
       if (max_neg_i!=-1)
         p.second->pole = cell_dual[max_neg_i];
       else
-        duplicated_points.push_back(p);
-    }
+        is_duplicated[k] = true;
+      return true;
+    });
 
-    for (const Pair_type& p : duplicated_points)
+    for (std::size_t k = 0; k < points.size(); ++k)
     {
+      if (!is_duplicated[k]) continue;
+      const Pair_type& p = points[k];
       typename Delaunay::Locate_type lt;
       int li, lj;
       typename Delaunay::Cell_handle cell = T.locate (p.first, lt, li, lj);
@@ -1425,16 +1498,26 @@ private:
 template <class TriangleMesh,
           class Traits_,
           class VertexPointMap_,
-          class SolverTraits_>
-std::size_t Mean_curvature_flow_skeletonization<TriangleMesh, Traits_, VertexPointMap_, SolverTraits_>::collapse_short_edges()
+          class SolverTraits_,
+          class ConcurrencyTag>
+std::size_t Mean_curvature_flow_skeletonization<TriangleMesh, Traits_, VertexPointMap_, SolverTraits_, ConcurrencyTag>::collapse_short_edges()
 {
   std::size_t cnt=0, prev_cnt=0;
 
   std::set<edge_descriptor,Less_id> edges_to_collapse, non_topologically_valid_collapses;
 
-  for(edge_descriptor ed : edges(m_tmesh))
-    if ( edge_should_be_collapsed(ed) )
-      edges_to_collapse.insert(ed);
+  std::vector<edge_descriptor> eds(edges(m_tmesh).begin(), edges(m_tmesh).end());
+  std::vector<char> is_short(eds.size(), false);
+  CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, eds.size()),
+    [&](std::size_t k) -> bool
+  {
+    is_short[k] = edge_should_be_collapsed(eds[k]);
+    return true;
+  });
+
+  for (std::size_t k = 0; k < eds.size(); ++k)
+    if ( is_short[k] )
+      edges_to_collapse.insert(eds[k]);
 
   do{
     prev_cnt=cnt;
@@ -0,0 +1,75 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Mean_curvature_flow_skeletonization.h>
+
+#include <cassert>
+#include <fstream>
+#include <iostream>
+
+typedef CGAL::Simple_cartesian<double>                               Kernel;
+typedef Kernel::Point_3                                              Point;
+typedef CGAL::Surface_mesh<Point>                                    Triangle_mesh;
+
+template <class ConcurrencyTag>
+struct Skeletonization
+{
+  typedef CGAL::Mean_curvature_flow_skeletonization<Triangle_mesh, CGAL::Default, CGAL::Default,
+                                                    CGAL::Default, ConcurrencyTag> type;
+};
+
+typedef Skeletonization<CGAL::Sequential_tag>::type::Skeleton        Skeleton;
+typedef boost::graph_traits<Skeleton>::vertex_descriptor             Skeleton_vertex;
+typedef boost::graph_traits<Skeleton>::edge_descriptor               Skeleton_edge;
+
+template <class ConcurrencyTag>
+void skeletonize(const Triangle_mesh& tmesh, bool is_medially_centered,
+                 typename Skeletonization<ConcurrencyTag>::type::Skeleton& skeleton)
+{
+  typename Skeletonization<ConcurrencyTag>::type mcs(tmesh);
+  mcs.set_is_medially_centered(is_medially_centered);
+  mcs(skeleton);
+}
+
+// The skeleton must not depend on the concurrency tag
+void test(const Triangle_mesh& tmesh, bool is_medially_centered)
+{
+  Skeleton sequential_skeleton;
+  skeletonize<CGAL::Sequential_tag>(tmesh, is_medially_centered, sequential_skeleton);
+  std::cout << "medially centered: " << is_medially_centered << ", "
+            << num_vertices(sequential_skeleton) << " skeleton vertices" << std::endl;
+  assert(num_vertices(sequential_skeleton) > 0);
+
+#ifdef CGAL_HAS_PARALLEL_FOR_EACH
+  Skeletonization<CGAL::Parallel_tag>::type::Skeleton parallel_skeleton;
+  skeletonize<CGAL::Parallel_tag>(tmesh, is_medially_centered, parallel_skeleton);
+
+  assert(num_vertices(parallel_skeleton) == num_vertices(sequential_skeleton));
+  assert(num_edges(parallel_skeleton) == num_edges(sequential_skeleton));
+  for(Skeleton_vertex v : CGAL::make_range(vertices(sequential_skeleton)))
+  {
+    assert(sequential_skeleton[v].point == parallel_skeleton[v].point);
+    assert(sequential_skeleton[v].vertices == parallel_skeleton[v].vertices);
+  }
+  for(Skeleton_edge e : CGAL::make_range(edges(sequential_skeleton)))
+  {
+    assert(edge(source(e, sequential_skeleton), target(e, sequential_skeleton), parallel_skeleton).second);
+  }
+#endif
+}
+
+int main(int argc, char** argv)
+{
+  std::ifstream input((argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off"));
+  Triangle_mesh tmesh;
+  if (!input || !(input >> tmesh) || is_empty(tmesh))
+  {
+    std::cerr << "Cannot read input mesh" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  test(tmesh, true);
+  test(tmesh, false);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
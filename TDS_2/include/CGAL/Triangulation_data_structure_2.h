@@ -2010,6 +2010,10 @@ copy_tds(const TDS_src& tds_src,
   Unique_hash_map<typename TDS_src::Vertex_handle,Vertex_handle> vmap(Vertex_handle(), tds_src.number_of_vertices());
   Unique_hash_map<typename TDS_src::Face_handle,Face_handle> fmap(Face_handle(), tds_src.number_of_faces());
 
+  // allocate the vertices and faces in one block each
+  vertices().reserve(tds_src.number_of_vertices());
+  faces().reserve(tds_src.faces().size());
+
   // create vertices
   typename TDS_src::Vertex_iterator vit1 = tds_src.vertices_begin();
   for( ; vit1 != tds_src.vertices_end(); ++vit1) {
@@ -98,6 +98,14 @@ Returns a reference to the container of vertices.
 */
 Vertex_range & vertices();
 
+/*!
+Reserves the memory of `nv` vertices and `nc` cells, each in a single block,
+when their number is known in advance, so that creating them does not allocate.
+Has no effect if `ConcurrencyTag` is `Parallel_tag`, as the concurrent
+containers allocate their blocks on demand.
+*/
+void reserve(size_type nv, size_type nc);
+
 /// @}
 
 }; /* end Triangulation_data_structure_3 */
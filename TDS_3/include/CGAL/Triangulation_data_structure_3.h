@@ -325,6 +325,16 @@ public:
       return create_cell(*c);
     }
 
+  // Allocates the memory of `nv` vertices and `nc` cells in one block each, when their number
+  // is known in advance. The concurrent containers allocate their blocks on demand.
+  void reserve(size_type nv, size_type nc)
+    {
+      if constexpr(!std::is_convertible<Concurrency_tag, Parallel_tag>::value) {
+        vertices().reserve(nv);
+        cells().reserve(nc);
+      }
+    }
+
   Cell_handle create_cell(Vertex_handle v0, Vertex_handle v1,
                           Vertex_handle v2, Vertex_handle v3)
     {
@@ -1633,6 +1643,7 @@ public:
 
     std::size_t V_size = n;
     std::vector< Vertex_handle > V(V_size);
+    reserve(V_size, 0);
 
     // the infinite vertex is numbered 0
     for (std::size_t i=0 ; i < V_size; ++i) {
@@ -1965,6 +1976,7 @@ operator>>(std::istream& is, Triangulation_data_structure_3<Vb,Cb,Ct>& tds)
     return is;
 
   std::vector<Vertex_handle > V(n);
+  tds.reserve(n, 0);
 
   // creation of the vertices
   for (std::size_t i=0; i < n; i++) {
@@ -2564,6 +2576,7 @@ read_cells(std::istream& is, const std::vector< Vertex_handle > &V,
         read(is, m);
 
       C.resize(m);
+      reserve(0, m);
 
       for(std::size_t i = 0; i < m; i++) {
         Cell_handle c = create_cell();
@@ -4098,6 +4111,8 @@ copy_tds(const TDS_src& tds,
   Unique_hash_map< typename TDS_src::Vertex_handle,Vertex_handle > V(Vertex_handle(), tds.number_of_vertices());
   Unique_hash_map< typename TDS_src::Cell_handle,Cell_handle > F(Cell_handle(), tds.number_of_cells());
 
+  reserve(tds.number_of_vertices(), tds.cells().size());
+
   // Create the vertices.
   for (typename TDS_src::Vertex_iterator vit = tds.vertices_begin();
        vit != tds.vertices_end(); ++vit) {
@@ -198,6 +198,7 @@ public:
     CGAL_precondition(internal::polygon_type_2(polygon, traits, point_map) ==
                       internal::Polygon_type::STRICTLY_CONVEX);
     resize();
+    compute_corner_areas();
   }
 
   /// @}
@@ -261,6 +262,19 @@ private:
     w.resize(m_polygon.size());
   }
 
+  // The areas C only depend on the polygon, so they are computed once for all queries.
+  void compute_corner_areas()
+  {
+    const std::size_t n = m_polygon.size();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      const auto& pi0 = get(m_point_map, *(m_polygon.begin() + (i + n - 1) % n));
+      const auto& pi1 = get(m_point_map, *(m_polygon.begin() + i));
+      const auto& pi2 = get(m_point_map, *(m_polygon.begin() + (i + 1) % n));
+      C[i] = m_area_2(pi0, pi1, pi2);
+    }
+  }
+
   template<typename OutputIterator>
   OutputIterator optimal_weights(const Point_2& query,
                                  OutputIterator weights,
@@ -270,28 +284,19 @@ private:
     // Get the number of vertices in the polygon.
     const std::size_t n = m_polygon.size();
 
-    // Compute areas A and C following the area notation from [1].
-    // Split the loop to make this computation faster.
-    const auto& p1 = get(m_point_map, *(m_polygon.begin() + 0));
-    const auto& p2 = get(m_point_map, *(m_polygon.begin() + 1));
-    const auto& pn = get(m_point_map, *(m_polygon.begin() + (n - 1)));
-
-    A[0] = m_area_2(p1, p2, query);
-    C[0] = m_area_2(pn, p1, p2);
-
-    for (std::size_t i = 1; i < n - 1; ++i)
+    // Compute areas A following the area notation from [1].
+    // The areas C are computed in the constructor.
+    for (std::size_t i = 0; i < n - 1; ++i)
     {
-      const auto& pi0 = get(m_point_map, *(m_polygon.begin() + (i - 1)));
       const auto& pi1 = get(m_point_map, *(m_polygon.begin() + (i + 0)));
       const auto& pi2 = get(m_point_map, *(m_polygon.begin() + (i + 1)));
 
       A[i] = m_area_2(pi1, pi2, query);
-      C[i] = m_area_2(pi0, pi1, pi2);
     }
 
-    const auto& pm = get(m_point_map, *(m_polygon.begin() + (n - 2)));
+    const auto& p1 = get(m_point_map, *(m_polygon.begin() + 0));
+    const auto& pn = get(m_point_map, *(m_polygon.begin() + (n - 1)));
     A[n - 1] = m_area_2(pn, p1, query);
-    C[n - 1] = m_area_2(pm, pn, p1);
 
     // Compute unnormalized weights following the formula (28) from [1].
     CGAL_assertion(A[n - 1] != FT(0) && A[0] != FT(0));